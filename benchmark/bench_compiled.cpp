@@ -0,0 +1,87 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "mechanisms.hpp"
+
+#include <mechanism_configuration/compiled.hpp>
+#include <mechanism_configuration/mapped.hpp>
+#include <mechanism_configuration/parse.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  // The benchmarks' v1 YAML mechanism with state.range(0) reactions, as one file
+  std::filesystem::path SyntheticConfig(benchmark::State& state)
+  {
+    const auto n_reactions = static_cast<std::size_t>(state.range(0));
+    return bench::WriteMechanism("compiled_" + std::to_string(n_reactions), bench::MixedMechanism(n_reactions));
+  }
+}  // namespace
+
+// Reads a mechanism back from a compiled image; compare with BM_Parse_SingleLoad.
+static void BM_LoadCompiled(benchmark::State& state)
+{
+  const auto config = SyntheticConfig(state);
+  const auto image = std::filesystem::path(config).replace_extension(".mcc");
+  auto parsed = Parse(config);
+  if (!parsed || !SaveCompiled(*parsed, image).empty())
+  {
+    state.SkipWithError("could not write the compiled image");
+    return;
+  }
+  for (auto _ : state)
+  {
+    auto loaded = LoadCompiled(image);
+    benchmark::DoNotOptimize(loaded);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Parse() with a warm cache: the source files are hashed and the image is read instead of the YAML.
+static void BM_Parse_CacheHit(benchmark::State& state)
+{
+  const auto config = SyntheticConfig(state);
+  const ParseOptions options{ .cache_path = std::filesystem::path(config).replace_extension(".cache.mcc") };
+  std::filesystem::remove(options.cache_path);
+  auto warm = Parse(config, options);
+  benchmark::DoNotOptimize(warm);
+  for (auto _ : state)
+  {
+    auto parsed = Parse(config, options);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Maps an image and reads every reaction's rate parameters in place; nothing is copied to the heap.
+static void BM_OpenMapped(benchmark::State& state)
+{
+  const auto config = SyntheticConfig(state);
+  const auto image = std::filesystem::path(config).replace_extension(".mcm");
+  auto parsed = Parse(config);
+  if (!parsed || !SaveMappedImage(*parsed, image).empty())
+  {
+    state.SkipWithError("could not write the mapped image");
+    return;
+  }
+  for (auto _ : state)
+  {
+    auto mapped = MappedMechanism::Open(image);
+    double sum = 0;
+    for (const auto reaction : mapped->reactions().arrhenius)
+      sum += reaction.A();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_LoadCompiled)->RangeMultiplier(10)->Range(100, 50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Parse_CacheHit)->RangeMultiplier(10)->Range(100, 50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OpenMapped)->RangeMultiplier(10)->Range(100, 50000)->Unit(benchmark::kMillisecond);
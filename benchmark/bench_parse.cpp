@@ -0,0 +1,156 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "mechanisms.hpp"
+
+#include <mechanism_configuration/parse.hpp>
+
+#include <benchmark/benchmark.h>
+#include <yaml-cpp/yaml.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  // The benchmarks' v1 YAML mechanism with state.range(0) reactions, as one file
+  std::filesystem::path SyntheticConfig(benchmark::State& state)
+  {
+    const auto n_reactions = static_cast<std::size_t>(state.range(0));
+    return bench::WriteMechanism("parse_" + std::to_string(n_reactions), bench::MixedMechanism(n_reactions));
+  }
+}  // namespace
+
+// Parse() loads the root document once and hands it to the version-specific parser.
+static void BM_Parse_SingleLoad(benchmark::State& state)
+{
+  const auto path = SyntheticConfig(state);
+  for (auto _ : state)
+  {
+    auto parsed = Parse(path);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Reproduces the previous dispatch, which loaded the whole document once to read `version`
+// and then again inside the version-specific parser.
+static void BM_Parse_LoadTwice(benchmark::State& state)
+{
+  const auto path = SyntheticConfig(state);
+  for (auto _ : state)
+  {
+    YAML::Node version_probe = YAML::LoadFile(path.string());
+    benchmark::DoNotOptimize(version_probe);
+    auto parsed = Parse(path);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Streams the reactions one at a time instead of loading them into the document tree.
+static void BM_Parse_Streaming(benchmark::State& state)
+{
+  const auto path = SyntheticConfig(state);
+  const ParseOptions options{ .stream_reactions = true };
+  for (auto _ : state)
+  {
+    auto parsed = Parse(path, options);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// A mechanism split across state.range(0) reaction files of 50 reactions each, with the files
+// read one after another (the default) or concurrently.
+static void BM_Parse_FileList(benchmark::State& state, bool parallel_file_loading)
+{
+  const auto n_files = static_cast<std::size_t>(state.range(0));
+  SyntheticOptions mechanism = bench::MixedMechanism(n_files * 50);
+  mechanism.files = n_files;
+  const auto path = bench::WriteMechanism("file_list_" + std::to_string(n_files), mechanism);
+  const ParseOptions options{ .parallel_file_loading = parallel_file_loading };
+  for (auto _ : state)
+  {
+    auto parsed = Parse(path, options);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// A v0 (CAMP) configuration directory: a file list naming a species file and reaction files of
+// at most 100k reactions each. Each CAMP file is built and released before the next is loaded.
+static void BM_Parse_V0Directory(benchmark::State& state)
+{
+  const auto n_reactions = static_cast<std::size_t>(state.range(0));
+  SyntheticOptions mechanism = bench::MixedMechanism(n_reactions, 0);
+  mechanism.format = SyntheticFormat::Json;
+  mechanism.files = (n_reactions + 99999) / 100000;
+  const auto path = bench::WriteMechanism("v0_" + std::to_string(n_reactions), mechanism);
+  for (auto _ : state)
+  {
+    auto parsed = Parse(path);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The v1 synthetic mechanism written as JSON rather than YAML.
+static void BM_Parse_V1Json(benchmark::State& state)
+{
+  const auto n_reactions = static_cast<std::size_t>(state.range(0));
+  SyntheticOptions mechanism = bench::MixedMechanism(n_reactions);
+  mechanism.format = SyntheticFormat::Json;
+  const auto path = bench::WriteMechanism("json_" + std::to_string(n_reactions), mechanism);
+  for (auto _ : state)
+  {
+    auto parsed = Parse(path);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The v1 synthetic mechanism split into a file-list configuration with ten reaction files.
+static void BM_Parse_V1MultiFile(benchmark::State& state)
+{
+  const auto n_reactions = static_cast<std::size_t>(state.range(0));
+  SyntheticOptions mechanism = bench::MixedMechanism(n_reactions);
+  mechanism.files = 10;
+  const auto path = bench::WriteMechanism("multi_file_" + std::to_string(n_reactions), mechanism);
+  for (auto _ : state)
+  {
+    auto parsed = Parse(path);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ParseFromString(benchmark::State& state)
+{
+  std::ifstream file(SyntheticConfig(state), std::ios::binary);
+  const std::string config(std::istreambuf_iterator<char>(file), {});
+  for (auto _ : state)
+  {
+    auto parsed = ParseFromString(config);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Parse_SingleLoad)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Parse_LoadTwice)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Parse_V0Directory)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMillisecond);
+// These load the whole v1 document tree (a file list is merged into one) before building it,
+// which already peaks near 2 GB at 100k reactions; 1M would need about ten times that. Only
+// streaming, and v0 with its reactions split across CAMP files, keep 1M reactions within the
+// memory of a typical workstation.
+BENCHMARK(BM_Parse_V1Json)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Parse_V1MultiFile)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParseFromString)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Parse_Streaming)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Parse_FileList, Serial, false)->Arg(10)->Arg(200)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Parse_FileList, Parallel, true)->Arg(10)->Arg(200)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,123 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/parse.hpp>
+#include <mechanism_configuration/rate_constants.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  // The full configuration (every reaction type) with its reaction lists repeated `copies` times
+  Mechanism ScaledMechanism(std::size_t copies)
+  {
+    auto parsed = Parse(std::filesystem::path(MECH_CONFIG_BENCH_EXAMPLES_DIR) / "v1" / "full_configuration.yaml");
+    if (!parsed)
+      return {};
+    Mechanism mechanism = std::move(*parsed);
+    auto repeat = [copies](auto& reactions)
+    {
+      const auto one = reactions;
+      for (std::size_t i = 1; i < copies; ++i)
+        reactions.insert(reactions.end(), one.begin(), one.end());
+    };
+    types::Reactions& r = mechanism.reactions;
+    repeat(r.arrhenius);
+    repeat(r.branched);
+    repeat(r.taylor_series);
+    repeat(r.troe);
+    repeat(r.ternary_chemical_activation);
+    repeat(r.tunneling);
+    return mechanism;
+  }
+
+  // Only the Troe and ternary chemical activation reactions of the scaled full configuration
+  Mechanism FalloffMechanism(std::size_t copies)
+  {
+    Mechanism mechanism = ScaledMechanism(copies);
+    types::Reactions& r = mechanism.reactions;
+    r.arrhenius.clear();
+    r.branched.clear();
+    r.taylor_series.clear();
+    r.tunneling.clear();
+    return mechanism;
+  }
+
+  // Arrhenius reactions in the proportions typical of atmospheric mechanisms: most have
+  // B = E = 0, some of those also C = 0, and the rest use every term.
+  Mechanism TypicalArrheniusMechanism(std::size_t n_reactions)
+  {
+    Mechanism mechanism;
+    for (std::size_t i = 0; i < n_reactions; ++i)
+    {
+      types::Arrhenius reaction{ .A = 1.0e-12 * static_cast<double>(1 + i % 7) };
+      if (i % 10 < 6)
+        reaction.C = -250.0;
+      else if (i % 10 == 9)
+      {
+        reaction.B = -1.3;
+        reaction.C = -250.0;
+        reaction.E = 1.0e-6;
+      }
+      mechanism.reactions.arrhenius.push_back(reaction);
+    }
+    return mechanism;
+  }
+
+  // Evaluates every rate constant of `engine` for range(0) cells spanning 180-330 K.
+  void EvaluateCells(benchmark::State& state, const RateConstantEngine& engine)
+  {
+    const auto cells = static_cast<std::size_t>(state.range(0));
+    std::vector<double> temperature(cells), pressure(cells), air_density(cells);
+    for (std::size_t c = 0; c < cells; ++c)
+    {
+      temperature[c] = 180.0 + 150.0 * static_cast<double>(c) / static_cast<double>(cells);
+      pressure[c] = 1.0e5;
+      air_density[c] = pressure[c] / (8.314 * temperature[c]);
+    }
+    std::vector<double> rate_constants(engine.order().size * cells);
+    for (auto _ : state)
+    {
+      engine.Evaluate(temperature, pressure, air_density, rate_constants);
+      benchmark::DoNotOptimize(rate_constants.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rate_constants.size()));
+  }
+}  // namespace
+
+// The scaled full configuration, every reaction type.
+static void BM_EvaluateRateConstants(benchmark::State& state)
+{
+  EvaluateCells(state, RateConstantEngine(ScaledMechanism(100)));
+}
+
+// 10,000 typical Arrhenius reactions, with kernels specialized for the active terms of each rate
+// expression or with the full formula throughout.
+static void BM_EvaluateArrhenius(benchmark::State& state, bool specialize_kernels)
+{
+  EvaluateCells(state, RateConstantEngine(TypicalArrheniusMechanism(10000), { .specialize_kernels = specialize_kernels }));
+}
+
+// 1,000 falloff reactions, from the full formula or interpolated from temperature and air
+// density tables.
+static void BM_EvaluateFalloff(benchmark::State& state, bool tables, RateTableInterpolation interpolation)
+{
+  RateConstantOptions options;
+  options.tables.enabled = tables;
+  options.tables.interpolation = interpolation;
+  EvaluateCells(state, RateConstantEngine(FalloffMechanism(500), options));
+}
+
+BENCHMARK(BM_EvaluateRateConstants)->RangeMultiplier(8)->Range(64, 4096);
+BENCHMARK_CAPTURE(BM_EvaluateArrhenius, Specialized, true)->Arg(64)->Arg(1024);
+BENCHMARK_CAPTURE(BM_EvaluateArrhenius, FullFormula, false)->Arg(64)->Arg(1024);
+BENCHMARK_CAPTURE(BM_EvaluateFalloff, FullFormula, false, RateTableInterpolation::Linear)->Arg(64)->Arg(1024);
+BENCHMARK_CAPTURE(BM_EvaluateFalloff, LinearTables, true, RateTableInterpolation::Linear)->Arg(64)->Arg(1024);
+BENCHMARK_CAPTURE(BM_EvaluateFalloff, CubicTables, true, RateTableInterpolation::Cubic)->Arg(64)->Arg(1024);
@@ -0,0 +1,361 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "mechanisms.hpp"
+
+#include "detail/v0/parser_types.hpp"
+#include "detail/v1/emissions/keys.hpp"
+#include "detail/v1/emissions/parsers.hpp"
+#include "detail/v1/emissions/schema.hpp"
+#include "detail/v1/keys.hpp"
+#include "detail/v1/parser.hpp"
+#include "detail/v1/reactions/parsers.hpp"
+#include "detail/v1/reactions/schema.hpp"
+#include "detail/v1/species/parsers.hpp"
+#include "detail/v1/species/schema.hpp"
+
+#include <mechanism_configuration/parse.hpp>
+#include <mechanism_configuration/validate.hpp>
+
+#include <benchmark/benchmark.h>
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  // A loaded v1 synthetic mechanism with state.range(0) reactions of every kind and emission
+  // sources, but no aerosol, which the multi-pass pipeline does not build.
+  YAML::Node SyntheticDocument(benchmark::State& state)
+  {
+    const auto n_reactions = static_cast<std::size_t>(state.range(0));
+    SyntheticOptions options = bench::MixedMechanism(n_reactions);
+    options.phases = 1;
+    options.aerosol_processes = 0;
+    const auto path = bench::WriteMechanism("validate_and_build_" + std::to_string(n_reactions), options);
+    return YAML::LoadFile(path.string());
+  }
+
+  std::size_t Reactions(const Mechanism& mechanism)
+  {
+    const types::Reactions& r = mechanism.reactions;
+    return r.arrhenius.size() + r.branched.size() + r.emission.size() + r.first_order_loss.size() + r.photolysis.size() +
+           r.surface.size() + r.taylor_series.size() + r.troe.size() + r.ternary_chemical_activation.size() +
+           r.tunneling.size() + r.user_defined.size() + r.lambda_rate_constant.size();
+  }
+
+  std::size_t AerosolProcesses(const Mechanism& mechanism)
+  {
+    return mechanism.aerosol ? mechanism.aerosol->processes.size() : 0;
+  }
+
+  std::size_t EmissionSources(const Mechanism& mechanism)
+  {
+    return mechanism.emissions ? mechanism.emissions->sources.size() : 0;
+  }
+
+  // Repeats the reactions, aerosol processes and emission sources of a parsed mechanism
+  // `copies` times, so validation can be measured at sizes too large to parse from text.
+  // Repeated sources are renamed and given their own hierarchy so that the result stays valid.
+  Mechanism ScaledMechanism(const Mechanism& base, std::size_t copies)
+  {
+    Mechanism mechanism = base;
+    auto repeat = [copies](auto& to, const auto& from)
+    {
+      to.reserve(from.size() * copies);
+      for (std::size_t copy = 1; copy < copies; ++copy)
+        to.insert(to.end(), from.begin(), from.end());
+    };
+    repeat(mechanism.reactions.arrhenius, base.reactions.arrhenius);
+    repeat(mechanism.reactions.branched, base.reactions.branched);
+    repeat(mechanism.reactions.emission, base.reactions.emission);
+    repeat(mechanism.reactions.first_order_loss, base.reactions.first_order_loss);
+    repeat(mechanism.reactions.photolysis, base.reactions.photolysis);
+    repeat(mechanism.reactions.surface, base.reactions.surface);
+    repeat(mechanism.reactions.taylor_series, base.reactions.taylor_series);
+    repeat(mechanism.reactions.troe, base.reactions.troe);
+    repeat(mechanism.reactions.ternary_chemical_activation, base.reactions.ternary_chemical_activation);
+    repeat(mechanism.reactions.tunneling, base.reactions.tunneling);
+    repeat(mechanism.reactions.user_defined, base.reactions.user_defined);
+    repeat(mechanism.reactions.lambda_rate_constant, base.reactions.lambda_rate_constant);
+    if (base.aerosol)
+      repeat(mechanism.aerosol->processes, base.aerosol->processes);
+    if (base.emissions)
+    {
+      auto& sources = mechanism.emissions->sources;
+      const std::size_t n_sources = base.emissions->sources.size();
+      repeat(sources, base.emissions->sources);
+      for (std::size_t i = n_sources; i < sources.size(); ++i)
+      {
+        sources[i].name += "_" + std::to_string(i / n_sources);
+        sources[i].hierarchy += static_cast<int>(i / n_sources) * 1000;
+      }
+    }
+    return mechanism;
+  }
+
+  // A parsed synthetic mechanism, repeated until it has at least state.range(0) of the items
+  // `count` counts
+  template<typename Count>
+  Mechanism ScaledSyntheticMechanism(
+      benchmark::State& state,
+      const std::string& name,
+      const SyntheticOptions& options,
+      Count count)
+  {
+    auto parsed = Parse(bench::WriteMechanism(name, options));
+    if (!parsed)
+    {
+      state.SkipWithError(parsed.error().front().second.c_str());
+      return {};
+    }
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const std::size_t per_copy = std::max<std::size_t>(count(*parsed), 1);
+    return ScaledMechanism(*parsed, (n + per_copy - 1) / per_copy);
+  }
+
+  // The validate-and-build pipeline as separate passes over the document: the schema check
+  // walks the reactions, the semantic input walks them again, and the build parses the
+  // species, phases and reactions once more.
+  Mechanism MultiPassValidateAndBuild(const YAML::Node& object)
+  {
+    Errors errors = v1::CheckSpeciesSchema(object[v1::keys::species]);
+    auto species = v1::ParseSpecies(object[v1::keys::species], nullptr);
+    auto phase_errors = v1::CheckPhasesSchema(object[v1::keys::phases], species);
+    errors.insert(errors.end(), phase_errors.begin(), phase_errors.end());
+    auto phases = v1::ParsePhases(object[v1::keys::phases], nullptr);
+    auto reaction_errors = v1::CheckReactionsSchema(object[v1::keys::reactions], species, phases);
+    errors.insert(errors.end(), reaction_errors.begin(), reaction_errors.end());
+    auto emission_errors = v1::CheckEmissionsSchema(object[std::string(v1::keys::emissions)]);
+    errors.insert(errors.end(), emission_errors.begin(), emission_errors.end());
+
+    std::vector<semantics::ReactionRef> references;
+    for (const auto& reaction : object[v1::keys::reactions])
+      references.push_back(v1::BuildReactionSemanticRef(reaction));
+    Diagnostics semantic{ .entries =
+                              ValidateReactionsSemantics(v1::BuildReactionsSemanticInput(object, std::move(references))) };
+    auto emissions_errors = ValidateEmissionsSemantics(v1::BuildEmissionsSemanticInput(object));
+    semantic.entries.insert(semantic.entries.end(), emissions_errors.begin(), emissions_errors.end());
+    Errors semantic_errors = semantic.ToErrors();
+    errors.insert(errors.end(), semantic_errors.begin(), semantic_errors.end());
+    if (!errors.empty())
+      throw std::runtime_error(errors.front().second);
+
+    Mechanism mechanism;
+    mechanism.version = Version(object[v1::keys::version].as<std::string>());
+    mechanism.name = object[v1::keys::name].as<std::string>();
+    types::UnknownProperties* unknown_properties = &mechanism.unknown_properties;
+    mechanism.species = v1::ParseSpecies(object[v1::keys::species], unknown_properties);
+    mechanism.phases = v1::ParsePhases(object[v1::keys::phases], unknown_properties);
+    mechanism.reactions = v1::ParseReactions(object[v1::keys::reactions], unknown_properties);
+    mechanism.emissions = v1::ParseEmissions(object[std::string(v1::keys::emissions)], unknown_properties);
+    return mechanism;
+  }
+
+  // A synthetic mechanism scaled (see ScaledSyntheticMechanism) to state.range(0) of the items
+  // `count` counts, validated by `validate`.
+  template<typename Count, typename Validate>
+  void ValidateScaled(
+      benchmark::State& state,
+      const std::string& name,
+      const SyntheticOptions& options,
+      Count count,
+      Validate validate)
+  {
+    const Mechanism mechanism = ScaledSyntheticMechanism(state, name, options, count);
+    for (auto _ : state)
+    {
+      auto errors = validate(mechanism);
+      if (!errors.empty())
+        state.SkipWithError(errors.front().second.c_str());
+      benchmark::DoNotOptimize(errors);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count(mechanism)));
+  }
+
+  // Gas-phase reactions of every kind scaled to state.range(0) reactions, with the species list
+  // emptied so that every species a reaction references is an error.
+  Mechanism UnknownSpeciesMechanism(benchmark::State& state)
+  {
+    const SyntheticOptions options{ .reactions = bench::EveryKind(1200) };
+    Mechanism mechanism = ScaledSyntheticMechanism(state, "unknown_species", options, Reactions);
+    mechanism.species.clear();
+    return mechanism;
+  }
+
+  // The reactions of a v0 synthetic mechanism with state.range(0) reactions
+  YAML::Node SyntheticV0Reactions(benchmark::State& state)
+  {
+    const auto n_reactions = static_cast<std::size_t>(state.range(0));
+    SyntheticOptions options = bench::MixedMechanism(n_reactions, 0);
+    options.format = SyntheticFormat::Json;
+    const auto path = bench::WriteMechanism("schema_v0_" + std::to_string(n_reactions), options);
+    const YAML::Node file = YAML::LoadFile((path.parent_path() / "mechanism.json").string());
+    for (const auto& entry : file["camp-data"])
+      if (entry["type"].Scalar() == "MECHANISM")
+        return entry["reactions"];
+    throw std::runtime_error("The synthetic v0 mechanism has no MECHANISM entry");
+  }
+
+  // Runs the v0 parser of each reaction's type over a CAMP reaction list
+  Errors CheckV0ReactionsSchema(const YAML::Node& reactions)
+  {
+    using ReactionParser = Errors (*)(Mechanism&, const YAML::Node&);
+    static const std::map<std::string, ReactionParser, std::less<>> parsers{
+      { "ARRHENIUS", v0::ArrheniusParser },
+      { "BRANCHED", v0::BranchedParser },
+      { "EMISSION", v0::EmissionParser },
+      { "FIRST_ORDER_LOSS", v0::FirstOrderLossParser },
+      { "PHOTOLYSIS", v0::PhotolysisParser },
+      { "SURFACE", v0::SurfaceParser },
+      { "TERNARY_CHEMICAL_ACTIVATION", v0::TernaryChemicalActivationParser },
+      { "TROE", v0::TroeParser },
+      { "TUNNELING", v0::TunnelingParser },
+      { "USER_DEFINED", v0::UserDefinedParser },
+    };
+    Mechanism mechanism;
+    Errors errors;
+    for (const auto& reaction : reactions)
+    {
+      auto parser = parsers.find(reaction["type"].Scalar());
+      if (parser == parsers.end())
+        throw std::runtime_error("Unknown v0 reaction type: " + reaction["type"].Scalar());
+      auto reaction_errors = parser->second(mechanism, reaction);
+      errors.insert(errors.end(), reaction_errors.begin(), reaction_errors.end());
+    }
+    return errors;
+  }
+}  // namespace
+
+// The parser's single traversal: each reaction is checked, referenced and built in one visit.
+static void BM_ValidateAndBuild_Fused(benchmark::State& state)
+{
+  const YAML::Node object = SyntheticDocument(state);
+  const auto n_reactions = static_cast<std::int64_t>(object[v1::keys::reactions].size());
+  for (auto _ : state)
+  {
+    auto parsed = v1::Parser{}.Parse(object);
+    if (!parsed)
+      state.SkipWithError(parsed.error().front().second.c_str());
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * n_reactions);
+}
+
+static void BM_ValidateAndBuild_MultiPass(benchmark::State& state)
+{
+  const YAML::Node object = SyntheticDocument(state);
+  const auto n_reactions = static_cast<std::int64_t>(object[v1::keys::reactions].size());
+  for (auto _ : state)
+  {
+    auto mechanism = MultiPassValidateAndBuild(object);
+    benchmark::DoNotOptimize(mechanism);
+  }
+  state.SetItemsProcessed(state.iterations() * n_reactions);
+}
+
+// The schema check alone, over the reactions of a synthetic v1 or v0 (state.range(1))
+// mechanism. The v0 parsers check each reaction as they build it, so the v0 series includes the
+// build.
+static void BM_CheckReactionsSchema(benchmark::State& state)
+{
+  const auto n_reactions = static_cast<std::size_t>(state.range(0));
+  if (state.range(1) == 0)
+  {
+    const YAML::Node reactions = SyntheticV0Reactions(state);
+    for (auto _ : state)
+    {
+      auto errors = CheckV0ReactionsSchema(reactions);
+      if (!errors.empty())
+        state.SkipWithError(errors.front().second.c_str());
+      benchmark::DoNotOptimize(errors);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n_reactions));
+    return;
+  }
+  const YAML::Node object = SyntheticDocument(state);
+  const auto species = v1::ParseSpecies(object[v1::keys::species], nullptr);
+  const auto phases = v1::ParsePhases(object[v1::keys::phases], nullptr);
+  for (auto _ : state)
+  {
+    auto errors = v1::CheckReactionsSchema(object[v1::keys::reactions], species, phases);
+    if (!errors.empty())
+      state.SkipWithError(errors.front().second.c_str());
+    benchmark::DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n_reactions));
+}
+
+// The semantic validation of an already-built Mechanism, as a whole and by model.
+static void BM_Validate(benchmark::State& state)
+{
+  ValidateScaled(
+      state, "validate", bench::MixedMechanism(1200), Reactions, [](const Mechanism& m) { return Validate(m); });
+}
+
+static void BM_ValidateGasModel(benchmark::State& state)
+{
+  ValidateScaled(
+      state, "validate", bench::MixedMechanism(1200), Reactions, [](const Mechanism& m) { return ValidateGasModel(m); });
+}
+
+static void BM_ValidateAerosolModel(benchmark::State& state)
+{
+  const SyntheticOptions options{ .phases = 3, .aerosol_processes = 100 };
+  ValidateScaled(
+      state, "validate_aerosol", options, AerosolProcesses, [](const Mechanism& m) { return ValidateAerosolModel(m); });
+}
+
+static void BM_ValidateEmissionsModel(benchmark::State& state)
+{
+  const SyntheticOptions options{ .reactions = bench::EveryKind(12), .emission_sources = 100 };
+  ValidateScaled(
+      state, "validate_emissions", options, EmissionSources, [](const Mechanism& m) { return ValidateEmissionsModel(m); });
+}
+
+// A mechanism with an error in every reaction: Validate formats every message, while Diagnose
+// only records what each error is and leaves the formatting to whoever reads it.
+static void BM_ValidateUnknownSpecies(benchmark::State& state)
+{
+  const Mechanism mechanism = UnknownSpeciesMechanism(state);
+  for (auto _ : state)
+  {
+    auto errors = Validate(mechanism);
+    benchmark::DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Reactions(mechanism)));
+}
+
+static void BM_DiagnoseUnknownSpecies(benchmark::State& state)
+{
+  const Mechanism mechanism = UnknownSpeciesMechanism(state);
+  for (auto _ : state)
+  {
+    auto diagnostics = Diagnose(mechanism);
+    benchmark::DoNotOptimize(diagnostics);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Reactions(mechanism)));
+}
+
+BENCHMARK(BM_ValidateAndBuild_Fused)->Arg(100)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ValidateAndBuild_MultiPass)->Arg(100)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CheckReactionsSchema)
+    ->ArgsProduct({ { 100000 }, { 0, 1 } })
+    ->ArgNames({ "reactions", "version" })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Validate)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ValidateGasModel)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ValidateAerosolModel)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ValidateEmissionsModel)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ValidateUnknownSpecies)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DiagnoseUnknownSpecies)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMillisecond);
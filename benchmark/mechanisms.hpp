@@ -0,0 +1,64 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/synthetic.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+namespace mechanism_configuration::bench
+{
+  /// @brief `n_reactions` reactions spread evenly over every kind a version `version`
+  ///        configuration can hold, with any remainder going to Arrhenius reactions
+  inline SyntheticReactionCounts EveryKind(std::size_t n_reactions, int version = 1)
+  {
+    const std::size_t kinds = version == 0 ? 10 : 12;
+    const std::size_t each = n_reactions / kinds;
+    return { .arrhenius = each + n_reactions % kinds,
+             .branched = each,
+             .emission = each,
+             .first_order_loss = each,
+             .photolysis = each,
+             .surface = each,
+             .taylor_series = version == 0 ? 0 : each,
+             .troe = each,
+             .ternary_chemical_activation = each,
+             .tunneling = each,
+             .user_defined = each,
+             .lambda_rate_constant = version == 0 ? 0 : each };
+  }
+
+  /// @brief The benchmarks' synthetic mechanism: `n_reactions` reactions of every kind and, for
+  ///        version 1, one aerosol process (over a condensed phase) and one emission source per
+  ///        100 reactions
+  inline SyntheticOptions MixedMechanism(std::size_t n_reactions, int version = 1)
+  {
+    SyntheticOptions options{ .version = version, .reactions = EveryKind(n_reactions, version) };
+    if (version != 0)
+    {
+      options.phases = 2;
+      options.aerosol_processes = n_reactions / 100;
+      options.emission_sources = n_reactions / 100;
+    }
+    return options;
+  }
+
+  /// @brief Writes a synthetic mechanism into the directory `name` under the system temporary
+  ///        directory, replacing whatever was there
+  /// @return The path to parse
+  /// @throws std::runtime_error if the mechanism cannot be written
+  inline std::filesystem::path WriteMechanism(const std::string& name, const SyntheticOptions& options)
+  {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / ("mc_bench_" + name);
+    std::filesystem::remove_all(directory);
+    auto path = WriteSyntheticMechanism(options, directory);
+    if (!path)
+      throw std::runtime_error(path.error().front().second);
+    return *path;
+  }
+}  // namespace mechanism_configuration::bench
@@ -27,6 +27,22 @@ if(PROJECT_IS_TOP_LEVEL AND MECH_CONFIG_ENABLE_TESTS)
   FetchContent_MakeAvailable(googletest)
 endif()
 
+################################################################################
+# google benchmark
+
+if(PROJECT_IS_TOP_LEVEL AND MECH_CONFIG_ENABLE_BENCHMARKS)
+  FetchContent_Declare(googlebenchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_TAG v1.8.3
+    FIND_PACKAGE_ARGS NAMES benchmark
+  )
+
+  set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+  FetchContent_MakeAvailable(googlebenchmark)
+endif()
+
 ################################################################################
 # fmt
 
@@ -47,6 +63,11 @@ if(MECH_CONFIG_USE_FMT)
   endif()
 endif()
 
+################################################################################
+# threads (parallel file loading)
+
+find_package(Threads REQUIRED)
+
 ################################################################################
 # yaml-cpp
 
@@ -0,0 +1,98 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/expression.hpp>
+#include <mechanism_configuration/types/aerosol.hpp>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  /// @brief Which rate constant of an aerosol process a row of AerosolRateConstantEngine output is
+  enum class AerosolRateConstantRole
+  {
+    Rate,     ///< DissolvedReaction::rate_constant
+    Forward,  ///< DissolvedReversibleReaction::forward_rate_constant
+    Reverse,  ///< DissolvedReversibleReaction::reverse_rate_constant
+  };
+
+  /// @brief The process a row of AerosolRateConstantEngine output belongs to
+  struct AerosolRateConstantSource
+  {
+    std::size_t process;  ///< Index in Aerosol::processes
+    AerosolRateConstantRole role;
+  };
+
+  /// @brief Evaluates every rate constant of the processes of an aerosol section for many grid
+  ///        cells at once. The rate constants are grouped by form (Arrhenius, equilibrium and
+  ///        expression), and each group is evaluated with a loop over cells.
+  ///
+  ///        Aerosol rate constants are functions of temperature alone, so the pressure term E of
+  ///        an Arrhenius rate constant is not applied.
+  ///
+  ///        Evaluation only reads the engine, so one engine may be shared between threads.
+  class AerosolRateConstantEngine
+  {
+   public:
+    AerosolRateConstantEngine() = default;
+    /// @throws std::invalid_argument if a rate expression does not compile or uses the pressure
+    explicit AerosolRateConstantEngine(const types::Aerosol& aerosol);
+
+    /// @return The process and role of each row of the output, in process order
+    std::span<const AerosolRateConstantSource> sources() const
+    {
+      return sources_;
+    }
+
+    /// @return The number of rate constants (rows of the output)
+    std::size_t size() const
+    {
+      return sources_.size();
+    }
+
+    /// @brief Computes the rate constants for `temperature.size()` cells
+    /// @param temperature Temperature of each cell [K]
+    /// @param rate_constants Output of size() × cells values: rate constant `i` (described by
+    ///        sources()[i]) in cell `c` is `rate_constants[i * cells + c]`
+    /// @throws std::invalid_argument if the array sizes do not match
+    void Evaluate(std::span<const double> temperature, std::span<double> rate_constants) const;
+
+   private:
+    // A exp(C/T) (T/D)^B, with ln D
+    struct ArrheniusRates
+    {
+      std::vector<std::size_t> row;
+      std::vector<double> A;
+      std::vector<double> B;
+      std::vector<double> C;
+      std::vector<double> log_D;
+    };
+
+    // A exp(C (1/T0 - 1/T))
+    struct EquilibriumRates
+    {
+      std::vector<std::size_t> row;
+      std::vector<double> A;
+      std::vector<double> C;
+      std::vector<double> inverse_T0;
+    };
+
+    struct ExpressionRates
+    {
+      std::vector<std::size_t> row;
+      std::vector<Expression> expression;
+    };
+
+    void Add(const types::RateConstant& rate_constant, AerosolRateConstantSource source);
+
+    std::vector<AerosolRateConstantSource> sources_;
+    ArrheniusRates arrhenius_;
+    EquilibriumRates equilibrium_;
+    ExpressionRates expressions_;
+  };
+}  // namespace mechanism_configuration
@@ -0,0 +1,29 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/errors.hpp>
+#include <mechanism_configuration/mechanism.hpp>
+
+#include <expected>
+#include <filesystem>
+
+namespace mechanism_configuration
+{
+  /// @brief Writes a mechanism to `path` as a compact, versioned binary image that LoadCompiled
+  ///        reads back without parsing any YAML/JSON. Every field of the Mechanism is kept,
+  ///        including reactions, aerosol and emissions. The file is replaced atomically, so
+  ///        concurrent readers see either the old image or the new one.
+  /// @param mechanism The mechanism to write
+  /// @param path Where to write the image
+  /// @return No errors on success; I/O failures are reported as UnexpectedError.
+  Errors SaveCompiled(const Mechanism& mechanism, const std::filesystem::path& path);
+
+  /// @brief Reads a mechanism written by SaveCompiled.
+  /// @param path Path of the image
+  /// @return The mechanism, or an error if the file is missing (FileNotFound), was written in
+  ///         another image format version (InvalidVersion), or is corrupt (UnexpectedError).
+  std::expected<Mechanism, Errors> LoadCompiled(const std::filesystem::path& path);
+}  // namespace mechanism_configuration
@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <limits>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -50,6 +54,7 @@ namespace mechanism_configuration
     FileNotFound,
     UnexpectedError,
     EmptyObject,
+    InvalidExpression,
     // Emissions-specific error codes
     DuplicateInventoryDetected,
     DuplicateSpeciesMapDetected,
@@ -66,4 +71,47 @@ namespace mechanism_configuration
   std::string ErrorCodeToString(const ErrorCode& status);
 
   using Errors = std::vector<std::pair<ErrorCode, std::string>>;
+
+  /// @brief One error as it was found: what went wrong, where, and the names and values its
+  ///        message mentions. The message is only put together when to_string is called, so
+  ///        code that acts on the code and position alone never pays for formatting it.
+  ///
+  ///        Only semantic validation (Diagnose, and the semantic stage of a v1 parse) records its
+  ///        errors this way. Schema checks and document loading still format each error as they
+  ///        find it, and the schema checks run once per reaction: a file with a bad key in each
+  ///        of its 100k reactions formats 100k messages before any are returned.
+  struct Diagnostic
+  {
+    static constexpr std::size_t MAX_ARGUMENTS = 4;
+    static constexpr std::size_t NO_FILE = std::numeric_limits<std::size_t>::max();
+
+    ErrorCode code{ ErrorCode::None };
+    /// @brief The message, with each `{}` standing for the next of `arguments`. Always a string
+    ///        literal, so it is never copied.
+    std::string_view message;
+    std::array<std::string, MAX_ARGUMENTS> arguments;
+    /// @brief Index of the file the error is in (see Diagnostics::files), or NO_FILE
+    std::size_t file{ NO_FILE };
+    /// @brief 1-based position of the error, or 0 when it has none (e.g. in an in-code Mechanism)
+    int line{ 0 };
+    int column{ 0 };
+
+    /// @brief The message as Errors would hold it: `path:line:column ` (each part when known)
+    ///        followed by the message with its arguments filled in
+    /// @param file_path The path of `file`; ignored when `file` is NO_FILE
+    std::string to_string(std::string_view file_path = {}) const;
+  };
+
+  /// @brief A list of Diagnostics and the files they refer to.
+  struct Diagnostics
+  {
+    std::vector<std::string> files;
+    std::vector<Diagnostic> entries;
+
+    /// @brief The formatted message of one of `entries`
+    std::string to_string(const Diagnostic& diagnostic) const;
+
+    /// @brief Every entry formatted, in order: the same Errors the string-based API returns
+    Errors ToErrors() const;
+  };
 }  // namespace mechanism_configuration
\ No newline at end of file
@@ -0,0 +1,98 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  /// @brief Where and why an expression failed to compile. `line` and `column` are 0-based
+  ///        positions in the source text.
+  struct ExpressionError
+  {
+    std::string message;
+    std::size_t line{ 0 };
+    std::size_t column{ 0 };
+  };
+
+  /// @brief A rate-constant expression of temperature and pressure, compiled to bytecode, as
+  ///        used by the `lambda function` of a lambda rate constant reaction.
+  ///
+  ///        The source is either a C++-style lambda, `[](double T, double P) { return ...; }`,
+  ///        whose first parameter is the temperature [K] and optional second parameter the
+  ///        pressure [Pa], or a bare expression of `T` and `P`. Expressions use numbers, the
+  ///        operators + - * / and parentheses, and the functions exp, log, log10, sqrt, abs
+  ///        (or fabs), pow, min and max, optionally prefixed with `std::`. Constant
+  ///        subexpressions are folded when compiling.
+  class Expression
+  {
+   public:
+    /// @brief Parses and compiles `source`
+    /// @return The expression, or the first syntax error found
+    static std::expected<Expression, ExpressionError> Compile(std::string_view source);
+
+    /// @return The value at one temperature [K] and pressure [Pa]
+    double Evaluate(double temperature, double pressure) const;
+
+    /// @brief Evaluates the expression for every cell
+    /// @param temperature Temperature of each cell [K]
+    /// @param pressure Pressure of each cell [Pa]; may be empty if !UsesPressure()
+    /// @param values Output, one value per cell
+    /// @throws std::invalid_argument if the array sizes do not match
+    void Evaluate(std::span<const double> temperature, std::span<const double> pressure, std::span<double> values) const;
+
+    /// @return Whether the value depends on the pressure
+    bool UsesPressure() const
+    {
+      return uses_pressure_;
+    }
+
+    /// @return Whether the value depends on neither temperature nor pressure
+    bool IsConstant() const
+    {
+      return code_.size() == 1 && code_.front().op == Op::Constant;
+    }
+
+   private:
+    enum class Op : std::uint8_t
+    {
+      Constant,
+      Temperature,
+      Pressure,
+      Negate,
+      Add,
+      Subtract,
+      Multiply,
+      Divide,
+      Exp,
+      Log,
+      Log10,
+      Sqrt,
+      Abs,
+      Pow,
+      Min,
+      Max,
+    };
+
+    struct Instruction
+    {
+      Op op;
+      double value{ 0.0 };
+    };
+
+    friend class ExpressionCompiler;
+
+    // Postfix code for a stack machine
+    std::vector<Instruction> code_;
+    std::size_t stack_depth_{ 0 };
+    bool uses_pressure_{ false };
+  };
+}  // namespace mechanism_configuration
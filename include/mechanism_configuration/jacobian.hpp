@@ -0,0 +1,75 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/stoichiometry.hpp>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  /// @brief The nonzero positions of a square sparse matrix, by rows: row `i` has entries in the
+  ///        columns `indices[offsets[i], offsets[i + 1])`, in increasing order
+  struct SparsityPattern
+  {
+    std::vector<std::size_t> offsets{ 0 };
+    std::vector<std::size_t> indices;
+
+    /// @return The number of rows
+    std::size_t rows() const
+    {
+      return offsets.size() - 1;
+    }
+
+    /// @return The number of nonzero entries
+    std::size_t size() const
+    {
+      return indices.size();
+    }
+  };
+
+  /// @brief Ways OrderSpecies can reorder the species
+  enum class SpeciesOrdering
+  {
+    /// @brief Greedy minimum degree: eliminates the species with the fewest neighbours first,
+    ///        which keeps the LU fill small
+    MinimumDegree,
+    /// @brief Reverse Cuthill–McKee: minimizes the bandwidth
+    ReverseCuthillMcKee,
+  };
+
+  /// @brief Computes the sparsity pattern of the Jacobian of the species rates of change: entry
+  ///        (i, j) exists when some reaction consumes species j and changes the amount of
+  ///        species i. The diagonal is always included, as solvers factor I - hJ.
+  /// @param stoichiometry The result of BuildStoichiometry
+  /// @return A species × species pattern
+  SparsityPattern BuildJacobianSparsity(const Stoichiometry& stoichiometry);
+
+  /// @brief Finds an order of the species that makes the LU factors of `jacobian` sparse. Only
+  ///        the symmetric structure (A + Aᵀ) is considered.
+  /// @param jacobian The pattern from BuildJacobianSparsity
+  /// @param ordering The method to use
+  /// @return The new order: entry `k` is the species placed at position `k`. It can be stored
+  ///         in Mechanism::species_order.
+  std::vector<std::size_t> OrderSpecies(
+      const SparsityPattern& jacobian,
+      SpeciesOrdering ordering = SpeciesOrdering::MinimumDegree);
+
+  /// @brief Renumbers the rows and columns of `pattern`
+  /// @param pattern A square pattern
+  /// @param order Entry `k` is the old index of new row (column) `k`
+  /// @return The permuted pattern
+  SparsityPattern PermutePattern(const SparsityPattern& pattern, std::span<const std::size_t> order);
+
+  /// @brief Computes the combined pattern of the L and U factors of `pattern` after reordering
+  ///        it by `order`, assuming no pivoting. Entries that are not in the permuted pattern are
+  ///        the fill-in.
+  /// @param pattern A square pattern with its diagonal, such as the one from BuildJacobianSparsity
+  /// @param order Entry `k` is the old index of new row (column) `k`, as from OrderSpecies
+  /// @return The pattern of L + U in the new numbering
+  SparsityPattern SymbolicLU(const SparsityPattern& pattern, std::span<const std::size_t> order);
+}  // namespace mechanism_configuration
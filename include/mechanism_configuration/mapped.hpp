@@ -0,0 +1,630 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/errors.hpp>
+#include <mechanism_configuration/mechanism.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace mechanism_configuration
+{
+  namespace mapped
+  {
+    // ----------------------------------------
+    // Image records
+    // ----------------------------------------
+    //
+    // A mapped image is a header followed by flat arrays of these fixed-size records. Strings,
+    // components and rate parameters are referred to by their offset into the image's string,
+    // component and parameter arrays, so the image is read in place and never copied to the heap.
+
+    struct StringRecord
+    {
+      std::uint32_t offset;  ///< Byte offset into the string array
+      std::uint32_t size;
+    };
+
+    struct RangeRecord
+    {
+      std::uint32_t begin;  ///< Index of the first element
+      std::uint32_t count;
+    };
+
+    struct ComponentRecord
+    {
+      StringRecord name;
+      std::uint32_t species;  ///< Index into the species array, or NO_SPECIES
+      std::uint32_t reserved;
+      double coefficient;
+    };
+
+    struct ReactionRecord
+    {
+      StringRecord name;
+      StringRecord gas_phase;
+      StringRecord text;          ///< Surface: condensed phase; LambdaRateConstant: lambda function
+      RangeRecord parameters;     ///< Rate parameters, in the order of the types:: struct fields
+      RangeRecord components[3];  ///< Reactants (or the single reactant), products, then alkoxy products
+    };
+
+    /// @brief Species index of a component whose species is not in the mechanism's species list
+    inline constexpr std::uint32_t NO_SPECIES = 0xffffffff;
+
+    /// @brief The arrays of a mapped image that views read from
+    struct ImageArrays
+    {
+      const char* strings{ nullptr };
+      const ComponentRecord* components{ nullptr };
+      const double* parameters{ nullptr };
+
+      std::string_view String(const StringRecord& s) const
+      {
+        return std::string_view(strings + s.offset, s.size);
+      }
+    };
+
+    /// @brief A read-only sequence of views over consecutive records, mirroring the std::vector
+    ///        of the corresponding types:: member.
+    template<typename View>
+    class Range
+    {
+     public:
+      using Record = typename View::Record;
+
+      class iterator
+      {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = View;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = View;
+
+        iterator() = default;
+        iterator(const ImageArrays* arrays, const Record* record)
+            : arrays_(arrays),
+              record_(record)
+        {
+        }
+
+        View operator*() const
+        {
+          return View(arrays_, record_);
+        }
+        iterator& operator++()
+        {
+          ++record_;
+          return *this;
+        }
+        iterator operator++(int)
+        {
+          iterator previous = *this;
+          ++record_;
+          return previous;
+        }
+        bool operator==(const iterator& other) const
+        {
+          return record_ == other.record_;
+        }
+
+       private:
+        const ImageArrays* arrays_{ nullptr };
+        const Record* record_{ nullptr };
+      };
+
+      Range() = default;
+      Range(const ImageArrays* arrays, const Record* first, std::size_t size)
+          : arrays_(arrays),
+            first_(first),
+            size_(size)
+      {
+      }
+
+      iterator begin() const
+      {
+        return iterator(arrays_, first_);
+      }
+      iterator end() const
+      {
+        return iterator(arrays_, first_ + size_);
+      }
+      std::size_t size() const
+      {
+        return size_;
+      }
+      bool empty() const
+      {
+        return size_ == 0;
+      }
+      View operator[](std::size_t i) const
+      {
+        return View(arrays_, first_ + i);
+      }
+
+     private:
+      const ImageArrays* arrays_{ nullptr };
+      const Record* first_{ nullptr };
+      std::size_t size_{ 0 };
+    };
+
+    class Species
+    {
+     public:
+      using Record = StringRecord;
+      Species(const ImageArrays* arrays, const Record* record)
+          : arrays_(arrays),
+            record_(record)
+      {
+      }
+
+      std::string_view name() const
+      {
+        return arrays_->String(*record_);
+      }
+
+     private:
+      const ImageArrays* arrays_;
+      const Record* record_;
+    };
+
+    class ReactionComponent
+    {
+     public:
+      using Record = ComponentRecord;
+      ReactionComponent(const ImageArrays* arrays, const Record* record)
+          : arrays_(arrays),
+            record_(record)
+      {
+      }
+
+      std::string_view name() const
+      {
+        return arrays_->String(record_->name);
+      }
+      /// @brief Index of the species in MappedMechanism::species(), or NO_SPECIES
+      std::uint32_t species_index() const
+      {
+        return record_->species;
+      }
+      double coefficient() const
+      {
+        return record_->coefficient;
+      }
+
+     private:
+      const ImageArrays* arrays_;
+      const Record* record_;
+    };
+
+    /// @brief What every reaction view has in common; the per-type views below add named
+    ///        accessors for their rate parameters and components.
+    class Reaction
+    {
+     public:
+      using Record = ReactionRecord;
+      Reaction(const ImageArrays* arrays, const Record* record)
+          : arrays_(arrays),
+            record_(record)
+      {
+      }
+
+      std::string_view name() const
+      {
+        return arrays_->String(record_->name);
+      }
+      std::string_view gas_phase() const
+      {
+        return arrays_->String(record_->gas_phase);
+      }
+      /// @brief The rate parameters, in the order of the corresponding types:: struct's fields
+      std::span<const double> parameters() const
+      {
+        return std::span<const double>(arrays_->parameters + record_->parameters.begin, record_->parameters.count);
+      }
+
+     protected:
+      double Parameter(std::size_t i) const
+      {
+        return arrays_->parameters[record_->parameters.begin + i];
+      }
+      Range<ReactionComponent> Components(std::size_t group) const
+      {
+        const RangeRecord& range = record_->components[group];
+        return Range<ReactionComponent>(arrays_, arrays_->components + range.begin, range.count);
+      }
+      ReactionComponent Component(std::size_t group) const
+      {
+        return ReactionComponent(arrays_, arrays_->components + record_->components[group].begin);
+      }
+      std::string_view Text() const
+      {
+        return arrays_->String(record_->text);
+      }
+
+     private:
+      const ImageArrays* arrays_;
+      const Record* record_;
+    };
+
+    class Arrhenius : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double A() const
+      {
+        return Parameter(0);
+      }
+      double B() const
+      {
+        return Parameter(1);
+      }
+      double C() const
+      {
+        return Parameter(2);
+      }
+      double D() const
+      {
+        return Parameter(3);
+      }
+      double E() const
+      {
+        return Parameter(4);
+      }
+      Range<ReactionComponent> reactants() const
+      {
+        return Components(0);
+      }
+      Range<ReactionComponent> products() const
+      {
+        return Components(1);
+      }
+    };
+
+    class Branched : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double X() const
+      {
+        return Parameter(0);
+      }
+      double Y() const
+      {
+        return Parameter(1);
+      }
+      double a0() const
+      {
+        return Parameter(2);
+      }
+      int n() const
+      {
+        return static_cast<int>(Parameter(3));
+      }
+      Range<ReactionComponent> reactants() const
+      {
+        return Components(0);
+      }
+      Range<ReactionComponent> nitrate_products() const
+      {
+        return Components(1);
+      }
+      Range<ReactionComponent> alkoxy_products() const
+      {
+        return Components(2);
+      }
+    };
+
+    class Emission : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double scaling_factor() const
+      {
+        return Parameter(0);
+      }
+      Range<ReactionComponent> products() const
+      {
+        return Components(1);
+      }
+    };
+
+    class FirstOrderLoss : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double scaling_factor() const
+      {
+        return Parameter(0);
+      }
+      ReactionComponent reactants() const
+      {
+        return Component(0);
+      }
+      Range<ReactionComponent> products() const
+      {
+        return Components(1);
+      }
+    };
+
+    class Photolysis : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double scaling_factor() const
+      {
+        return Parameter(0);
+      }
+      ReactionComponent reactants() const
+      {
+        return Component(0);
+      }
+      Range<ReactionComponent> products() const
+      {
+        return Components(1);
+      }
+    };
+
+    class Surface : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double reaction_probability() const
+      {
+        return Parameter(0);
+      }
+      ReactionComponent gas_phase_species() const
+      {
+        return Component(0);
+      }
+      Range<ReactionComponent> gas_phase_products() const
+      {
+        return Components(1);
+      }
+      std::string_view condensed_phase() const
+      {
+        return Text();
+      }
+    };
+
+    class TaylorSeries : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double A() const
+      {
+        return Parameter(0);
+      }
+      double B() const
+      {
+        return Parameter(1);
+      }
+      double C() const
+      {
+        return Parameter(2);
+      }
+      double D() const
+      {
+        return Parameter(3);
+      }
+      double E() const
+      {
+        return Parameter(4);
+      }
+      std::span<const double> taylor_coefficients() const
+      {
+        return parameters().subspan(5);
+      }
+      Range<ReactionComponent> reactants() const
+      {
+        return Components(0);
+      }
+      Range<ReactionComponent> products() const
+      {
+        return Components(1);
+      }
+    };
+
+    class Troe : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double k0_A() const
+      {
+        return Parameter(0);
+      }
+      double k0_B() const
+      {
+        return Parameter(1);
+      }
+      double k0_C() const
+      {
+        return Parameter(2);
+      }
+      double kinf_A() const
+      {
+        return Parameter(3);
+      }
+      double kinf_B() const
+      {
+        return Parameter(4);
+      }
+      double kinf_C() const
+      {
+        return Parameter(5);
+      }
+      double Fc() const
+      {
+        return Parameter(6);
+      }
+      double N() const
+      {
+        return Parameter(7);
+      }
+      Range<ReactionComponent> reactants() const
+      {
+        return Components(0);
+      }
+      Range<ReactionComponent> products() const
+      {
+        return Components(1);
+      }
+    };
+
+    class TernaryChemicalActivation : public Troe
+    {
+     public:
+      using Troe::Troe;
+    };
+
+    class Tunneling : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double A() const
+      {
+        return Parameter(0);
+      }
+      double B() const
+      {
+        return Parameter(1);
+      }
+      double C() const
+      {
+        return Parameter(2);
+      }
+      Range<ReactionComponent> reactants() const
+      {
+        return Components(0);
+      }
+      Range<ReactionComponent> products() const
+      {
+        return Components(1);
+      }
+    };
+
+    class UserDefined : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      double scaling_factor() const
+      {
+        return Parameter(0);
+      }
+      Range<ReactionComponent> reactants() const
+      {
+        return Components(0);
+      }
+      Range<ReactionComponent> products() const
+      {
+        return Components(1);
+      }
+    };
+
+    class LambdaRateConstant : public Reaction
+    {
+     public:
+      using Reaction::Reaction;
+      std::string_view lambda_function() const
+      {
+        return Text();
+      }
+      Range<ReactionComponent> reactants() const
+      {
+        return Components(0);
+      }
+      Range<ReactionComponent> products() const
+      {
+        return Components(1);
+      }
+    };
+
+    /// @brief The reactions of a mapped image, with one range per types::Reactions vector
+    struct Reactions
+    {
+      Range<Arrhenius> arrhenius;
+      Range<Branched> branched;
+      Range<Emission> emission;
+      Range<FirstOrderLoss> first_order_loss;
+      Range<Photolysis> photolysis;
+      Range<Surface> surface;
+      Range<TaylorSeries> taylor_series;
+      Range<Troe> troe;
+      Range<TernaryChemicalActivation> ternary_chemical_activation;
+      Range<Tunneling> tunneling;
+      Range<UserDefined> user_defined;
+      Range<LambdaRateConstant> lambda_rate_constant;
+    };
+  }  // namespace mapped
+
+  /// @brief A read-only view of a mechanism image written by SaveMappedImage. The file is
+  ///        memory-mapped and read in place: species names, stoichiometry and rate parameters are
+  ///        never copied to the heap, and the operating system shares the mapped pages between
+  ///        every process that opens the same image (e.g. all the MPI ranks on a node).
+  ///
+  ///        Copies share the mapping, which is released when the last copy is destroyed. Views
+  ///        and string_views obtained from a MappedMechanism are valid while any copy is alive.
+  ///        Only the gas-phase mechanism is imaged; use SaveCompiled/LoadCompiled to keep the
+  ///        aerosol, emissions and unknown properties as well.
+  class MappedMechanism
+  {
+   public:
+    /// @brief Maps an image and checks that every offset in it is in bounds.
+    /// @param path Path of the image
+    /// @return The view, or an error if the file is missing (FileNotFound), was written in another
+    ///         image format version (InvalidVersion), or is corrupt (UnexpectedError)
+    static std::expected<MappedMechanism, Errors> Open(const std::filesystem::path& path);
+
+    std::string_view name() const
+    {
+      return name_;
+    }
+    const Version& version() const
+    {
+      return version_;
+    }
+    double relative_tolerance() const
+    {
+      return relative_tolerance_;
+    }
+    const mapped::Range<mapped::Species>& species() const
+    {
+      return species_;
+    }
+    const mapped::Reactions& reactions() const
+    {
+      return reactions_;
+    }
+
+   private:
+    struct Mapping;
+
+    MappedMechanism() = default;
+
+    std::shared_ptr<const Mapping> mapping_;
+    std::string_view name_;
+    Version version_;
+    double relative_tolerance_{ 0 };
+    mapped::Range<mapped::Species> species_;
+    mapped::Reactions reactions_;
+  };
+
+  /// @brief Writes the gas-phase part of a mechanism (name, version, relative tolerance, species
+  ///        names and every reaction) as an image that MappedMechanism::Open reads in place.
+  ///        Strings are stored once however many reactions refer to them. The file is replaced
+  ///        atomically.
+  /// @param mechanism The mechanism to write
+  /// @param path Where to write the image
+  /// @return No errors on success; I/O failures and mechanisms too large for the image's 32-bit
+  ///         offsets are reported as UnexpectedError
+  Errors SaveMappedImage(const Mechanism& mechanism, const std::filesystem::path& path);
+}  // namespace mechanism_configuration
@@ -9,7 +9,10 @@
 #include <mechanism_configuration/types/emissions.hpp>
 #include <mechanism_configuration/types/reactions.hpp>
 #include <mechanism_configuration/types/species.hpp>
+#include <mechanism_configuration/types/symbols.hpp>
+#include <mechanism_configuration/types/unknown_properties.hpp>
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -40,5 +43,25 @@ namespace mechanism_configuration
     std::optional<types::Aerosol> aerosol;
     /// @brief Emissions configuration (optional)
     std::optional<types::EmissionsConfig> emissions;
+    /// @brief Interned species and phase names. Together with the `*_index` members of the
+    ///        reactions, phases and aerosol entries, this lets a solver address species and phases
+    ///        by index instead of looking their names up. Filled in by AssignIndices.
+    types::Symbols symbols;
+    /// @brief Unknown properties of the species, phases, reactions, reaction components and
+    ///        emission sources, looked up by their `unknown_properties_id`
+    ///        (e.g. `mechanism.unknown_properties.Of(mechanism.species[0])`). Empty when parsed
+    ///        with ParseOptions::collect_unknown_properties unset.
+    types::UnknownProperties unknown_properties;
+    /// @brief The order in which a solver should number the species (optional), e.g. a
+    ///        fill-reducing order from OrderSpecies. Entry `k` is the index in `species` of the
+    ///        species placed at position `k`. Not part of the configuration formats.
+    std::optional<std::vector<std::size_t>> species_order;
   };
+
+  /// @brief Interns the species and phase names into `mechanism.symbols` and sets every
+  ///        species and phase index in the mechanism (reaction components, reaction phases, phase
+  ///        species, aerosol representations, processes and constraints) from the corresponding
+  ///        name. Names that match no species or phase get types::NO_INDEX. Parsing does this
+  ///        already; call it again after adding or renaming species, phases or reactions.
+  void AssignIndices(Mechanism& mechanism);
 }  // namespace mechanism_configuration
\ No newline at end of file
@@ -4,12 +4,25 @@
 
 #pragma once
 
+#include <mechanism_configuration/aerosol_rate_constants.hpp>
+#include <mechanism_configuration/compiled.hpp>
 #include <mechanism_configuration/errors.hpp>
+#include <mechanism_configuration/expression.hpp>
+#include <mechanism_configuration/jacobian.hpp>
+#include <mechanism_configuration/mapped.hpp>
 #include <mechanism_configuration/mechanism.hpp>
 #include <mechanism_configuration/parse.hpp>
+#include <mechanism_configuration/parse_stats.hpp>
+#include <mechanism_configuration/rate_constants.hpp>
+#include <mechanism_configuration/rate_parameters.hpp>
+#include <mechanism_configuration/reaction_order.hpp>
+#include <mechanism_configuration/stoichiometry.hpp>
+#include <mechanism_configuration/synthetic.hpp>
 #include <mechanism_configuration/types/aerosol.hpp>
 #include <mechanism_configuration/types/emissions.hpp>
 #include <mechanism_configuration/types/reactions.hpp>
 #include <mechanism_configuration/types/species.hpp>
+#include <mechanism_configuration/types/symbols.hpp>
+#include <mechanism_configuration/types/unknown_properties.hpp>
 #include <mechanism_configuration/validate.hpp>
 #include <mechanism_configuration/version.hpp>
@@ -6,17 +6,80 @@
 
 #include <mechanism_configuration/errors.hpp>
 #include <mechanism_configuration/mechanism.hpp>
+#include <mechanism_configuration/parse_stats.hpp>
+#include <mechanism_configuration/validate.hpp>
 
 #include <expected>
 #include <filesystem>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace mechanism_configuration
 {
+  /// @brief Options controlling how a configuration is read. The defaults parse the whole
+  ///        document tree at once.
+  struct ParseOptions
+  {
+    /// @brief Check and build v1 reactions one at a time as they are streamed out of the text,
+    ///        instead of loading every reaction into the document tree first. Peak memory then
+    ///        scales with the largest reaction rather than the whole reactions section, which
+    ///        matters for mechanisms with tens of thousands of reactions. The result and any
+    ///        errors are the same either way; documents that cannot be streamed (e.g. ones using
+    ///        YAML anchors and aliases) are parsed as a whole. Has no effect on v0 configurations.
+    bool stream_reactions{ false };
+
+    /// @brief Read the files a configuration lists (`files:` in v1 file-list sections, and the
+    ///        v0 `camp-files`) concurrently rather than one after another. Files are still merged
+    ///        in the order they are listed, so the result and any errors (including their order)
+    ///        are the same either way. Worth enabling when a mechanism is split into many files,
+    ///        particularly on a parallel filesystem. Has no effect on inline v1 sections.
+    bool parallel_file_loading{ false };
+
+    /// @brief Keep the properties the format does not define (v1 keys starting with `__`, and
+    ///        extra v0 species keys) in Mechanism::unknown_properties. Unset this when nothing
+    ///        reads them to skip collecting them; every `unknown_properties_id` is then
+    ///        types::NO_PROPERTIES. Parse never writes a cache image (see `cache_path`) for a
+    ///        mechanism parsed without them, so cached images always carry them.
+    bool collect_unknown_properties{ true };
+
+    /// @brief When set, Parse(config_path) first looks for a compiled image of the mechanism at
+    ///        this path (see SaveCompiled) and returns it without reading any YAML/JSON if it was
+    ///        made from the same configuration and every file it was read from (including each
+    ///        `files:` entry and v0 CAMP file) still has the same contents. Otherwise the
+    ///        configuration is parsed as usual and, if it parses, the image is (re)written for next
+    ///        time. Failing to write the cache is not an error. Has no effect on ParseFromString.
+    std::filesystem::path cache_path;
+
+    /// @brief When set, receives the wall time, size and peak memory of each stage of the parse
+    ///        (reading, loading, schema checks, semantic checks, building; see ParseStage) as it
+    ///        ends, per file where the configuration spans several. When null nothing is measured.
+    ///        Not owned; it must outlive the parse. A cached mechanism (see `cache_path`) is
+    ///        returned without any stages.
+    ParseObserver* observer{ nullptr };
+
+    /// @brief How many errors to look for before giving up (see ValidationOptions). With a limit,
+    ///        the first errors are the same as without one, and the v1 checks stop once it is
+    ///        reached instead of formatting errors that would be dropped.
+    ValidationOptions validation;
+  };
+
   /// @brief Parse a mechanism configuration file, dispatching on its version.
   /// @param config_path Path to a configuration file (a std::string converts implicitly),
   ///        or a directory of version-0 CAMP files.
+  /// @param options How the configuration is read
   /// @return The parsed Mechanism, or all structural and semantic errors encountered.
-  std::expected<Mechanism, Errors> Parse(const std::filesystem::path& config_path);
-  std::expected<Mechanism, Errors> ParseFromString(const std::string& config);
-}  // namespace mechanism_configuration
\ No newline at end of file
+  std::expected<Mechanism, Errors> Parse(const std::filesystem::path& config_path, const ParseOptions& options = {});
+  std::expected<Mechanism, Errors> ParseFromString(const std::string& config, const ParseOptions& options = {});
+
+  /// @brief Parse several mechanism configurations at once, each on its own thread (up to one
+  ///        per hardware thread). Each configuration is parsed exactly as Parse(path, options)
+  ///        would parse it, and a failure in one does not affect the others. Parse, ParseFromString
+  ///        and ParseMany may themselves be called from any number of threads at the same time.
+  /// @param config_paths Paths to the configuration files (or v0 CAMP directories)
+  /// @param options How every configuration is read. The configurations share any `cache_path`,
+  ///        so each would overwrite the others' image; to cache each, call Parse with its own.
+  /// @return One result per path, in the order of `config_paths`
+  std::vector<std::expected<Mechanism, Errors>>
+  ParseMany(std::span<const std::filesystem::path> config_paths, const ParseOptions& options = {});
+}  // namespace mechanism_configuration
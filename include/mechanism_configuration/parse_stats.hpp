@@ -0,0 +1,76 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  /// @brief A stage of parsing, as reported to a ParseObserver
+  enum class ParseStage
+  {
+    ReadFile,           ///< Reading a file from disk
+    LoadDocument,       ///< Parsing YAML/JSON text into a document tree
+    StreamReactions,    ///< Streaming v1 reactions out of text, checking and building each one
+    ResolveFiles,       ///< Reading and merging the files of v1 `files:` sections
+    CheckSchema,        ///< Checking the structure of a v1 document, and building its reactions
+    ValidateSemantics,  ///< Checking a v1 document's references between species, phases and reactions
+    Build,              ///< Building the Mechanism from a checked v1 document, or from one v0 CAMP file
+  };
+
+  std::string ParseStageToString(ParseStage stage);
+
+  /// @brief What one stage of a parse did
+  struct ParseStageStats
+  {
+    ParseStage stage;
+    /// @brief The file the stage worked on; for a stage over the whole configuration, the configuration
+    ///        file. Empty for ParseFromString.
+    std::filesystem::path file;
+    std::chrono::nanoseconds wall_time{ 0 };
+    /// @brief The bytes of text read from disk (ReadFile), parsed (LoadDocument) or streamed (StreamReactions)
+    std::size_t bytes{ 0 };
+    /// @brief The document nodes loaded (LoadDocument) or worked on; StreamReactions counts reactions
+    std::size_t nodes{ 0 };
+    /// @brief The process's peak resident memory when the stage ended, or 0 where it cannot be read. A
+    ///        stage that raised the peak shows up as an increase over the stage before it.
+    std::size_t peak_memory_bytes{ 0 };
+  };
+
+  /// @brief Receives the stats of each stage of a parse, when set as ParseOptions::observer.
+  class ParseObserver
+  {
+   public:
+    virtual ~ParseObserver() = default;
+
+    /// @brief Called as each stage ends; a stage may enclose others (e.g. ResolveFiles encloses the
+    ///        ReadFile and LoadDocument of each file), which are reported first. Called from several
+    ///        threads at once when files are loaded in parallel, or when one observer is shared by
+    ///        concurrent parses. Must not throw.
+    virtual void OnStage(const ParseStageStats& stats) = 0;
+  };
+
+  /// @brief A ParseObserver that keeps the stats of every stage, in the order they ended
+  class ParseStats : public ParseObserver
+  {
+   public:
+    void OnStage(const ParseStageStats& stats) override;
+
+    /// @brief The stages reported so far
+    std::vector<ParseStageStats> Stages() const;
+
+    /// @brief The summed wall time of every reported `stage`
+    std::chrono::nanoseconds WallTime(ParseStage stage) const;
+
+   private:
+    mutable std::mutex mutex_;
+    std::vector<ParseStageStats> stages_;
+  };
+}  // namespace mechanism_configuration
@@ -0,0 +1,182 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/expression.hpp>
+#include <mechanism_configuration/mechanism.hpp>
+#include <mechanism_configuration/rate_parameters.hpp>
+#include <mechanism_configuration/reaction_order.hpp>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  /// @brief How values are read from a rate table
+  enum class RateTableInterpolation
+  {
+    Linear,  ///< Bilinear, from the 2 × 2 surrounding entries
+    Cubic,   ///< Bicubic (Catmull-Rom), from the 4 × 4 surrounding entries
+  };
+
+  /// @brief Options for evaluating the Troe and ternary chemical activation rate constants from
+  ///        tables over temperature and air density, precomputed when the engine is built,
+  ///        instead of with the full fall-off formula.
+  ///
+  ///        Tables are uniform in 1/T and ln [M] and hold ln k, so the Arrhenius and low- and
+  ///        high-pressure limits of a rate are nearly linear in the table coordinates. Blocks of
+  ///        cells with any condition outside the table range, and reactions whose rate is not
+  ///        positive everywhere in it, are evaluated with the full formula.
+  struct RateTableOptions
+  {
+    bool enabled{ false };
+    RateTableInterpolation interpolation{ RateTableInterpolation::Linear };
+    double min_temperature{ 180.0 };   ///< [K]
+    double max_temperature{ 330.0 };   ///< [K]
+    double min_air_density{ 1.0e-3 };  ///< [mol m-3]
+    double max_air_density{ 1.0e2 };   ///< [mol m-3]
+    /// @brief Table points along each axis; 0 selects the default set at build time with
+    ///        MECH_CONFIG_RATE_TABLE_TEMPERATURE_POINTS / MECH_CONFIG_RATE_TABLE_AIR_DENSITY_POINTS
+    std::size_t temperature_points{ 0 };
+    std::size_t air_density_points{ 0 };
+  };
+
+  /// @brief The accuracy of one reaction's rate table
+  struct RateTableError
+  {
+    /// @brief The reaction's position in ReactionOrder
+    std::size_t reaction;
+    /// @brief The largest relative difference from the full formula at the centers of the
+    ///        table cells, where interpolation is least accurate
+    double max_relative_error;
+  };
+
+  /// @brief Options for building a RateConstantEngine
+  struct RateConstantOptions
+  {
+    /// @brief Evaluate each Arrhenius, Troe, ternary chemical activation and tunneling reaction
+    ///        with a kernel specialized for the terms of its rate expression that are active
+    ///        (e.g. B = 0, E = 0 or Fc = 1 drop their terms, and a rate with none is stored
+    ///        once per cell block). When unset, every reaction uses the full formula.
+    bool specialize_kernels{ true };
+    /// @brief Tabulation of the fall-off reactions; off by default
+    RateTableOptions tables{};
+  };
+
+  /// @brief Evaluates the rate constants of the Arrhenius, branched, Taylor series, Troe,
+  ///        ternary chemical activation, tunneling and lambda reactions of a mechanism for many
+  ///        grid cells at once, using the formulas of the configuration documentation. The
+  ///        reactions are grouped by type and each group is evaluated with a loop over cells,
+  ///        so the compiler can vectorize it.
+  ///
+  ///        Evaluation only reads the engine, so one engine may be shared between threads.
+  class RateConstantEngine
+  {
+   public:
+    RateConstantEngine() = default;
+    /// @throws std::invalid_argument if a lambda function does not compile or the table options
+    ///         are invalid
+    explicit RateConstantEngine(const Mechanism& mechanism, const RateConstantOptions& options = {});
+
+    /// @return The position of each reaction type's reactions in the output
+    const ReactionOrder& order() const
+    {
+      return order_;
+    }
+
+    /// @return The accuracy of each tabulated reaction's table; empty unless tables are enabled
+    std::span<const RateTableError> table_errors() const
+    {
+      return table_errors_;
+    }
+
+    /// @brief Computes the rate constants for `temperature.size()` cells
+    /// @param temperature Temperature of each cell [K]
+    /// @param pressure Pressure of each cell [Pa]
+    /// @param air_density Number density of air in each cell [mol m-3]
+    /// @param rate_constants Output of order().size × cells values: the rate constant of
+    ///        reaction `r` (in ReactionOrder) in cell `c` is `rate_constants[r * cells + c]`.
+    ///        Rows of reactions whose rate is supplied by the host model (emission, first order
+    ///        loss, photolysis, surface and user defined reactions) are left unchanged.
+    ///        A branched reaction gets the sum of its nitrate and alkoxy rate constants; see
+    ///        EvaluateNitrateFractions for the split.
+    /// @throws std::invalid_argument if the array sizes do not match
+    void Evaluate(
+        std::span<const double> temperature,
+        std::span<const double> pressure,
+        std::span<const double> air_density,
+        std::span<double> rate_constants) const;
+
+    /// @brief Computes the fraction of each branched reaction that follows the nitrate branch
+    /// @param temperature Temperature of each cell [K]
+    /// @param air_density Number density of air in each cell [mol m-3]
+    /// @param fractions Output of `reactions.branched.size()` × cells values, laid out like the
+    ///        rate constants of Evaluate; the alkoxy fraction is one minus the nitrate fraction
+    /// @throws std::invalid_argument if the array sizes do not match
+    void EvaluateNitrateFractions(
+        std::span<const double> temperature,
+        std::span<const double> air_density,
+        std::span<double> fractions) const;
+
+   private:
+    struct Branched
+    {
+      std::vector<double> X;
+      std::vector<double> Y;
+      // 2e-22 e^n converted to mol m-3
+      std::vector<double> k0;
+      // Z(a0, n) of the branching ratio
+      std::vector<double> Z;
+    };
+
+    // Indices into the RateParameters arrays, grouped by the kernel that evaluates them; the
+    // group of a reaction is the set of its active terms (see rate_constants.cpp).
+    using KernelGroups = std::array<std::vector<std::size_t>, 8>;
+
+    // ln k of the tabulated fall-off reactions on a grid uniform in 1/T and ln [M]
+    struct RateTables
+    {
+      RateTableInterpolation interpolation{ RateTableInterpolation::Linear };
+      std::size_t temperature_points{ 0 };
+      std::size_t air_density_points{ 0 };
+      double inverse_temperature_origin{ 0.0 };
+      double inverse_temperature_step{ 0.0 };
+      double log_air_density_origin{ 0.0 };
+      double log_air_density_step{ 0.0 };
+      // Output row of each table
+      std::vector<std::size_t> rows;
+      // Table t, entry (i, j) (i along 1/T) is log_rate[(t * temperature_points + i) * air_density_points + j]
+      std::vector<double> log_rate;
+
+      std::size_t size() const
+      {
+        return temperature_points * air_density_points;
+      }
+    };
+
+    // Tabulates the fall-off reactions and moves them to the *_tabulated_kernels_ groups
+    void BuildTables(const RateTableOptions& options);
+
+    ReactionOrder order_;
+    RateParameters parameters_;
+    // ln D of the Arrhenius and Taylor series reactions, so (T/D)^B = exp(B (ln T - ln D))
+    std::vector<double> arrhenius_log_D_;
+    std::vector<double> taylor_series_log_D_;
+    Branched branched_;
+    KernelGroups arrhenius_kernels_;
+    // Reactions that are tabulated are in the *_tabulated_kernels_ groups instead, which are
+    // evaluated only for blocks outside the table range.
+    KernelGroups troe_kernels_;
+    KernelGroups ternary_chemical_activation_kernels_;
+    KernelGroups troe_tabulated_kernels_;
+    KernelGroups ternary_chemical_activation_tabulated_kernels_;
+    RateTables tables_;
+    std::vector<RateTableError> table_errors_;
+    KernelGroups tunneling_kernels_;
+    std::vector<Expression> lambdas_;
+  };
+}  // namespace mechanism_configuration
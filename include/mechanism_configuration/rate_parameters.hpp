@@ -0,0 +1,131 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/mechanism.hpp>
+#include <mechanism_configuration/reaction_order.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace mechanism_configuration
+{
+  /// @brief Alignment in bytes of every array exported by ExportRateParameters, enough for
+  ///        aligned AVX-512 loads
+  inline constexpr std::size_t RATE_PARAMETER_ALIGNMENT = 64;
+
+  /// @brief Parameters of the Arrhenius reactions, one array per field of types::Arrhenius
+  struct ArrheniusParameters
+  {
+    std::span<const double> A;
+    std::span<const double> B;
+    std::span<const double> C;
+    std::span<const double> D;
+    std::span<const double> E;
+    /// @brief Position of each reaction in the ReactionOrder of the mechanism
+    std::span<const std::size_t> reaction_index;
+
+    std::size_t size() const
+    {
+      return reaction_index.size();
+    }
+  };
+
+  /// @brief Parameters of the Taylor series reactions, one array per field of types::TaylorSeries
+  struct TaylorSeriesParameters
+  {
+    std::span<const double> A;
+    std::span<const double> B;
+    std::span<const double> C;
+    std::span<const double> D;
+    std::span<const double> E;
+    /// @brief The coefficients of every reaction, back to back. Those of reaction `i` are
+    ///        `taylor_coefficients[taylor_coefficient_offsets[i], taylor_coefficient_offsets[i + 1])`.
+    std::span<const double> taylor_coefficients;
+    /// @brief size() + 1 offsets into taylor_coefficients
+    std::span<const std::size_t> taylor_coefficient_offsets;
+    /// @brief Position of each reaction in the ReactionOrder of the mechanism
+    std::span<const std::size_t> reaction_index;
+
+    std::size_t size() const
+    {
+      return reaction_index.size();
+    }
+  };
+
+  /// @brief Parameters of the Troe or ternary chemical activation reactions, one array per field
+  ///        of types::Troe / types::TernaryChemicalActivation
+  struct FalloffParameters
+  {
+    std::span<const double> k0_A;
+    std::span<const double> k0_B;
+    std::span<const double> k0_C;
+    std::span<const double> kinf_A;
+    std::span<const double> kinf_B;
+    std::span<const double> kinf_C;
+    std::span<const double> Fc;
+    std::span<const double> N;
+    /// @brief Position of each reaction in the ReactionOrder of the mechanism
+    std::span<const std::size_t> reaction_index;
+
+    std::size_t size() const
+    {
+      return reaction_index.size();
+    }
+  };
+
+  /// @brief Parameters of the tunneling reactions, one array per field of types::Tunneling
+  struct TunnelingParameters
+  {
+    std::span<const double> A;
+    std::span<const double> B;
+    std::span<const double> C;
+    /// @brief Position of each reaction in the ReactionOrder of the mechanism
+    std::span<const std::size_t> reaction_index;
+
+    std::size_t size() const
+    {
+      return reaction_index.size();
+    }
+  };
+
+  /// @brief The rate parameters of the Arrhenius-family reactions of a mechanism as a structure
+  ///        of arrays. Element `i` of every array of a group belongs to reaction `i` of the
+  ///        matching types::Reactions list. All arrays live in one block owned by this object;
+  ///        each starts on a RATE_PARAMETER_ALIGNMENT boundary and is zero-padded up to the next
+  ///        one, so a kernel may load whole vectors past its last element.
+  class RateParameters
+  {
+   public:
+    ArrheniusParameters arrhenius;
+    TaylorSeriesParameters taylor_series;
+    FalloffParameters troe;
+    FalloffParameters ternary_chemical_activation;
+    TunnelingParameters tunneling;
+
+    RateParameters() = default;
+    RateParameters(RateParameters&&) = default;
+    RateParameters& operator=(RateParameters&&) = default;
+    // The arrays point into storage_, so a copy would share it.
+    RateParameters(const RateParameters&) = delete;
+    RateParameters& operator=(const RateParameters&) = delete;
+
+   private:
+    friend RateParameters ExportRateParameters(const Mechanism& mechanism);
+
+    struct AlignedDelete
+    {
+      void operator()(std::byte* storage) const;
+    };
+    std::unique_ptr<std::byte, AlignedDelete> storage_;
+  };
+
+  /// @brief Copies the rate parameters of the Arrhenius, Taylor series, Troe, ternary chemical
+  ///        activation and tunneling reactions of `mechanism` into a RateParameters block
+  /// @param mechanism The mechanism to export
+  /// @return The exported parameters; they do not refer to `mechanism`
+  RateParameters ExportRateParameters(const Mechanism& mechanism);
+}  // namespace mechanism_configuration
@@ -0,0 +1,38 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/types/reactions.hpp>
+
+#include <cstddef>
+
+namespace mechanism_configuration
+{
+  /// @brief The mechanism-wide order of reactions used by the solver-facing exports
+  ///        (ExportRateParameters, ...): every reaction type in the order of the types::Reactions
+  ///        members, and the reactions of each type in list order. Each member is the position of
+  ///        the first reaction of that type, so reaction `i` of `reactions.troe` is reaction
+  ///        `order.troe + i`.
+  struct ReactionOrder
+  {
+    std::size_t arrhenius{ 0 };
+    std::size_t branched{ 0 };
+    std::size_t emission{ 0 };
+    std::size_t first_order_loss{ 0 };
+    std::size_t photolysis{ 0 };
+    std::size_t surface{ 0 };
+    std::size_t taylor_series{ 0 };
+    std::size_t troe{ 0 };
+    std::size_t ternary_chemical_activation{ 0 };
+    std::size_t tunneling{ 0 };
+    std::size_t user_defined{ 0 };
+    std::size_t lambda_rate_constant{ 0 };
+    /// @brief Total number of reactions
+    std::size_t size{ 0 };
+
+    ReactionOrder() = default;
+    explicit ReactionOrder(const types::Reactions& reactions);
+  };
+}  // namespace mechanism_configuration
@@ -0,0 +1,77 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/errors.hpp>
+#include <mechanism_configuration/mechanism.hpp>
+#include <mechanism_configuration/reaction_order.hpp>
+
+#include <cstddef>
+#include <expected>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  /// @brief A sparse matrix in compressed form. Read by rows (CSR), entry `k` of row `i` for
+  ///        `k` in `[offsets[i], offsets[i + 1])` is `values[k]` at column `indices[k]`; read by
+  ///        columns (CSC), the roles of rows and columns swap. Indices within a row (column) are
+  ///        in increasing order.
+  struct CompressedMatrix
+  {
+    std::vector<std::size_t> offsets{ 0 };
+    std::vector<std::size_t> indices;
+    std::vector<double> values;
+
+    /// @return The number of stored entries
+    std::size_t size() const
+    {
+      return values.size();
+    }
+  };
+
+  /// @brief One species × reactions matrix in both compressed forms
+  struct StoichiometryMatrix
+  {
+    /// @brief Rows are species (Mechanism::species order), columns are reactions
+    CompressedMatrix by_species;
+    /// @brief Columns are reactions (ReactionOrder), rows are species
+    CompressedMatrix by_reaction;
+  };
+
+  /// @brief The stoichiometry of the gas-phase reactions of a mechanism
+  struct Stoichiometry
+  {
+    /// @brief Number of species (rows)
+    std::size_t species{ 0 };
+    /// @brief The reaction of each column
+    ReactionOrder order;
+    /// @brief Reactant coefficients, every entry positive
+    StoichiometryMatrix reactants;
+    /// @brief Product minus reactant coefficients. Species whose production and consumption in a
+    ///        reaction cancel have no entry. A branched reaction's column holds only its reactants.
+    StoichiometryMatrix net;
+    /// @brief Nitrate-branch product coefficients, one column per entry of `reactions.branched`
+    StoichiometryMatrix nitrate_products;
+    /// @brief Alkoxy-branch product coefficients, one column per entry of `reactions.branched`
+    StoichiometryMatrix alkoxy_products;
+  };
+
+  /// @brief Builds the reactant and net stoichiometry matrices of all reactions in
+  ///        `mechanism.reactions`, with one column per reaction in ReactionOrder. Coefficients of
+  ///        a species that appears more than once in a reaction are summed. A surface reaction
+  ///        consumes its gas-phase species. Runs in time linear in the number of species and
+  ///        reaction components.
+  ///
+  ///        The rate constant of a branched reaction is the sum of its two branch rates, so its
+  ///        products are kept apart from `net`: with `k` the rate constant of branched reaction
+  ///        `i` and `f` its nitrate fraction (RateConstantEngine::EvaluateNitrateFractions), the
+  ///        reaction changes the species by `k` times column `order.branched + i` of `net`, plus
+  ///        `f k` times column `i` of `nitrate_products`, plus `(1 - f) k` times column `i` of
+  ///        `alkoxy_products`.
+  /// @param mechanism A mechanism whose species indices are assigned (see AssignIndices)
+  /// @return The matrices, or ReactionRequiresUnknownSpecies for each component that has no
+  ///         species index
+  std::expected<Stoichiometry, Errors> BuildStoichiometry(const Mechanism& mechanism);
+}  // namespace mechanism_configuration
@@ -0,0 +1,90 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/errors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+
+namespace mechanism_configuration
+{
+  /// @brief The text format of a synthetic configuration
+  enum class SyntheticFormat
+  {
+    Yaml,
+    Json,
+  };
+
+  /// @brief The number of gas-phase reactions of each types::Reactions kind in a synthetic mechanism
+  struct SyntheticReactionCounts
+  {
+    std::size_t arrhenius{ 0 };
+    std::size_t branched{ 0 };
+    std::size_t emission{ 0 };
+    std::size_t first_order_loss{ 0 };
+    std::size_t photolysis{ 0 };
+    std::size_t surface{ 0 };
+    std::size_t taylor_series{ 0 };
+    std::size_t troe{ 0 };
+    std::size_t ternary_chemical_activation{ 0 };
+    std::size_t tunneling{ 0 };
+    std::size_t user_defined{ 0 };
+    std::size_t lambda_rate_constant{ 0 };
+
+    /// @brief The number of reactions of every kind
+    std::size_t Total() const;
+  };
+
+  /// @brief Describes a synthetic mechanism for WriteSyntheticMechanism
+  struct SyntheticOptions
+  {
+    /// @brief The major version of the configuration: 0 (CAMP) or 1
+    int version{ 1 };
+
+    SyntheticFormat format{ SyntheticFormat::Yaml };
+
+    /// @brief When 0, the whole mechanism is written inline in one configuration. Otherwise the
+    ///        reactions (and v1 aerosol processes) are split evenly across this many files, with
+    ///        the species and phases in files of their own: a v1.1 `files:` layout, or v0
+    ///        `camp-files`.
+    std::size_t files{ 0 };
+
+    /// @brief Every value in the mechanism is drawn from this seed, so the same options always
+    ///        write the same bytes. The species, reactions and other entries do not depend on the
+    ///        format or file layout.
+    std::uint64_t seed{ 0 };
+
+    /// @brief The number of species, at least 2
+    std::size_t species{ 50 };
+
+    /// @brief The number of phases, including the gas phase. Every condensed phase holds every
+    ///        species, plus a water solvent. Version 0 configurations have only the gas phase.
+    std::size_t phases{ 1 };
+
+    SyntheticReactionCounts reactions;
+
+    /// @brief The number of aerosol processes (v1 only), alternating between dissolved and
+    ///        reversible dissolved reactions spread over the condensed phases. Each condensed phase
+    ///        gets a uniform-section aerosol representation. Requires at least 2 phases.
+    std::size_t aerosol_processes{ 0 };
+
+    /// @brief The number of emission sources (v1 only), each with its own (category, hierarchy)
+    std::size_t emission_sources{ 0 };
+  };
+
+  /// @brief Writes a valid, randomly generated mechanism configuration, for measuring how parsing
+  ///        scales with the size of a mechanism. The configuration is streamed to disk as it is
+  ///        generated, so it may be far larger than memory.
+  /// @param options What to generate
+  /// @param directory The directory to write the configuration files into; it is created if needed
+  /// @return The path to pass to Parse, or errors if the options cannot be written as the
+  ///         requested version (InvalidVersion), are otherwise invalid (InvalidKey) or a file
+  ///         cannot be written (UnexpectedError)
+  std::expected<std::filesystem::path, Errors>
+  WriteSyntheticMechanism(const SyntheticOptions& options, const std::filesystem::path& directory);
+}  // namespace mechanism_configuration
@@ -6,7 +6,7 @@
 
 #include <mechanism_configuration/types/reactions.hpp>
 
-#include <functional>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <variant>
@@ -36,8 +36,17 @@ namespace mechanism_configuration::types
     double T0 = 298.15;  ///< Reference temperature [K]
   };
 
+  /// @brief A rate constant given as an expression of the temperature T [K], in the language of
+  ///        Expression, e.g. "2.5e3 * exp(-1500.0 / T)" or "[](double T) { return 2.5e3 * T; }"
+  struct RateExpression
+  {
+    std::string expression;
+
+    bool operator==(const RateExpression&) const = default;
+  };
+
   /// @brief A reaction rate constant parsed from config.
-  using RateConstant = std::variant<Arrhenius, Equilibrium, std::function<double(double)>>;
+  using RateConstant = std::variant<Arrhenius, Equilibrium, RateExpression>;
 
   // ----------------------------------------
   // Representations
@@ -47,6 +56,7 @@ namespace mechanism_configuration::types
   {
     std::string name;
     std::vector<std::string> phases;
+    std::vector<std::size_t> phase_indices;  ///< Indices of `phases` in Mechanism::phases
     double min_radius;  ///< [m]
     double max_radius;  ///< [m]
   };
@@ -55,6 +65,7 @@ namespace mechanism_configuration::types
   {
     std::string name;
     std::vector<std::string> phases;
+    std::vector<std::size_t> phase_indices;  ///< Indices of `phases` in Mechanism::phases
     double geometric_mean_radius;         ///< [m]
     double geometric_standard_deviation;  ///< dimensionless
   };
@@ -63,6 +74,7 @@ namespace mechanism_configuration::types
   {
     std::string name;
     std::vector<std::string> phases;
+    std::vector<std::size_t> phase_indices;  ///< Indices of `phases` in Mechanism::phases
     double geometric_standard_deviation;  ///< dimensionless
   };
 
@@ -76,6 +88,8 @@ namespace mechanism_configuration::types
   {
     std::string phase;
     std::string solvent;
+    std::size_t phase_index{ NO_INDEX };    ///< Index of phase in Mechanism::phases
+    std::size_t solvent_index{ NO_INDEX };  ///< Index of solvent in Mechanism::species
     std::vector<ReactionComponent> reactants;
     std::vector<ReactionComponent> products;
     RateConstant rate_constant;
@@ -87,6 +101,8 @@ namespace mechanism_configuration::types
   {
     std::string phase;
     std::string solvent;
+    std::size_t phase_index{ NO_INDEX };    ///< Index of phase in Mechanism::phases
+    std::size_t solvent_index{ NO_INDEX };  ///< Index of solvent in Mechanism::species
     std::vector<ReactionComponent> reactants;
     std::vector<ReactionComponent> products;
     /// @brief Supply exactly two of {forward, reverse, equilibrium}; the third is derived.
@@ -104,6 +120,11 @@ namespace mechanism_configuration::types
     std::string condensed_phase;
     std::string condensed_species;
     std::string solvent;
+    std::size_t gas_phase_index{ NO_INDEX };          ///< Index of gas_phase in Mechanism::phases
+    std::size_t gas_species_index{ NO_INDEX };        ///< Index of gas_species in Mechanism::species
+    std::size_t condensed_phase_index{ NO_INDEX };    ///< Index of condensed_phase in Mechanism::phases
+    std::size_t condensed_species_index{ NO_INDEX };  ///< Index of condensed_species in Mechanism::species
+    std::size_t solvent_index{ NO_INDEX };            ///< Index of solvent in Mechanism::species
     HenrysLawConstant henrys_law_constant;
     double diffusion_coefficient;      ///< Gas-phase diffusion coefficient [m2 s-1]
     double accommodation_coefficient;  ///< Mass accommodation coefficient, dimensionless
@@ -122,6 +143,11 @@ namespace mechanism_configuration::types
     std::string condensed_phase;
     std::string condensed_species;
     std::string solvent;
+    std::size_t gas_phase_index{ NO_INDEX };          ///< Index of gas_phase in Mechanism::phases
+    std::size_t gas_species_index{ NO_INDEX };        ///< Index of gas_species in Mechanism::species
+    std::size_t condensed_phase_index{ NO_INDEX };    ///< Index of condensed_phase in Mechanism::phases
+    std::size_t condensed_species_index{ NO_INDEX };  ///< Index of condensed_species in Mechanism::species
+    std::size_t solvent_index{ NO_INDEX };            ///< Index of solvent in Mechanism::species
     HenrysLawConstant henrys_law_constant;
     double solvent_molecular_weight;  ///< [kg mol-1]
     double solvent_density;           ///< [kg m-3]
@@ -132,6 +158,9 @@ namespace mechanism_configuration::types
     std::string phase;
     std::string algebraic_species;
     std::string solvent;
+    std::size_t phase_index{ NO_INDEX };              ///< Index of phase in Mechanism::phases
+    std::size_t algebraic_species_index{ NO_INDEX };  ///< Index of algebraic_species in Mechanism::species
+    std::size_t solvent_index{ NO_INDEX };            ///< Index of solvent in Mechanism::species
     std::vector<ReactionComponent> reactants;
     std::vector<ReactionComponent> products;
     Equilibrium equilibrium_constant;
@@ -143,6 +172,8 @@ namespace mechanism_configuration::types
     std::string phase;
     std::string name;
     double coefficient;
+    std::size_t phase_index{ NO_INDEX };    ///< Index of phase in Mechanism::phases
+    std::size_t species_index{ NO_INDEX };  ///< Index of name in Mechanism::species
   };
 
   /// @brief RHS constant C of a LinearConstraint:  G = sum(coeff_i * [species_i]) - C = 0
@@ -159,6 +190,8 @@ namespace mechanism_configuration::types
   {
     std::string algebraic_phase;
     std::string algebraic_species;
+    std::size_t algebraic_phase_index{ NO_INDEX };    ///< Index of algebraic_phase in Mechanism::phases
+    std::size_t algebraic_species_index{ NO_INDEX };  ///< Index of algebraic_species in Mechanism::species
     std::vector<LinearConstraintTerm> terms;
     std::variant<FixedConstant, DiagnoseFromState> constant = FixedConstant{ 0.0 };
   };
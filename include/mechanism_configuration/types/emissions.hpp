@@ -4,8 +4,9 @@
 
 #pragma once
 
+#include <mechanism_configuration/types/unknown_properties.hpp>
+
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace mechanism_configuration::types
@@ -72,7 +73,8 @@ namespace mechanism_configuration::types
     int hierarchy{ 1 };
     double scaling_factor{ 1.0 };
     std::string sector;
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Entry of the source's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   enum class RegriddingType
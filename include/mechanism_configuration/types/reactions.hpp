@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <mechanism_configuration/types/symbols.hpp>
+#include <mechanism_configuration/types/unknown_properties.hpp>
+
+#include <cstddef>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace mechanism_configuration::types
@@ -15,8 +18,10 @@ namespace mechanism_configuration::types
   {
     std::string name;
     double coefficient{ 1.0 };
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of the species in Mechanism::species, assigned when the mechanism is parsed
+    std::size_t species_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct Arrhenius
@@ -40,8 +45,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct Branched
@@ -64,8 +71,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct Emission
@@ -78,8 +87,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct FirstOrderLoss
@@ -94,8 +105,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct Photolysis
@@ -110,8 +123,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct Surface
@@ -126,10 +141,14 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
     /// @brief An identifier for the condensed phase where this reaction occurs
     std::string condensed_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of condensed_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t condensed_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct TaylorSeries
@@ -155,8 +174,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct Troe
@@ -185,8 +206,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct TernaryChemicalActivation
@@ -215,8 +238,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct Tunneling
@@ -235,8 +260,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct UserDefined
@@ -251,8 +278,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct LambdaRateConstant
@@ -267,8 +296,10 @@ namespace mechanism_configuration::types
     std::string name;
     /// @brief An identifier indicating which gas phase this reaction takes place in
     std::string gas_phase;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Index of gas_phase in Mechanism::phases, assigned when the mechanism is parsed
+    std::size_t gas_phase_index{ NO_INDEX };
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   /// @brief Represents a collection of different reaction types
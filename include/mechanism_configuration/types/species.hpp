@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <mechanism_configuration/types/symbols.hpp>
+#include <mechanism_configuration/types/unknown_properties.hpp>
+
+#include <cstddef>
 #include <optional>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace mechanism_configuration::types
@@ -26,25 +29,27 @@ namespace mechanism_configuration::types
     std::optional<double> constant_concentration;
     std::optional<double> constant_mixing_ratio;
     std::optional<bool> is_third_body;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct PhaseSpecies
   {
     std::string name;
+    /// @brief Index of the species in Mechanism::species, assigned when the mechanism is parsed
+    std::size_t species_index{ NO_INDEX };
     std::optional<double> diffusion_coefficient;
     std::optional<double> density;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
   struct Phase
   {
     std::string name;
     std::vector<PhaseSpecies> species;
-    /// @brief Unknown properties, prefixed with two underscores (__)
-    std::unordered_map<std::string, std::string> unknown_properties;
+    /// @brief Entry of the object's unknown properties in Mechanism::unknown_properties
+    PropertiesId unknown_properties_id{ NO_PROPERTIES };
   };
 
 }  // namespace mechanism_configuration::types
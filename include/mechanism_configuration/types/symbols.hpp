@@ -0,0 +1,78 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace mechanism_configuration::types
+{
+  /// @brief Index of a name that does not refer to any species or phase of the mechanism
+  ///        (e.g. before indices are assigned, or in a mechanism that failed validation)
+  inline constexpr std::size_t NO_INDEX = std::numeric_limits<std::size_t>::max();
+
+  /// @brief Interned names, each with a dense index in the order they were first added. Each
+  ///        name is stored once; the lookup table refers to it.
+  class SymbolTable
+  {
+   public:
+    SymbolTable() = default;
+    SymbolTable(const SymbolTable& other);
+    SymbolTable& operator=(const SymbolTable& other);
+    SymbolTable(SymbolTable&&) = default;
+    SymbolTable& operator=(SymbolTable&&) = default;
+
+    /// @brief Adds a name if it is not already in the table
+    /// @return The name's index
+    std::size_t Intern(std::string_view name);
+
+    /// @brief Adds a name at the next index even if it is already in the table (lookups of a
+    ///        repeated name keep returning its first index), so that the table's indices can
+    ///        line up with a list that may hold duplicates
+    /// @return The new index
+    std::size_t Append(std::string_view name);
+
+    /// @return The index of `name`, or std::nullopt if it is not in the table
+    std::optional<std::size_t> Find(std::string_view name) const;
+
+    /// @return The index of `name`, or NO_INDEX if it is not in the table
+    std::size_t IndexOf(std::string_view name) const;
+
+    /// @return The name with the given index
+    const std::string& Name(std::size_t index) const
+    {
+      return names_[index];
+    }
+
+    std::size_t size() const
+    {
+      return names_.size();
+    }
+
+    void clear();
+
+   private:
+    // Rebuilds `indices_` from `names_`, e.g. after copying the names
+    void Reindex();
+
+    // A deque never moves its elements as it grows (nor when the table is moved), so the keys of
+    // `indices_` can view the names in place.
+    std::deque<std::string> names_;
+    std::unordered_map<std::string_view, std::size_t> indices_;
+  };
+
+  /// @brief The mechanism's species and phase names. Index i of `species` is
+  ///        Mechanism::species[i] and index i of `phases` is Mechanism::phases[i].
+  struct Symbols
+  {
+    SymbolTable species;
+    SymbolTable phases;
+  };
+}  // namespace mechanism_configuration::types
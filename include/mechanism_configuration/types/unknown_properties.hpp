@@ -0,0 +1,88 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mechanism_configuration::types
+{
+  /// @brief Identifies an object's entry in Mechanism::unknown_properties
+  using PropertiesId = std::uint32_t;
+
+  /// @brief The PropertiesId of an object that has no unknown properties
+  inline constexpr PropertiesId NO_PROPERTIES = std::numeric_limits<PropertiesId>::max();
+
+  /// @brief A property the configuration format does not define (in v1, a key prefixed with two
+  ///        underscores (__)), kept as text
+  struct UnknownProperty
+  {
+    std::string key;
+    std::string value;
+
+    bool operator==(const UnknownProperty&) const = default;
+  };
+
+  /// @brief The unknown properties of every object in a mechanism, stored in one table rather
+  ///        than on each object. Objects that have any refer to their entry by PropertiesId (their
+  ///        `unknown_properties_id`); the many that have none cost nothing beyond that id.
+  class UnknownProperties
+  {
+   public:
+    /// @brief Stores one object's properties
+    /// @return The id of the new entry, or NO_PROPERTIES if `properties` is empty
+    PropertiesId Add(std::vector<UnknownProperty> properties);
+
+    /// @brief Moves every entry of `other` to the end of this table
+    /// @return The offset to add to the ids of `other`'s entries to get their new ids
+    PropertiesId Append(UnknownProperties&& other);
+
+    /// @return The properties of entry `id`; empty for NO_PROPERTIES
+    std::span<const UnknownProperty> Get(PropertiesId id) const;
+
+    /// @return The value of property `key` in entry `id`, or std::nullopt if it has none
+    std::optional<std::string_view> Find(PropertiesId id, std::string_view key) const;
+
+    /// @return The unknown properties of a species, phase, reaction, reaction component or any
+    ///        other object with an `unknown_properties_id`
+    template<typename Object>
+      requires requires(const Object& object) { object.unknown_properties_id; }
+    std::span<const UnknownProperty> Of(const Object& object) const
+    {
+      return Get(object.unknown_properties_id);
+    }
+
+    /// @return The value of `object`'s property `key`, or std::nullopt if it has none
+    template<typename Object>
+      requires requires(const Object& object) { object.unknown_properties_id; }
+    std::optional<std::string_view> Find(const Object& object, std::string_view key) const
+    {
+      return Find(object.unknown_properties_id, key);
+    }
+
+    /// @return The number of entries (objects with at least one unknown property)
+    std::size_t size() const
+    {
+      return offsets_.size() - 1;
+    }
+
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    void clear();
+
+   private:
+    // Entry i is properties_[offsets_[i], offsets_[i + 1]).
+    std::vector<UnknownProperty> properties_;
+    std::vector<std::uint32_t> offsets_{ 0 };
+  };
+}  // namespace mechanism_configuration::types
@@ -7,27 +7,52 @@
 #include <mechanism_configuration/errors.hpp>
 #include <mechanism_configuration/mechanism.hpp>
 
+#include <cstddef>
+
 namespace mechanism_configuration
 {
+  /// @brief How many errors validation looks for. By default every error is collected; with a
+  ///        limit, validation stops checking as soon as the limit is reached, so a badly broken
+  ///        mechanism costs no more than the errors that will be reported.
+  struct ValidationOptions
+  {
+    /// @brief Return at most this many errors, or every error when 0
+    std::size_t max_errors{ 0 };
+
+    /// @brief Return only the first error, as when `max_errors` is 1
+    bool stop_on_first_error{ false };
+
+    /// @brief The most errors to return, or 0 for no limit
+    std::size_t ErrorLimit() const
+    {
+      return stop_on_first_error ? 1 : max_errors;
+    }
+  };
 
   /// @brief Validates a Mechanism's species, phases, and gas-phase reactions by
   ///        converting them to a location-free semantics::ReactionsInput and running
-  ///        ValidateReactionsSemantics.
-  Errors ValidateGasModel(const Mechanism& mechanism);
+  ///        ValidateReactionsSemantics, and checks that every lambda function compiles.
+  Errors ValidateGasModel(const Mechanism& mechanism, const ValidationOptions& options = {});
 
   /// @brief Validates aerosol cross-references against the mechanism's species and phases.
   ///        Checks phase/species references, representation-keyed rate-constant maps, and
-  ///        required definition-derived properties.
-  Errors ValidateAerosolModel(const Mechanism& mechanism);
+  ///        required definition-derived properties, and that every rate expression compiles.
+  Errors ValidateAerosolModel(const Mechanism& mechanism, const ValidationOptions& options = {});
 
   /// @brief Validates a Mechanism's emissions section by converting it to a location-free
   ///        semantics::EmissionsInput and running ValidateEmissionsSemantics. Returns no errors
   ///        if the mechanism has no emissions section.
-  Errors ValidateEmissionsModel(const Mechanism& mechanism);
+  Errors ValidateEmissionsModel(const Mechanism& mechanism, const ValidationOptions& options = {});
 
   /// @brief Validates the semantic invariants of a canonical Mechanism, regardless of whether it
   ///        was parsed or constructed in code. Combines ValidateGasModel, ValidateAerosolModel,
-  ///        and ValidateEmissionsModel, returning all validation errors.
-  Errors Validate(const Mechanism& mechanism);
+  ///        and ValidateEmissionsModel, returning all validation errors, or the first
+  ///        `options.ErrorLimit()` of them in the same order.
+  Errors Validate(const Mechanism& mechanism, const ValidationOptions& options = {});
+
+  /// @brief The errors Validate finds, as unformatted Diagnostics. None of their messages is put
+  ///        together until it is asked for, so a caller that only counts or filters the errors of a
+  ///        badly broken mechanism never formats them. `Diagnose(m).ToErrors() == Validate(m)`.
+  Diagnostics Diagnose(const Mechanism& mechanism, const ValidationOptions& options = {});
 
 }  // namespace mechanism_configuration
@@ -0,0 +1,113 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/aerosol_rate_constants.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <variant>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    // Cells are evaluated in blocks small enough for the per-cell terms to stay in L1.
+    constexpr std::size_t CELL_BLOCK = 256;
+  }  // namespace
+
+  AerosolRateConstantEngine::AerosolRateConstantEngine(const types::Aerosol& aerosol)
+  {
+    for (std::size_t i = 0; i < aerosol.processes.size(); ++i)
+    {
+      if (const auto* p = std::get_if<types::DissolvedReaction>(&aerosol.processes[i]))
+        Add(p->rate_constant, { i, AerosolRateConstantRole::Rate });
+      else if (const auto* p = std::get_if<types::DissolvedReversibleReaction>(&aerosol.processes[i]))
+      {
+        if (p->forward_rate_constant)
+          Add(*p->forward_rate_constant, { i, AerosolRateConstantRole::Forward });
+        if (p->reverse_rate_constant)
+          Add(*p->reverse_rate_constant, { i, AerosolRateConstantRole::Reverse });
+      }
+    }
+  }
+
+  void AerosolRateConstantEngine::Add(const types::RateConstant& rate_constant, AerosolRateConstantSource source)
+  {
+    const std::size_t row = sources_.size();
+    sources_.push_back(source);
+    if (const auto* k = std::get_if<types::Arrhenius>(&rate_constant))
+    {
+      arrhenius_.row.push_back(row);
+      arrhenius_.A.push_back(k->A);
+      arrhenius_.B.push_back(k->B);
+      arrhenius_.C.push_back(k->C);
+      arrhenius_.log_D.push_back(std::log(k->D));
+    }
+    else if (const auto* k = std::get_if<types::Equilibrium>(&rate_constant))
+    {
+      equilibrium_.row.push_back(row);
+      equilibrium_.A.push_back(k->A);
+      equilibrium_.C.push_back(k->C);
+      equilibrium_.inverse_T0.push_back(1.0 / k->T0);
+    }
+    else if (const auto* k = std::get_if<types::RateExpression>(&rate_constant))
+    {
+      auto expression = Expression::Compile(k->expression);
+      if (!expression)
+        throw std::invalid_argument(
+            "invalid rate constant expression '" + k->expression + "': " + expression.error().message);
+      if (expression->UsesPressure())
+        throw std::invalid_argument("rate constant expression '" + k->expression + "' uses the pressure");
+      expressions_.row.push_back(row);
+      expressions_.expression.push_back(std::move(*expression));
+    }
+  }
+
+  void AerosolRateConstantEngine::Evaluate(std::span<const double> temperature, std::span<double> rate_constants) const
+  {
+    const std::size_t cells = temperature.size();
+    if (rate_constants.size() != sources_.size() * cells)
+      throw std::invalid_argument("the output array must have one value per rate constant and cell");
+
+    std::array<double, CELL_BLOCK> inverse_T;
+    std::array<double, CELL_BLOCK> log_T;
+    for (std::size_t first = 0; first < cells; first += CELL_BLOCK)
+    {
+      const std::size_t size = std::min(CELL_BLOCK, cells - first);
+      for (std::size_t c = 0; c < size; ++c)
+      {
+        inverse_T[c] = 1.0 / temperature[first + c];
+        log_T[c] = std::log(temperature[first + c]);
+      }
+
+      for (std::size_t i = 0; i < arrhenius_.row.size(); ++i)
+      {
+        double* k = rate_constants.data() + arrhenius_.row[i] * cells + first;
+        const double A = arrhenius_.A[i];
+        const double B = arrhenius_.B[i];
+        const double C = arrhenius_.C[i];
+        const double log_D = arrhenius_.log_D[i];
+        for (std::size_t c = 0; c < size; ++c)
+          k[c] = A * std::exp(C * inverse_T[c] + B * (log_T[c] - log_D));
+      }
+
+      for (std::size_t i = 0; i < equilibrium_.row.size(); ++i)
+      {
+        double* k = rate_constants.data() + equilibrium_.row[i] * cells + first;
+        const double A = equilibrium_.A[i];
+        const double C = equilibrium_.C[i];
+        const double inverse_T0 = equilibrium_.inverse_T0[i];
+        for (std::size_t c = 0; c < size; ++c)
+          k[c] = A * std::exp(C * (inverse_T0 - inverse_T[c]));
+      }
+    }
+
+    // Expressions run their own block loop over the cells.
+    for (std::size_t i = 0; i < expressions_.row.size(); ++i)
+      expressions_.expression[i].Evaluate(temperature, {}, rate_constants.subspan(expressions_.row[i] * cells, cells));
+  }
+}  // namespace mechanism_configuration
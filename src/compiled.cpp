@@ -0,0 +1,882 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/compiled.hpp"
+
+#include "detail/error_format.hpp"
+#include "detail/stream.hpp"
+
+#include <mechanism_configuration/compiled.hpp>
+#include <mechanism_configuration/version.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    // Every image starts with IMAGE_MAGIC and then IMAGE_FORMAT_VERSION. Bump the format version
+    // whenever the layout of any serialized type changes, so older images are rejected rather
+    // than misread.
+    constexpr std::string_view IMAGE_MAGIC{ "MECHCFG\n", 8 };
+    constexpr std::uint64_t IMAGE_FORMAT_VERSION = 4;
+
+    // Thrown while reading an image that is truncated, corrupt or from another format version.
+    struct InvalidImage : std::runtime_error
+    {
+      using std::runtime_error::runtime_error;
+    };
+    struct UnsupportedFormatVersion : InvalidImage
+    {
+      using InvalidImage::InvalidImage;
+    };
+
+    // A fast, non-cryptographic 64-bit content hash (FNV-1a over 8-byte words), used to detect
+    // changed source files and corrupt images. The words are read little-endian, so an image
+    // hashes the same on every host; compilers turn the loop into a single load where they can.
+    std::uint64_t HashBytes(std::string_view bytes)
+    {
+      constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ull;
+      constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+      std::uint64_t hash = FNV_OFFSET ^ bytes.size();
+      std::size_t i = 0;
+      for (; i + 8 <= bytes.size(); i += 8)
+      {
+        std::uint64_t word = 0;
+        for (std::size_t b = 0; b < 8; ++b)
+          word |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[i + b])) << (8 * b);
+        hash = (hash ^ word) * FNV_PRIME;
+        hash ^= hash >> 32;
+      }
+      for (; i < bytes.size(); ++i)
+        hash = (hash ^ static_cast<unsigned char>(bytes[i])) * FNV_PRIME;
+      return hash;
+    }
+
+    // ----------------------------------------
+    // Field lists
+    // ----------------------------------------
+    //
+    // Each type's serialized layout is the order of the fields passed to the archive here; the
+    // same function reads and writes, so the two directions cannot drift apart. Every field of
+    // every type is listed: a field added to a type must be added here (and the format version
+    // bumped). The exceptions are the species and phase indices and Mechanism::symbols, which are
+    // derived from the names and rebuilt by AssignIndices when an image is read.
+
+    template<typename Archive>
+    void Serialize(Archive& ar, Version& v)
+    {
+      ar(v.major, v.minor, v.patch);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Species& s)
+    {
+      ar(s.name,
+         s.absolute_tolerance,
+         s.diffusion_coefficient,
+         s.molecular_weight,
+         s.henrys_law_constant_298,
+         s.henrys_law_constant_exponential_factor,
+         s.n_star,
+         s.density,
+         s.tracer_type,
+         s.constant_concentration,
+         s.constant_mixing_ratio,
+         s.is_third_body,
+         s.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::PhaseSpecies& s)
+    {
+      ar(s.name, s.diffusion_coefficient, s.density, s.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Phase& p)
+    {
+      ar(p.name, p.species, p.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::ReactionComponent& c)
+    {
+      ar(c.name, c.coefficient, c.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Arrhenius& r)
+    {
+      ar(r.A, r.B, r.C, r.D, r.E, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Branched& r)
+    {
+      ar(r.X,
+         r.Y,
+         r.a0,
+         r.n,
+         r.reactants,
+         r.nitrate_products,
+         r.alkoxy_products,
+         r.name,
+         r.gas_phase,
+         r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Emission& r)
+    {
+      ar(r.scaling_factor, r.products, r.name, r.gas_phase, r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::FirstOrderLoss& r)
+    {
+      ar(r.scaling_factor, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Photolysis& r)
+    {
+      ar(r.scaling_factor, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Surface& r)
+    {
+      ar(r.reaction_probability,
+         r.gas_phase_species,
+         r.gas_phase_products,
+         r.name,
+         r.gas_phase,
+         r.condensed_phase,
+         r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::TaylorSeries& r)
+    {
+      ar(r.A,
+         r.B,
+         r.C,
+         r.D,
+         r.E,
+         r.taylor_coefficients,
+         r.reactants,
+         r.products,
+         r.name,
+         r.gas_phase,
+         r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Troe& r)
+    {
+      ar(r.k0_A,
+         r.k0_B,
+         r.k0_C,
+         r.kinf_A,
+         r.kinf_B,
+         r.kinf_C,
+         r.Fc,
+         r.N,
+         r.reactants,
+         r.products,
+         r.name,
+         r.gas_phase,
+         r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::TernaryChemicalActivation& r)
+    {
+      ar(r.k0_A,
+         r.k0_B,
+         r.k0_C,
+         r.kinf_A,
+         r.kinf_B,
+         r.kinf_C,
+         r.Fc,
+         r.N,
+         r.reactants,
+         r.products,
+         r.name,
+         r.gas_phase,
+         r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Tunneling& r)
+    {
+      ar(r.A, r.B, r.C, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::UserDefined& r)
+    {
+      ar(r.scaling_factor, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::LambdaRateConstant& r)
+    {
+      ar(r.lambda_function, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Reactions& r)
+    {
+      ar(r.arrhenius,
+         r.branched,
+         r.emission,
+         r.first_order_loss,
+         r.photolysis,
+         r.surface,
+         r.taylor_series,
+         r.troe,
+         r.ternary_chemical_activation,
+         r.tunneling,
+         r.user_defined,
+         r.lambda_rate_constant);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Equilibrium& k)
+    {
+      ar(k.A, k.C, k.T0);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::RateExpression& k)
+    {
+      ar(k.expression);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::HenrysLawConstant& k)
+    {
+      ar(k.HLC_ref, k.C, k.T0);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::UniformSection& r)
+    {
+      ar(r.name, r.phases, r.min_radius, r.max_radius);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::SingleMomentMode& r)
+    {
+      ar(r.name, r.phases, r.geometric_mean_radius, r.geometric_standard_deviation);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::TwoMomentMode& r)
+    {
+      ar(r.name, r.phases, r.geometric_standard_deviation);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::DissolvedReaction& p)
+    {
+      ar(p.phase, p.solvent, p.reactants, p.products, p.rate_constant, p.solvent_floor_, p.min_halflife_);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::DissolvedReversibleReaction& p)
+    {
+      ar(p.phase,
+         p.solvent,
+         p.reactants,
+         p.products,
+         p.forward_rate_constant,
+         p.reverse_rate_constant,
+         p.equilibrium_constant,
+         p.solvent_floor_);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::HenrysLawPhaseTransfer& p)
+    {
+      ar(p.gas_phase,
+         p.gas_species,
+         p.condensed_phase,
+         p.condensed_species,
+         p.solvent,
+         p.henrys_law_constant,
+         p.diffusion_coefficient,
+         p.accommodation_coefficient);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::HenrysLawEquilibrium& c)
+    {
+      ar(c.gas_phase,
+         c.gas_species,
+         c.condensed_phase,
+         c.condensed_species,
+         c.solvent,
+         c.henrys_law_constant,
+         c.solvent_molecular_weight,
+         c.solvent_density);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::DissolvedEquilibrium& c)
+    {
+      ar(c.phase, c.algebraic_species, c.solvent, c.reactants, c.products, c.equilibrium_constant, c.solvent_floor_);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::LinearConstraintTerm& t)
+    {
+      ar(t.phase, t.name, t.coefficient);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::FixedConstant& c)
+    {
+      ar(c.value);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive&, types::DiagnoseFromState&)
+    {
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::LinearConstraint& c)
+    {
+      ar(c.algebraic_phase, c.algebraic_species, c.terms, c.constant);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Aerosol& a)
+    {
+      ar(a.representations, a.processes, a.constraints);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::SpeciesMapping& m)
+    {
+      ar(m.inventory_species, m.mechanism_species, m.scaling_factor);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::SpeciesMap& m)
+    {
+      ar(m.name, m.mappings);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Inventory& i)
+    {
+      ar(i.name, i.directory, i.file_pattern, i.convention);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::SourceDescriptor& s)
+    {
+      ar(s.name,
+         s.mode,
+         s.type,
+         s.inventory,
+         s.species_map,
+         s.temporal_interpolation,
+         s.vertical_injection,
+         s.category,
+         s.hierarchy,
+         s.scaling_factor,
+         s.sector,
+         s.unknown_properties_id);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::Regridding& r)
+    {
+      ar(r.type);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::EmissionsConfig& e)
+    {
+      ar(e.inventories, e.species_maps, e.regridding, e.sources);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, types::UnknownProperty& p)
+    {
+      ar(p.key, p.value);
+    }
+
+    template<typename Archive>
+    void Serialize(Archive& ar, Mechanism& m)
+    {
+      ar(m.name,
+         m.version,
+         m.relative_tolerance,
+         m.species,
+         m.phases,
+         m.reactions,
+         m.aerosol,
+         m.emissions,
+         m.unknown_properties,
+         m.species_order);
+    }
+
+    // ----------------------------------------
+    // Archives
+    // ----------------------------------------
+    //
+    // Integers (and sizes, enums and variant indices) are LEB128 varints, signed ones zigzag
+    // encoded; doubles are their IEEE-754 bits in little-endian order; strings are a length and
+    // the bytes. The encoding does not depend on the host's endianness.
+
+    template<typename T>
+    struct IsVector : std::false_type
+    {
+    };
+    template<typename T>
+    struct IsVector<std::vector<T>> : std::true_type
+    {
+    };
+    template<typename T>
+    struct IsOptional : std::false_type
+    {
+    };
+    template<typename T>
+    struct IsOptional<std::optional<T>> : std::true_type
+    {
+    };
+    template<typename T>
+    struct IsVariant : std::false_type
+    {
+    };
+    template<typename... T>
+    struct IsVariant<std::variant<T...>> : std::true_type
+    {
+    };
+
+    static_assert(std::numeric_limits<double>::is_iec559, "images store doubles as IEEE-754 bits");
+
+    class ImageWriter
+    {
+     public:
+      template<typename... T>
+      void operator()(const T&... values)
+      {
+        (Field(values), ...);
+      }
+
+      void Unsigned(std::uint64_t value)
+      {
+        while (value >= 0x80)
+        {
+          bytes_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+          value >>= 7;
+        }
+        bytes_.push_back(static_cast<char>(value));
+      }
+
+      void Signed(std::int64_t value)
+      {
+        Unsigned((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+      }
+
+      void Raw(std::string_view bytes)
+      {
+        bytes_.append(bytes);
+      }
+
+      std::string& Bytes()
+      {
+        return bytes_;
+      }
+
+      template<typename T>
+      void Field(const T& value)
+      {
+        if constexpr (std::is_same_v<T, bool>)
+          Unsigned(value ? 1 : 0);
+        else if constexpr (std::is_enum_v<T> || std::is_integral_v<T>)
+          Signed(static_cast<std::int64_t>(value));
+        else if constexpr (std::is_same_v<T, double>)
+        {
+          const auto bits = std::bit_cast<std::uint64_t>(value);
+          for (int shift = 0; shift < 64; shift += 8)
+            bytes_.push_back(static_cast<char>((bits >> shift) & 0xff));
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+        {
+          Unsigned(value.size());
+          bytes_.append(value);
+        }
+        else if constexpr (IsVector<T>::value)
+        {
+          Unsigned(value.size());
+          for (const auto& element : value)
+            Field(element);
+        }
+        else if constexpr (IsOptional<T>::value)
+        {
+          Field(value.has_value());
+          if (value)
+            Field(*value);
+        }
+        else if constexpr (std::is_same_v<T, types::UnknownProperties>)
+        {
+          // The entries in id order, each a list of properties.
+          Unsigned(value.size());
+          for (std::size_t id = 0; id < value.size(); ++id)
+          {
+            const auto properties = value.Get(static_cast<types::PropertiesId>(id));
+            Unsigned(properties.size());
+            for (const auto& property : properties)
+              Field(property);
+          }
+        }
+        else if constexpr (IsVariant<T>::value)
+        {
+          Unsigned(value.index());
+          std::visit([this](const auto& alternative) { Field(alternative); }, value);
+        }
+        else
+          Serialize(*this, const_cast<T&>(value));  // Serialize only reads through a writer
+      }
+
+     private:
+      std::string bytes_;
+    };
+
+    class ImageReader
+    {
+     public:
+      explicit ImageReader(std::string_view bytes)
+          : pos_(bytes.data()),
+            end_(bytes.data() + bytes.size())
+      {
+      }
+
+      template<typename... T>
+      void operator()(T&... values)
+      {
+        (Field(values), ...);
+      }
+
+      std::uint64_t Unsigned()
+      {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+          const auto byte = static_cast<unsigned char>(Take(1)[0]);
+          value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+          if ((byte & 0x80) == 0)
+            return value;
+        }
+        throw InvalidImage("malformed integer");
+      }
+
+      std::int64_t Signed()
+      {
+        const std::uint64_t value = Unsigned();
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+      }
+
+      // A count of elements that follow. Every element takes at least one byte, so a count
+      // larger than what is left is corrupt (and must not drive a huge allocation).
+      std::size_t Size()
+      {
+        const std::uint64_t size = Unsigned();
+        if (size > static_cast<std::uint64_t>(end_ - pos_))
+          throw InvalidImage("truncated image");
+        return static_cast<std::size_t>(size);
+      }
+
+      std::string_view Take(std::size_t size)
+      {
+        if (size > static_cast<std::size_t>(end_ - pos_))
+          throw InvalidImage("truncated image");
+        std::string_view bytes(pos_, size);
+        pos_ += size;
+        return bytes;
+      }
+
+      std::string_view Rest() const
+      {
+        return std::string_view(pos_, static_cast<std::size_t>(end_ - pos_));
+      }
+
+      template<typename T>
+      void Field(T& value)
+      {
+        if constexpr (std::is_same_v<T, bool>)
+          value = Unsigned() != 0;
+        else if constexpr (std::is_enum_v<T> || std::is_integral_v<T>)
+          value = static_cast<T>(Signed());
+        else if constexpr (std::is_same_v<T, double>)
+        {
+          const std::string_view bytes = Take(8);
+          std::uint64_t bits = 0;
+          for (int i = 0; i < 8; ++i)
+            bits |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+          value = std::bit_cast<double>(bits);
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+          value.assign(Take(Size()));
+        else if constexpr (IsVector<T>::value)
+        {
+          value.clear();
+          value.resize(Size());
+          for (auto& element : value)
+            Field(element);
+        }
+        else if constexpr (IsOptional<T>::value)
+        {
+          bool present = false;
+          Field(present);
+          if (present)
+            Field(value.emplace());
+          else
+            value.reset();
+        }
+        else if constexpr (std::is_same_v<T, types::UnknownProperties>)
+        {
+          value.clear();
+          const std::size_t size = Size();
+          for (std::size_t id = 0; id < size; ++id)
+          {
+            std::vector<types::UnknownProperty> properties;
+            Field(properties);
+            // Only objects with properties have an entry; an empty one would shift every later id.
+            if (value.Add(std::move(properties)) == types::NO_PROPERTIES)
+              throw InvalidImage("empty unknown properties entry");
+          }
+        }
+        else if constexpr (IsVariant<T>::value)
+          ReadAlternative(value, Unsigned(), std::make_index_sequence<std::variant_size_v<T>>{});
+        else
+          Serialize(*this, value);
+      }
+
+     private:
+      template<typename Variant, std::size_t... I>
+      void ReadAlternative(Variant& value, std::uint64_t index, std::index_sequence<I...>)
+      {
+        const bool found = ((index == I ? (Field(value.template emplace<I>()), true) : false) || ...);
+        if (!found)
+          throw InvalidImage("unknown variant alternative");
+      }
+
+      const char* pos_;
+      const char* end_;
+    };
+
+    // ----------------------------------------
+    // Image layout
+    // ----------------------------------------
+    //
+    //   magic, format version, library version,
+    //   request (the configuration path a cache entry answers, empty for SaveCompiled),
+    //   source files (path, size, content hash) the mechanism was parsed from,
+    //   payload size, payload hash, payload (the serialized Mechanism)
+
+    struct SourceFile
+    {
+      std::string path;
+      std::uint64_t size{ 0 };
+      std::uint64_t hash{ 0 };
+    };
+
+    struct ImageHeader
+    {
+      std::string library_version;
+      std::string request;
+      std::vector<SourceFile> sources;
+    };
+
+    std::string WriteImage(const Mechanism& mechanism, const ImageHeader& header)
+    {
+      ImageWriter payload;
+      payload.Field(mechanism);
+
+      ImageWriter image;
+      image.Raw(IMAGE_MAGIC);
+      image.Unsigned(IMAGE_FORMAT_VERSION);
+      image.Field(header.library_version);
+      image.Field(header.request);
+      image.Unsigned(header.sources.size());
+      for (const auto& source : header.sources)
+      {
+        image.Field(source.path);
+        image.Unsigned(source.size);
+        image.Unsigned(source.hash);
+      }
+      image.Unsigned(payload.Bytes().size());
+      image.Unsigned(HashBytes(payload.Bytes()));
+      image.Raw(payload.Bytes());
+      return std::move(image.Bytes());
+    }
+
+    // Reads an image's header, leaving `reader` at the start of the payload.
+    ImageHeader ReadImageHeader(ImageReader& reader)
+    {
+      if (reader.Rest().substr(0, IMAGE_MAGIC.size()) != IMAGE_MAGIC)
+        throw InvalidImage("not a compiled mechanism");
+      reader.Take(IMAGE_MAGIC.size());
+      const std::uint64_t format_version = reader.Unsigned();
+      if (format_version != IMAGE_FORMAT_VERSION)
+        throw UnsupportedFormatVersion(mc_fmt::format(
+            "image format version {} is not supported (expected {})", format_version, IMAGE_FORMAT_VERSION));
+
+      ImageHeader header;
+      reader.Field(header.library_version);
+      reader.Field(header.request);
+      header.sources.resize(reader.Size());
+      for (auto& source : header.sources)
+      {
+        reader.Field(source.path);
+        source.size = reader.Unsigned();
+        source.hash = reader.Unsigned();
+      }
+      return header;
+    }
+
+    Mechanism ReadImagePayload(ImageReader& reader)
+    {
+      const std::size_t size = reader.Size();
+      const std::uint64_t hash = reader.Unsigned();
+      const std::string_view payload = reader.Take(size);
+      if (HashBytes(payload) != hash)
+        throw InvalidImage("checksum mismatch");
+
+      ImageReader payload_reader(payload);
+      Mechanism mechanism;
+      payload_reader.Field(mechanism);
+      if (!payload_reader.Rest().empty())
+        throw InvalidImage("unexpected data after the mechanism");
+      AssignIndices(mechanism);
+      return mechanism;
+    }
+
+    std::string CacheRequest(const std::filesystem::path& config_path)
+    {
+      return std::filesystem::absolute(config_path).lexically_normal().string();
+    }
+  }  // namespace
+
+  Errors SaveCompiled(const Mechanism& mechanism, const std::filesystem::path& path)
+  {
+    auto failure = [&](ErrorCode code, const std::exception& e) -> Errors
+    {
+      return { { code, mc_fmt::format("Failed to save compiled mechanism '{}': {}", path.string(), e.what()) } };
+    };
+    try
+    {
+      WriteFileAtomically(path, WriteImage(mechanism, ImageHeader{ getVersionString(), {}, {} }));
+      return {};
+    }
+    catch (const std::exception& e)
+    {
+      return failure(ErrorCode::UnexpectedError, e);
+    }
+  }
+
+  std::expected<Mechanism, Errors> LoadCompiled(const std::filesystem::path& path)
+  {
+    auto failure = [&](ErrorCode code, const std::string& message)
+    {
+      return std::unexpected(
+          Errors{ { code, mc_fmt::format("Failed to load compiled mechanism '{}': {}", path.string(), message) } });
+    };
+    const std::optional<std::string> bytes = ReadFileContents(path);
+    if (!bytes)
+      return failure(ErrorCode::FileNotFound, "the file does not exist or cannot be read");
+    try
+    {
+      ImageReader reader(*bytes);
+      ReadImageHeader(reader);
+      return ReadImagePayload(reader);
+    }
+    catch (const UnsupportedFormatVersion& e)
+    {
+      return failure(ErrorCode::InvalidVersion, e.what());
+    }
+    catch (const std::exception& e)
+    {
+      return failure(ErrorCode::UnexpectedError, e.what());
+    }
+  }
+
+  std::optional<Mechanism> LoadCachedMechanism(
+      const std::filesystem::path& cache_path,
+      const std::filesystem::path& config_path)
+  {
+    try
+    {
+      const std::optional<std::string> bytes = ReadFileContents(cache_path);
+      if (!bytes)
+        return std::nullopt;
+
+      ImageReader reader(*bytes);
+      const ImageHeader header = ReadImageHeader(reader);
+      if (header.library_version != getVersionString() || header.request != CacheRequest(config_path) ||
+          header.sources.empty())
+        return std::nullopt;
+
+      for (const auto& source : header.sources)
+      {
+        std::error_code error;
+        if (std::filesystem::file_size(source.path, error) != source.size || error)
+          return std::nullopt;
+        const std::optional<std::string> contents = ReadFileContents(source.path);
+        if (!contents || HashBytes(*contents) != source.hash)
+          return std::nullopt;
+      }
+      return ReadImagePayload(reader);
+    }
+    catch (const std::exception&)
+    {
+      return std::nullopt;  // an unreadable cache is a cache miss
+    }
+  }
+
+  void SaveCachedMechanism(
+      const std::filesystem::path& cache_path,
+      const std::filesystem::path& config_path,
+      const std::vector<std::filesystem::path>& source_files,
+      const Mechanism& mechanism)
+  {
+    try
+    {
+      ImageHeader header{ getVersionString(), CacheRequest(config_path), {} };
+      for (const auto& path : source_files)
+      {
+        const std::optional<std::string> contents = ReadFileContents(path);
+        if (!contents)
+          return;
+        header.sources.push_back(
+            { std::filesystem::absolute(path).lexically_normal().string(), contents->size(), HashBytes(*contents) });
+      }
+      WriteFileAtomically(cache_path, WriteImage(mechanism, header));
+    }
+    catch (const std::exception&)
+    {
+      // Caching is best effort; the parsed mechanism is returned either way.
+    }
+  }
+}  // namespace mechanism_configuration
@@ -0,0 +1,31 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/mechanism.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  /// @brief Reads the mechanism cached for `config_path` (see ParseOptions::cache_path), if the
+  ///        cache was written by this library version for the same configuration and every
+  ///        source file it recorded still has the same contents.
+  /// @return The cached mechanism, or std::nullopt if the cache is missing, stale or unreadable
+  std::optional<Mechanism> LoadCachedMechanism(
+      const std::filesystem::path& cache_path,
+      const std::filesystem::path& config_path);
+
+  /// @brief Caches a mechanism parsed from `config_path`, recording the contents of every file
+  ///        it was read from so a later LoadCachedMechanism can tell whether it is still current.
+  ///        Caching is best effort: a mechanism that cannot be written is simply not cached.
+  void SaveCachedMechanism(
+      const std::filesystem::path& cache_path,
+      const std::filesystem::path& config_path,
+      const std::vector<std::filesystem::path>& source_files,
+      const Mechanism& mechanism);
+}  // namespace mechanism_configuration
@@ -0,0 +1,30 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/errors.hpp>
+
+#include <cstddef>
+
+namespace mechanism_configuration
+{
+  /// @brief Whether `errors` (Errors or Diagnostic entries) holds `max_errors` or more, so that
+  ///        checking can stop
+  /// @param max_errors The most errors wanted (see ValidationOptions::ErrorLimit), or 0 for no limit
+  template<typename ErrorList>
+  bool ErrorLimitReached(const ErrorList& errors, std::size_t max_errors)
+  {
+    return max_errors != 0 && errors.size() >= max_errors;
+  }
+
+  /// @brief Drops the errors past the first `max_errors` (none when it is 0). A check stopped by
+  ///        ErrorLimitReached may have found a few more in its last step.
+  template<typename ErrorList>
+  void TruncateErrors(ErrorList& errors, std::size_t max_errors)
+  {
+    if (ErrorLimitReached(errors, max_errors))
+      errors.resize(max_errors);
+  }
+}  // namespace mechanism_configuration
@@ -0,0 +1,63 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/errors.hpp>
+
+#include <yaml-cpp/yaml.h>
+
+#include <exception>
+#include <string>
+#include <string_view>
+
+namespace mechanism_configuration
+{
+  /// @brief Extracts a YAML node's source location, for error messages that carry line:col.
+  ///        Offset by the active ScopedLineOrigin, if any.
+  ErrorLocation LocationOf(const YAML::Node& node);
+
+  /// @brief Returns an exception's message. For a YAML::Exception, the line it reports is offset
+  ///        by the active ScopedLineOrigin, if any, like LocationOf.
+  std::string ExceptionMessage(const std::exception& e);
+
+  /// @brief While alive, shifts every line reported by LocationOf (on this thread) by `line`.
+  ///        Used when a slice of a larger document is loaded on its own, so that errors about the
+  ///        slice still point at the line it came from.
+  class ScopedLineOrigin
+  {
+   public:
+    /// @param line 0-based line of the larger document on which the loaded slice starts
+    explicit ScopedLineOrigin(int line);
+    ~ScopedLineOrigin();
+
+    ScopedLineOrigin(const ScopedLineOrigin&) = delete;
+    ScopedLineOrigin& operator=(const ScopedLineOrigin&) = delete;
+
+   private:
+    int previous_;
+  };
+
+  /// @brief The text the nodes being checked on this thread were loaded from, as set by the active
+  ///        ScopedSource, or empty when it is not known. A node's Mark().pos is an offset into it,
+  ///        unless the node came from another document (e.g. a file listed in a `files:` section),
+  ///        so whatever is read from it must be checked against the node.
+  std::string_view SourceText();
+
+  /// @brief While alive, makes `text` the SourceText of this thread. Used where a document is
+  ///        loaded from text that outlives its checks, so that a position inside a scalar (e.g.
+  ///        an error in a multi-line lambda function) can be found in the source.
+  class ScopedSource
+  {
+   public:
+    explicit ScopedSource(std::string_view text);
+    ~ScopedSource();
+
+    ScopedSource(const ScopedSource&) = delete;
+    ScopedSource& operator=(const ScopedSource&) = delete;
+
+   private:
+    std::string_view previous_;
+  };
+}  // namespace mechanism_configuration
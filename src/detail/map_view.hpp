@@ -0,0 +1,67 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  /// @brief A YAML mapping with its keys indexed once, for objects whose keys are looked up
+  ///        repeatedly. YAML::Node::operator[] converts every key of the map it walks (copying
+  ///        the longer ones into strings) and copies a missing key into the node it returns; a
+  ///        lookup here compares string_views and never allocates.
+  ///
+  ///        Converts implicitly from and to the node, so it can stand in for a const YAML::Node&
+  ///        parameter without changing the callers.
+  class MapView
+  {
+   public:
+    struct Entry
+    {
+      std::string_view key;
+      YAML::Node value;
+    };
+
+    /// @brief Indexes the keys of `node`; a node that is not a map has none
+    MapView(const YAML::Node& node);
+
+    /// @return The value of `key`, or an undefined node (false in a boolean context) if the map
+    ///        has no such key. Repeated keys resolve to their first occurrence, as in yaml-cpp.
+    const YAML::Node& operator[](std::string_view key) const
+    {
+      for (const auto& entry : entries_)
+        if (entry.key == key)
+          return entry.value;
+      return Undefined();
+    }
+
+    /// @return The viewed node
+    const YAML::Node& node() const
+    {
+      return node_;
+    }
+
+    operator const YAML::Node&() const
+    {
+      return node_;
+    }
+
+    /// @return The key-value pairs of the map, in document order
+    std::span<const Entry> entries() const
+    {
+      return entries_;
+    }
+
+   private:
+    static const YAML::Node& Undefined();
+
+    YAML::Node node_;
+    std::vector<Entry> entries_;
+  };
+}  // namespace mechanism_configuration
@@ -0,0 +1,48 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  /// @brief Calls `body(i)` for every i in [0, count) on a pool of worker threads, one per
+  ///        hardware thread at most, and returns once every call has finished. Calls are handed
+  ///        out in index order but may complete in any order, so `body` should write its result
+  ///        to slot i for the caller to read back in order. `body` must not throw.
+  template<typename Body>
+  void ParallelFor(std::size_t count, Body&& body)
+  {
+    const std::size_t threads = std::min<std::size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+    std::atomic<std::size_t> next{ 0 };
+    auto work = [&]()
+    {
+      for (std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+        body(i);
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads > 0 ? threads - 1 : 0);
+    for (std::size_t t = 1; t < threads; ++t)
+    {
+      try
+      {
+        workers.emplace_back(work);
+      }
+      catch (const std::system_error&)
+      {
+        break;  // run with the workers already started
+      }
+    }
+    work();
+    for (auto& worker : workers)
+      worker.join();
+  }
+}  // namespace mechanism_configuration
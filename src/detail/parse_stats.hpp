@@ -0,0 +1,67 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/parse_stats.hpp>
+
+#include <yaml-cpp/yaml.h>
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace mechanism_configuration
+{
+  /// @brief Measures one stage of a parse, from construction until it goes out of scope, and then
+  ///        reports it to the observer. Without an observer it reads no clock and reports nothing.
+  class StageTimer
+  {
+   public:
+    StageTimer(ParseObserver* observer, ParseStage stage, const std::filesystem::path& file = {});
+    ~StageTimer();
+
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+    /// @brief Whether the stage is being measured, i.e. whether `bytes` and `nodes` are worth counting
+    explicit operator bool() const
+    {
+      return observer_ != nullptr;
+    }
+
+    /// @brief Ends the timed part of the stage, so that counting `bytes` and `nodes` afterwards is not
+    ///        included in its wall time
+    void Stop();
+
+    std::size_t bytes{ 0 };
+    std::size_t nodes{ 0 };
+
+   private:
+    ParseObserver* observer_;
+    ParseStage stage_;
+    std::filesystem::path file_;
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::time_point stop_;
+  };
+
+  /// @brief The number of nodes in a document tree, `node` included
+  std::size_t CountNodes(const YAML::Node& node);
+
+  /// @brief ReadFileContents, reported as a ReadFile stage
+  std::optional<std::string> ReadFileContents(const std::filesystem::path& path, ParseObserver* observer);
+
+  /// @brief YAML::Load, reported as a LoadDocument stage of `file`
+  YAML::Node LoadDocument(const std::string& content, ParseObserver* observer, const std::filesystem::path& file = {});
+
+  /// @brief YAML::LoadFile, reported as a ReadFile and a LoadDocument stage
+  /// @throws YAML::BadFile if the file cannot be read
+  YAML::Node LoadFile(const std::filesystem::path& path, ParseObserver* observer);
+
+  /// @brief LoadFile, keeping the text of the file in `content` (e.g. for a ScopedSource)
+  /// @throws YAML::BadFile if the file cannot be read
+  YAML::Node LoadFile(const std::filesystem::path& path, ParseObserver* observer, std::string& content);
+}  // namespace mechanism_configuration
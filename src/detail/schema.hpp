@@ -4,16 +4,61 @@
 
 #pragma once
 
+#include "detail/map_view.hpp"
+
 #include <mechanism_configuration/errors.hpp>
 
 #include <yaml-cpp/yaml.h>
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <vector>
 
 namespace mechanism_configuration
 {
+  /// @brief The keys of one kind of YAML object, compiled once (typically into a function-local
+  ///        static) so that checking an object is a single pass over its keys (see MapView).
+  ///        Each key is found in a collision-free hash table and marks its bit in a mask; the
+  ///        required keys and the exactly-one-of groups are then checked against that mask.
+  class Schema
+  {
+   public:
+    /// @brief The largest number of distinct keys a schema can hold
+    static constexpr std::size_t MAX_KEYS = 64;
+
+    /// @param required_keys Keys that must all be present
+    /// @param optional_keys Keys that may be present
+    /// @param exactly_one_of Groups of mutually-exclusive keys; exactly one member of each
+    ///        group must be present. Group members are treated as allowed keys.
+    /// @throws std::invalid_argument if there are more than MAX_KEYS distinct keys
+    Schema(
+        const std::vector<std::string_view>& required_keys,
+        const std::vector<std::string_view>& optional_keys,
+        const std::vector<std::vector<std::string_view>>& exactly_one_of = {});
+
+    /// @brief Checks the keys of a YAML object against the schema (see CheckSchema)
+    Errors Check(const MapView& object) const;
+
+   private:
+    using Mask = std::uint64_t;
+    static constexpr std::size_t NOT_FOUND = MAX_KEYS;
+
+    /// @return The bit of `key`, or NOT_FOUND if it is not in the schema
+    std::size_t Find(std::string_view key) const;
+
+    // Bit i stands for keys_[i]; the keys are sorted, so errors about several keys come out in
+    // the same order as before the schema was compiled.
+    std::vector<std::string> keys_;
+    // slots_[Hash(key, seed_) & slot_mask_] is 1 + the bit of `key`, or 0 for an empty slot
+    std::vector<std::uint8_t> slots_;
+    std::uint64_t seed_ = 0;
+    std::size_t slot_mask_ = 0;
+    Mask required_ = 0;
+    std::vector<Mask> groups_;
+    std::vector<std::string> group_names_;
+  };
+
   /// @brief Checks the keys of a YAML object against a schema.
   /// @param object The YAML node to validate
   /// @param required_keys Keys that must all be present
@@ -22,9 +67,17 @@ namespace mechanism_configuration
   ///        group must be present (zero -> RequiredKeyNotFound, more than one ->
   ///        MutuallyExclusiveOption). Group members are treated as allowed keys.
   /// @return A collection of schema errors; empty if the object conforms.
+  /// @note This compiles a Schema on every call; objects checked repeatedly should use a static one.
   Errors CheckSchema(
       const YAML::Node& object,
       const std::vector<std::string_view>& required_keys,
       const std::vector<std::string_view>& optional_keys,
       const std::vector<std::vector<std::string_view>>& exactly_one_of = {});
+
+  /// @brief Checks that a scalar holds an expression that compiles (see Expression).
+  /// @param object The YAML node holding the expression
+  /// @param what Names the expression in error messages, e.g. "lambda function"
+  /// @param allow_pressure Whether the expression may depend on the pressure
+  /// @return An InvalidExpression error located at the offending character, if any
+  Errors CheckExpression(const YAML::Node& object, std::string_view what, bool allow_pressure = true);
 }  // namespace mechanism_configuration
@@ -6,6 +6,7 @@
 
 #include "detail/semantics/core.hpp"
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -122,5 +123,5 @@ namespace mechanism_configuration
   ///        dissolved reactions/equilibria, Henry's-law transfers/equilibria, linear constraint
   ///        terms) and required definition-derived properties (molecular weight, diffusion
   ///        coefficient, density).
-  Errors ValidateAerosolSemantics(const semantics::AerosolInput& input);
+  std::vector<Diagnostic> ValidateAerosolSemantics(const semantics::AerosolInput& input, std::size_t max_errors = 0);
 }  // namespace mechanism_configuration
@@ -11,6 +11,12 @@
 
 namespace mechanism_configuration::semantics
 {
+  // Every Validate*Semantics function returns its errors as unformatted Diagnostics (with no
+  // file; the caller knows which file the input came from). Each takes a `max_errors` (0: no
+  // limit) and stops checking once it has found that many errors (see ErrorLimitReached). It may
+  // return a few more, found in its last step; the caller truncates to the limit once every check
+  // has run.
+
   // A referenced name and its source location. Parsed documents populate the location
   // (line:col for error reporting) and in-code Mechanism leaves it empty.
   struct NamedRef
@@ -6,6 +6,7 @@
 
 #include "detail/semantics/core.hpp"
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -51,5 +52,5 @@ namespace mechanism_configuration
   ///        species-map existence), duplicate (category, hierarchy) pairs, and species-map
   ///        scaling-factor sums. Independent of ValidateReactionsSemantics — emissions never
   ///        cross-references species or phases.
-  Errors ValidateEmissionsSemantics(const semantics::EmissionsInput& input);
+  std::vector<Diagnostic> ValidateEmissionsSemantics(const semantics::EmissionsInput& input, std::size_t max_errors = 0);
 }  // namespace mechanism_configuration
@@ -8,6 +8,7 @@
 
 #include <mechanism_configuration/errors.hpp>
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -41,7 +42,7 @@ namespace mechanism_configuration::semantics
 namespace mechanism_configuration
 {
   /// @brief Validates species, phase, gas-phase reaction semantic rules.
-  ///        Errors include `line:col` when the source location is available.
-  Errors ValidateReactionsSemantics(const semantics::ReactionsInput& input);
+  ///        Each error carries its `line:col` when the source location is available.
+  std::vector<Diagnostic> ValidateReactionsSemantics(const semantics::ReactionsInput& input, std::size_t max_errors = 0);
 
 }  // namespace mechanism_configuration
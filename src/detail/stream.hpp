@@ -0,0 +1,58 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/errors.hpp>
+
+#include <yaml-cpp/yaml.h>
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace mechanism_configuration
+{
+  /// @brief A top-level scalar read from a document's event stream, with its source location.
+  struct TopLevelScalar
+  {
+    std::string value;
+    ErrorLocation location;
+  };
+
+  /// @brief Reads a whole file into memory.
+  /// @return The file contents, or std::nullopt if the file cannot be read
+  std::optional<std::string> ReadFileContents(const std::filesystem::path& path);
+
+  /// @brief Writes `bytes` to a temporary file next to `path` and renames it into place, so
+  ///        readers (other processes included) see either the old file or the new one, never a
+  ///        partially written one.
+  /// @throws std::runtime_error if the file cannot be written
+  void WriteFileAtomically(const std::filesystem::path& path, std::string_view bytes);
+
+  /// @brief Finds the scalar value of a top-level key by scanning the document's events, without
+  ///        building a node tree. The scan stops as soon as the value is found.
+  /// @return The value, or std::nullopt if the root is not a map or has no scalar under `key`
+  /// @throws YAML::Exception if the document is malformed before the key is found
+  std::optional<TopLevelScalar> FindTopLevelScalar(std::string_view text, std::string_view key);
+
+  /// @brief Streams the elements of one sequence out of a document, one at a time, instead of
+  ///        loading the whole document tree. Each element is cut out of `text` and loaded on its
+  ///        own; while `visit` runs, a ScopedLineOrigin makes LocationOf report positions in `text`.
+  ///
+  ///        On success the streamed sequence is replaced in `text` by an empty `[]` (newlines are
+  ///        kept), so loading `text` afterwards yields the rest of the document with unchanged
+  ///        source positions. A missing key, or a key whose value is not a sequence, streams
+  ///        nothing and leaves `text` untouched.
+  /// @param text The document
+  /// @param key The top-level key of the sequence to stream, or empty to stream a root sequence
+  /// @param visit Called with each element, in document order
+  /// @return false if the document cannot be streamed (anchors, aliases, null elements, or a
+  ///         slice that does not re-load to the same content). `text` is then untouched, and
+  ///         anything built from elements already visited must be discarded.
+  /// @throws YAML::Exception if the document is malformed
+  bool StreamSequence(std::string& text, std::string_view key, const std::function<void(const YAML::Node&)>& visit);
+}  // namespace mechanism_configuration
@@ -6,6 +6,7 @@
 
 #include <mechanism_configuration/errors.hpp>
 #include <mechanism_configuration/mechanism.hpp>
+#include <mechanism_configuration/parse.hpp>
 
 #include <yaml-cpp/yaml.h>
 
@@ -23,9 +24,39 @@ namespace mechanism_configuration::v0
     const std::string CAMP_DATA = "camp-data";
     const std::string TYPE = "type";
 
+    ParseOptions options_;
+    std::vector<std::filesystem::path> source_files_;
+
     Errors GetCampFiles(const std::filesystem::path& config_path, std::vector<std::filesystem::path>& camp_files);
+    Errors GetCampFiles(
+        const YAML::Node& camp_data,
+        const std::filesystem::path& config_dir,
+        std::vector<std::filesystem::path>& camp_files);
+    std::expected<Mechanism, Errors> ParseCampFiles(const std::vector<std::filesystem::path>& camp_files);
 
    public:
+    Parser() = default;
+
+    /// @brief A parser that reads configurations as `options` describe (e.g. parsing the CAMP
+    ///        files in parallel).
+    explicit Parser(const ParseOptions& options)
+        : options_(options)
+    {
+    }
+
     std::expected<Mechanism, Errors> Parse(const std::filesystem::path& config_path);
+
+    /// @brief Parse a v0 configuration whose CAMP file-list document has already been loaded
+    ///        from `config_path`, so the file is not read a second time.
+    /// @param config_path Path the file-list document was loaded from
+    /// @param camp_data The loaded file-list document (the one holding `camp-files`)
+    std::expected<Mechanism, Errors> Parse(const std::filesystem::path& config_path, const YAML::Node& camp_data);
+
+    /// @brief The files the last configuration was read from: the file-list document, then
+    ///        every CAMP file it names, in list order.
+    const std::vector<std::filesystem::path>& SourceFiles() const
+    {
+      return source_files_;
+    }
   };
 }  // namespace mechanism_configuration::v0
@@ -15,7 +15,8 @@
 namespace mechanism_configuration::v0
 {
   // species and mechanism
-  Errors ParseChemicalSpecies(Mechanism& mechanism, const YAML::Node& object);
+  // Extra species keys are stored in mechanism.unknown_properties when collect_unknown_properties is set.
+  Errors ParseChemicalSpecies(Mechanism& mechanism, const YAML::Node& object, bool collect_unknown_properties);
   Errors ParseProducts(const YAML::Node& object, std::vector<types::ReactionComponent>& products);
   Errors ParseReactants(const YAML::Node& object, std::vector<types::ReactionComponent>& reactants);
   Errors ParseRelativeTolerance(Mechanism& mechanism, const YAML::Node& object);
@@ -41,6 +41,9 @@ namespace mechanism_configuration::v1::keys
 
   inline constexpr std::string_view Equilibrium_key = "EQUILIBRIUM";
 
+  inline constexpr std::string_view Expression_key = "EXPRESSION";
+  inline constexpr std::string_view expression = "expression";
+
   inline constexpr std::string_view henrys_law_constant = "Henry's law constant";
   inline constexpr std::string_view HLC_ref = "HLC_ref [mol m-3 Pa-1]";
   inline constexpr std::string_view henrys_law_C = "C [K]";
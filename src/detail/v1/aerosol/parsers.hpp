@@ -8,6 +8,7 @@
 #include <mechanism_configuration/types/reactions.hpp>
 #include <mechanism_configuration/types/species.hpp>
 
+#include <detail/map_view.hpp>
 #include <yaml-cpp/yaml.h>
 
 #include <string>
@@ -19,23 +20,24 @@ namespace mechanism_configuration::v1
   // Rate constant parsers
   // ----------------------------------------
 
-  types::HenrysLawConstant ParseHenrysLawConstant(const YAML::Node& object);
-  types::Equilibrium ParseEquilibrium(const YAML::Node& object);
+  types::HenrysLawConstant ParseHenrysLawConstant(const MapView& object);
+  types::Equilibrium ParseEquilibrium(const MapView& object);
 
   /// @brief Parses a bare Arrhenius rate-constant block (A, B, C, D, E).
-  types::Arrhenius ParseArrhenius(const YAML::Node& object);
+  types::Arrhenius ParseArrhenius(const MapView& object);
 
   /// @brief Parses one rate-constant block into the RateConstant variant, dispatching on its
-  ///        inner `type` (ARRHENIUS -> Arrhenius, EQUILIBRIUM -> Equilibrium constant).
-  types::RateConstant ParseRateConstant(const YAML::Node& object);
+  ///        inner `type` (ARRHENIUS -> Arrhenius, EQUILIBRIUM -> Equilibrium constant,
+  ///        EXPRESSION -> RateExpression).
+  types::RateConstant ParseRateConstant(const MapView& object);
 
   // ----------------------------------------
   // Representation parsers
   // ----------------------------------------
 
-  types::UniformSection ParseUniformSection(const YAML::Node& object);
-  types::SingleMomentMode ParseSingleMomentMode(const YAML::Node& object);
-  types::TwoMomentMode ParseTwoMomentMode(const YAML::Node& object);
+  types::UniformSection ParseUniformSection(const MapView& object);
+  types::SingleMomentMode ParseSingleMomentMode(const MapView& object);
+  types::TwoMomentMode ParseTwoMomentMode(const MapView& object);
 
   // ----------------------------------------
   // Process parsers
@@ -44,10 +46,12 @@ namespace mechanism_configuration::v1
   /// @brief Parses a Henry's-law phase transfer. The diffusion coefficient is sourced from the
   ///        gas-phase species' definition in `phases`.
   types::HenrysLawPhaseTransfer ParseHenrysLawPhaseTransfer(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Phase>& phases);
-  types::DissolvedReaction ParseDissolvedReaction(const YAML::Node& object);
-  types::DissolvedReversibleReaction ParseDissolvedReversibleReaction(const YAML::Node& object);
+  types::DissolvedReaction ParseDissolvedReaction(const MapView& object, types::UnknownProperties* unknown_properties);
+  types::DissolvedReversibleReaction ParseDissolvedReversibleReaction(
+      const MapView& object,
+      types::UnknownProperties* unknown_properties);
 
   // ----------------------------------------
   // Constraint parsers
@@ -56,11 +60,13 @@ namespace mechanism_configuration::v1
   /// @brief Parses a Henry's-law equilibrium. The solvent's molecular weight is sourced from the
   ///        species section and its density from the condensed phase.
   types::HenrysLawEquilibrium ParseHenrysLawEquilibrium(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& species,
       const std::vector<types::Phase>& phases);
-  types::DissolvedEquilibrium ParseDissolvedEquilibrium(const YAML::Node& object);
-  types::LinearConstraint ParseLinearConstraint(const YAML::Node& object);
+  types::DissolvedEquilibrium ParseDissolvedEquilibrium(
+      const MapView& object,
+      types::UnknownProperties* unknown_properties);
+  types::LinearConstraint ParseLinearConstraint(const MapView& object);
 
   // ----------------------------------------
   // Container parsers
@@ -74,9 +80,12 @@ namespace mechanism_configuration::v1
   ///        equilibrium solvent's molecular weight
   /// @param phases Parsed phases, used to source per-species values such as a phase-transfer's
   ///        gas-phase diffusion coefficient or a solvent's density
+  /// @param unknown_properties Table to store the reaction components' comments in, or nullptr to
+  ///        skip them
   types::Aerosol ParseAerosol(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& species,
-      const std::vector<types::Phase>& phases);
+      const std::vector<types::Phase>& phases,
+      types::UnknownProperties* unknown_properties);
 
 }  // namespace mechanism_configuration::v1
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <mechanism_configuration/types/emissions.hpp>
+#include <mechanism_configuration/types/unknown_properties.hpp>
 
+#include <detail/map_view.hpp>
 #include <yaml-cpp/yaml.h>
 
 namespace mechanism_configuration::v1
@@ -14,7 +16,8 @@ namespace mechanism_configuration::v1
   ///        The input must be validated using CheckEmissionsSchema().
   ///        This function assumes the structure and types are correct.
   /// @param emissions_node YAML node for the `emissions` key
+  /// @param unknown_properties Table to store the sources' comments in, or nullptr to skip them
   /// @return The parsed EmissionsConfig
-  types::EmissionsConfig ParseEmissions(const YAML::Node& emissions_node);
+  types::EmissionsConfig ParseEmissions(const MapView& emissions_node, types::UnknownProperties* unknown_properties);
 
 }  // namespace mechanism_configuration::v1
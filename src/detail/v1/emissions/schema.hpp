@@ -6,6 +6,7 @@
 
 #include <mechanism_configuration/errors.hpp>
 
+#include <detail/map_view.hpp>
 #include <yaml-cpp/yaml.h>
 
 namespace mechanism_configuration::v1
@@ -19,6 +20,6 @@ namespace mechanism_configuration::v1
   ///        mappings), regridding, and sources.
   /// @param emissions_node YAML node for the `emissions` key
   /// @return List of structural errors, or empty if the section conforms
-  Errors CheckEmissionsSchema(const YAML::Node& emissions_node);
+  Errors CheckEmissionsSchema(const MapView& emissions_node);
 
 }  // namespace mechanism_configuration::v1
@@ -4,86 +4,191 @@
 
 #pragma once
 
+#include "detail/map_view.hpp"
 #include "detail/semantics/aerosol.hpp"
 #include "detail/semantics/emissions.hpp"
 #include "detail/semantics/reactions.hpp"
 
 #include <mechanism_configuration/mechanism.hpp>
+#include <mechanism_configuration/parse.hpp>
+#include <mechanism_configuration/types/reactions.hpp>
+#include <mechanism_configuration/types/unknown_properties.hpp>
 #include <mechanism_configuration/validate.hpp>
 
 #include <yaml-cpp/yaml.h>
 
+#include <cstddef>
 #include <expected>
 #include <filesystem>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace mechanism_configuration::v1
 {
+  /// @brief Extracts the located reference the semantic checks need for one v1 reaction node.
+  semantics::ReactionRef BuildReactionSemanticRef(const MapView& reaction);
+
   /// @brief Extracts a located semantics::ReactionsInput from a fully-resolved (inline) v1 YAML
   ///        node, so the version-neutral ValidateReactionsSemantics can run the semantic checks
-  ///        with line:col.
-  semantics::ReactionsInput BuildReactionsSemanticInput(const YAML::Node& object);
+  ///        with line:col. Species and phases are read from the node; the reaction references
+  ///        are the ones already collected while visiting each reaction.
+  semantics::ReactionsInput BuildReactionsSemanticInput(
+      const MapView& object,
+      std::vector<semantics::ReactionRef> reactions);
 
   /// @brief Extracts a located semantics::AerosolInput from a fully-resolved (inline) v1 YAML
   ///        node, so ValidateAerosolSemantics can run with line:col. Species/phase definitions
   ///        are always populated; representations/processes/constraints are only populated when
   ///        both `aerosol representations` and `aerosol processes` are present.
-  semantics::AerosolInput BuildAerosolSemanticInput(const YAML::Node& object);
+  semantics::AerosolInput BuildAerosolSemanticInput(const MapView& object);
 
   /// @brief Extracts a located semantics::EmissionsInput from a fully-resolved (inline) v1 YAML
   ///        node, so ValidateEmissionsSemantics can run with line:col. Returns a default-empty
   ///        EmissionsInput (validates with no errors) when the document has no `emissions` key.
-  semantics::EmissionsInput BuildEmissionsSemanticInput(const YAML::Node& object);
+  semantics::EmissionsInput BuildEmissionsSemanticInput(const MapView& object);
+
+  /// @brief The result of visiting each reaction exactly once: its schema check, semantic
+  ///        reference and build all happen in that one visit, whether the reaction comes from a
+  ///        loaded document or is streamed (see Parser::ParseStreaming). Built reactions are only
+  ///        used if the whole document turns out to be valid. A `*_failure` holds the message of
+  ///        the first exception thrown at that stage; it is raised at the point in validation
+  ///        where that stage runs for the whole document.
+  struct VisitedReactions
+  {
+    Errors type_errors;    // missing or unknown `type`
+    Errors schema_errors;  // per-type schema errors
+    std::vector<semantics::ReactionRef> references;
+    types::Reactions reactions;
+    std::optional<std::string> type_failure;
+    std::optional<std::string> schema_failure;
+    std::optional<std::string> semantic_failure;
+    std::optional<std::string> build_failure;
+    std::size_t max_errors{ 0 };  // stop visiting once this many errors are found (0: no limit)
+  };
+
+  /// @brief What has been parsed while validating a document, carried through to the build so
+  ///        that no section is parsed twice.
+  struct ParsedSections
+  {
+    std::vector<types::Species> species;
+    std::vector<types::Phase> phases;
+    VisitedReactions reactions;
+    bool reactions_visited{ false };  // true once every reaction has been visited (e.g. streamed)
+  };
 
+  /// @brief Parses v1 configurations. A Parser holds only its options: everything a parse
+  ///        produces along the way lives in that call, so one Parser may run any number of
+  ///        parses at the same time from different threads.
   class Parser
   {
    public:
     Parser() = default;
 
+    /// @brief A parser that reads configurations as `options` describe (e.g. loading `files:`
+    ///        lists in parallel). Streaming is requested by calling ParseStreaming.
+    explicit Parser(const ParseOptions& options)
+        : options_(options)
+    {
+    }
+
     /// @brief Parse a v1 mechanism from a configuration file: resolves any file-list sections
     ///        (v1.1+ `{ files: [...] }`) into a single document, validates it, and builds the
     ///        Mechanism. This is the file entry point — no separate resolve/validate step.
     /// @param config_path Path to the main configuration file.
+    /// @param source_files If set, receives the files the configuration was read from: the
+    ///        configuration itself, then every file its file-list sections name, in list order.
     /// @return The parsed Mechanism, or all structural / file-loading / semantic errors.
-    std::expected<Mechanism, Errors> Parse(const std::filesystem::path& config_path);
+    std::expected<Mechanism, Errors> Parse(
+        const std::filesystem::path& config_path,
+        std::vector<std::filesystem::path>* source_files = nullptr) const;
 
     /// @brief Parse a v1 mechanism from an in-memory YAML/JSON document string.
     /// @param content The document contents (not a file path).
     /// @return The parsed Mechanism, or all structural and semantic errors.
-    std::expected<Mechanism, Errors> Parse(const std::string& content);
+    std::expected<Mechanism, Errors> Parse(const std::string& content) const;
 
     /// @brief Validate an already-loaded YAML node (structure + semantics) and build the
     ///        Mechanism. Validation always runs first, so a caller cannot build from an
     ///        unvalidated node.
     /// @param object The YAML node to validate and parse
     /// @return The parsed Mechanism, or all structural and semantic errors encountered
-    std::expected<Mechanism, Errors> Parse(const YAML::Node& object);
-
-   private:
-    std::string config_path_;
-
-    /// @brief Resolves a configuration file's file-list sections into a single inline node.
-    std::expected<YAML::Node, Errors> ResolveFileConfig(const std::filesystem::path& config_path);
-
-    /// @brief Runs structural then semantic validation and, if both pass, builds the Mechanism,
-    ///        mapping any thrown exception to an error. Uses config_path_ for message prefixes.
-    std::expected<Mechanism, Errors> ValidateAndBuild(const YAML::Node& object);
+    std::expected<Mechanism, Errors> Parse(const YAML::Node& object) const;
+
+    /// @brief Parse a v1 mechanism whose root document has already been loaded from
+    ///        `config_path`, so the file is not read a second time. File-list sections are
+    ///        resolved relative to the file's directory and errors carry its path.
+    /// @param object The root document loaded from config_path
+    /// @param config_path Path the root document was loaded from
+    /// @param source_files If set, receives the files the configuration was read from
+    /// @return The parsed Mechanism, or all structural / file-loading / semantic errors.
+    std::expected<Mechanism, Errors> Parse(
+        const YAML::Node& object,
+        const std::filesystem::path& config_path,
+        std::vector<std::filesystem::path>* source_files = nullptr) const;
+
+    /// @brief Parse a v1 mechanism read from `config_path`, checking and building its reactions
+    ///        one at a time as they are streamed out of the text (including reactions split into
+    ///        other files), instead of loading every reaction into one document tree first. Peak
+    ///        memory then scales with the largest reaction rather than with the reactions section.
+    ///        Results and errors are the same as Parse(); documents that cannot be streamed
+    ///        (e.g. ones using anchors and aliases) are parsed by Parse().
+    /// @param content The contents of config_path
+    /// @param config_path Path the contents were read from
+    /// @param source_files If set, receives the files the configuration was read from
+    /// @return The parsed Mechanism, or all structural / file-loading / semantic errors.
+    std::expected<Mechanism, Errors> ParseStreaming(
+        std::string content,
+        const std::filesystem::path& config_path,
+        std::vector<std::filesystem::path>* source_files = nullptr) const;
 
-    /// @brief Checks the structural schema of a mechanism YAML node (keys/shape only).
-    Errors CheckSchema(const YAML::Node& object);
+    /// @brief Parse a v1 mechanism from an in-memory document string, streaming its reactions
+    ///        as ParseStreaming(content, config_path) does.
+    /// @param content The document contents (not a file path).
+    /// @return The parsed Mechanism, or all structural and semantic errors.
+    std::expected<Mechanism, Errors> ParseStreaming(std::string content) const;
 
-    /// @brief Constructs a Mechanism from an already-validated node. The emissions section, if
-    ///        present, is parsed separately and assigned by the caller (ValidateAndBuild).
-    Mechanism Build(const YAML::Node& object);
+   private:
+    ParseOptions options_;
 
-    inline void SetConfigPath(const std::string& config_path)
+    /// @brief What one parse accumulates on its way to the Mechanism
+    struct State
     {
-      config_path_ = config_path;
-    }
-
-    inline void SetDefaultConfigPath()
+      std::string config_path;  // prefixes error messages; empty when no file backs the document
+      std::vector<std::filesystem::path> source_files;
+      // The unknown properties of everything parsed so far, moved into the Mechanism by Build.
+      types::UnknownProperties unknown_properties;
+    };
+
+    /// @brief Where parsers store the unknown properties they find: the parse's table, or
+    ///        nullptr when options_.collect_unknown_properties is unset.
+    types::UnknownProperties* CollectedProperties(State& state) const
     {
-      config_path_ = "";
+      return options_.collect_unknown_properties ? &state.unknown_properties : nullptr;
     }
+
+    /// @brief Resolves a loaded root document's file-list sections into a single inline node.
+    ///        With `streamed`, reaction files are streamed into it rather than merged into the node.
+    ///        With options_.parallel_file_loading, each section's files are read concurrently.
+    std::expected<YAML::Node, Errors> ResolveFileConfig(
+        State& state,
+        const YAML::Node& object,
+        const std::filesystem::path& config_path,
+        VisitedReactions* streamed = nullptr) const;
+
+    /// @brief Runs structural then semantic validation and, if both pass, builds the Mechanism,
+    ///        mapping any thrown exception to an error. Uses state.config_path for message
+    ///        prefixes. Each reaction is visited once, during the schema check; with `streamed`,
+    ///        the reactions were already visited as they were streamed and the node holds none.
+    std::expected<Mechanism, Errors>
+    ValidateAndBuild(State& state, const YAML::Node& object, VisitedReactions* streamed = nullptr) const;
+
+    /// @brief Checks the structural schema of a mechanism YAML node (keys/shape only), keeping
+    ///        the species, phases and reactions it parses along the way in `parsed`.
+    Errors CheckSchema(State& state, const YAML::Node& object, ParsedSections& parsed) const;
+
+    /// @brief Constructs a Mechanism from an already-validated node and the sections parsed
+    ///        while validating it.
+    Mechanism Build(State& state, const YAML::Node& object, ParsedSections& parsed) const;
   };
 }  // namespace mechanism_configuration::v1
\ No newline at end of file
@@ -7,10 +7,13 @@
 #include <mechanism_configuration/errors.hpp>
 #include <mechanism_configuration/types/reactions.hpp>
 #include <mechanism_configuration/types/species.hpp>
+#include <mechanism_configuration/types/unknown_properties.hpp>
 
+#include <detail/map_view.hpp>
 #include <detail/v1/reactions/keys.hpp>
 #include <yaml-cpp/yaml.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -21,22 +24,29 @@ namespace mechanism_configuration::v1
   /// @brief Parses a YAML node into reaction components
   /// @param object YAML node representing ReactionComponents
   /// @param key Key of the sequence to parse
+  /// @param unknown_properties Table to store the components' comments in, or nullptr to skip them
   /// @return Vector of `types::ReactionComponent` with names, optional coefficients, and comments
-  std::vector<types::ReactionComponent> ParseReactionComponents(const YAML::Node& object, std::string_view key);
+  std::vector<types::ReactionComponent> ParseReactionComponents(
+      const MapView& object,
+      std::string_view key,
+      types::UnknownProperties* unknown_properties);
 
   /// @brief Parses a single reaction component from a YAML node.
   ///        The parser performs no validation or error checking.
   /// @param object YAML node representing ReactionComponents
   /// @param key Key identifying the reaction component
+  /// @param unknown_properties Table to store the component's comments in, or nullptr to skip them
   /// @return The parsed `types::ReactionComponent`, or a default-constructed one if none found
-  types::ReactionComponent ParseReactionComponent(const YAML::Node& object, std::string_view key);
+  types::ReactionComponent
+  ParseReactionComponent(const MapView& object, std::string_view key, types::UnknownProperties* unknown_properties);
 
   /// @brief Parses a collection of YAML nodes into reaction objects
   ///        Iterates over the given YAML nodes, identifies the parser for each reaction type,
   ///        and populates a `types::Reactions` container with the parsed reactions.
   /// @param objects YAML node containing multiple reaction definitions
+  /// @param unknown_properties Table to store the reactions' comments in, or nullptr to skip them
   /// @return A `types::Reactions` object with all successfully parsed reactions
-  types::Reactions ParseReactions(const YAML::Node& objects);
+  types::Reactions ParseReactions(const YAML::Node& objects, types::UnknownProperties* unknown_properties);
 
   /// @brief Abstract interface for reaction parsers
   class IReactionParser
@@ -48,14 +58,16 @@ namespace mechanism_configuration::v1
     /// @param existing_phases A list of chemical phases relevant to the reaction
     /// @return A list of any validation errors encountered
     virtual Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) = 0;
+        const std::vector<types::Phase>& existing_phases) const = 0;
 
     /// @brief Parses a YAML node representing a chemical reaction
     /// @param object The YAML node containing reaction information
     /// @param reactions The container to which the parsed reactions will be added
-    virtual void Parse(const YAML::Node& object, types::Reactions& reactions) = 0;
+    /// @param unknown_properties Table to store the reaction's comments in, or nullptr to skip them
+    virtual void
+    Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties) const = 0;
 
     /// @brief Destructor
     virtual ~IReactionParser() = default;
@@ -65,140 +77,156 @@ namespace mechanism_configuration::v1
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class BranchedParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class EmissionParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class FirstOrderLossParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class PhotolysisParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class SurfaceParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class TaylorSeriesParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class TroeParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class TernaryChemicalActivationParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class TunnelingParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class UserDefinedParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
   class LambdaRateConstantParser : public IReactionParser
   {
    public:
     Errors CheckSchema(
-        const YAML::Node& object,
+        const MapView& object,
         const std::vector<types::Species>& existing_species,
-        const std::vector<types::Phase>& existing_phases) override;
+        const std::vector<types::Phase>& existing_phases) const override;
 
-    void Parse(const YAML::Node& object, types::Reactions& reactions) override;
+    void Parse(const MapView& object, types::Reactions& reactions, types::UnknownProperties* unknown_properties)
+        const override;
   };
 
-  /// @brief Returns a static map of reaction type keys to their parser instances
-  inline std::map<std::string, std::unique_ptr<IReactionParser>>& GetReactionParserMap()
+  /// @brief The reaction parsers, keyed by reaction `type`. The registry is built once, on first
+  ///        use, and never modified afterwards; the parsers are stateless, so any number of
+  ///        threads may look them up and use them at the same time.
+  using ReactionParserMap = std::map<std::string, std::unique_ptr<const IReactionParser>, std::less<>>;
+
+  inline const ReactionParserMap& GetReactionParserMap()
   {
-    static std::map<std::string, std::unique_ptr<IReactionParser>> reaction_parsers = []
+    static const ReactionParserMap reaction_parsers = []
     {
-      std::map<std::string, std::unique_ptr<IReactionParser>> map;
+      ReactionParserMap map;
       map[std::string(keys::Arrhenius_key)] = std::make_unique<ArrheniusParser>();
       map[std::string(keys::FirstOrderLoss_key)] = std::make_unique<FirstOrderLossParser>();
       map[std::string(keys::Emission_key)] = std::make_unique<EmissionParser>();
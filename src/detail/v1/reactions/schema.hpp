@@ -7,6 +7,7 @@
 #include <mechanism_configuration/errors.hpp>
 #include <mechanism_configuration/types/species.hpp>
 
+#include <detail/map_view.hpp>
 #include <yaml-cpp/yaml.h>
 
 #include <vector>
@@ -23,6 +24,15 @@ namespace mechanism_configuration::v1
   /// @return List of structural errors, or empty if all entries conform
   Errors CheckReactantsOrProductsSchema(const YAML::Node& object);
 
+  class IReactionParser;
+
+  /// @brief Looks up the parser for a reaction's `type`, appending a located error when the
+  ///        type is missing or not a recognized reaction type.
+  /// @param object YAML node representing a single reaction
+  /// @param errors Receives the error, if any
+  /// @return The reaction's parser, or nullptr if its type is missing or unknown
+  const IReactionParser* FindReactionParser(const MapView& object, Errors& errors);
+
   /// @brief Schema-validates a YAML list of reactions: each has a defined, recognized type,
   ///        and then each reaction's keys are validated by its parser.
   /// @param reactions_list YAML node containing the list of reactions
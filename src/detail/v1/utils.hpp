@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include "detail/location.hpp"
+
 #include <mechanism_configuration/errors.hpp>
+#include <mechanism_configuration/types/unknown_properties.hpp>
 
 #include <detail/v1/keys.hpp>
 #include <yaml-cpp/yaml.h>
@@ -14,20 +17,25 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace mechanism_configuration::v1
 {
   /// @brief Ensures a YAML node is treated as a sequence
   /// @param node The YAML node to convert
-  /// @return A YAML sequence node containing the original node(s)
-  YAML::Node AsSequence(const YAML::Node& node);
-
-  /// @brief Extracts a YAML node's source location, for error messages that carry line:col.
-  ErrorLocation LocationOf(const YAML::Node& node);
+  /// @return The node's elements if it is a sequence, otherwise the node itself. Handles into the
+  ///        document are returned rather than a new sequence node, since adding a node to a new
+  ///        sequence merges the whole document's node memory into it.
+  std::vector<YAML::Node> AsSequence(const YAML::Node& node);
 
   void AppendFilePath(const std::string& config_path, Errors& errors);
 
-  std::unordered_map<std::string, std::string> GetComments(const YAML::Node& object);
+  /// @brief Stores an object's properties prefixed with two underscores (__) as one entry of
+  ///        `unknown_properties`
+  /// @param object The YAML node of a species, phase, reaction, reaction component, ...
+  /// @param unknown_properties The table to store them in, or nullptr to skip collecting them
+  /// @return The id of the new entry, or types::NO_PROPERTIES if there is none
+  types::PropertiesId GetComments(const YAML::Node& object, types::UnknownProperties* unknown_properties);
 
   /// @brief Reads a named entry's name, accepting either a bare-string shorthand or an object
   ///        keyed by the canonical `name` or the legacy `species name` alias (v1 files). Used for
@@ -4,6 +4,9 @@
 
 #include <mechanism_configuration/errors.hpp>
 
+#include <string>
+#include <string_view>
+
 namespace mechanism_configuration
 {
   std::string ErrorCodeToString(const ErrorCode& status)
@@ -34,6 +37,7 @@ namespace mechanism_configuration
       case ErrorCode::FileNotFound: return "FileNotFound";
       case ErrorCode::UnexpectedError: return "UnexpectedError";
       case ErrorCode::EmptyObject: return "EmptyObject";
+      case ErrorCode::InvalidExpression: return "InvalidExpression";
       case ErrorCode::DuplicateInventoryDetected: return "DuplicateInventoryDetected";
       case ErrorCode::DuplicateSpeciesMapDetected: return "DuplicateSpeciesMapDetected";
       case ErrorCode::DuplicateSourceDetected: return "DuplicateSourceDetected";
@@ -47,4 +51,43 @@ namespace mechanism_configuration
       default: return "Unknown";
     }
   }
-}  // namespace mechanism_configuration
\ No newline at end of file
+
+  std::string Diagnostic::to_string(std::string_view file_path) const
+  {
+    std::string text;
+    if (file != NO_FILE)
+    {
+      text += file_path;
+      text += ':';
+    }
+    if (line != 0)
+      text += std::to_string(line) + ':' + std::to_string(column) + ' ';
+
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < message.size(); ++i)
+    {
+      if (message[i] == '{' && i + 1 < message.size() && message[i + 1] == '}' && next < arguments.size())
+      {
+        text += arguments[next++];
+        ++i;
+      }
+      else
+        text += message[i];
+    }
+    return text;
+  }
+
+  std::string Diagnostics::to_string(const Diagnostic& diagnostic) const
+  {
+    return diagnostic.to_string(diagnostic.file < files.size() ? std::string_view(files[diagnostic.file]) : "");
+  }
+
+  Errors Diagnostics::ToErrors() const
+  {
+    Errors errors;
+    errors.reserve(entries.size());
+    for (const auto& diagnostic : entries)
+      errors.emplace_back(diagnostic.code, to_string(diagnostic));
+    return errors;
+  }
+}  // namespace mechanism_configuration
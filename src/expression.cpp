@@ -0,0 +1,536 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/expression.hpp>
+#include <mechanism_configuration/format_compat.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    // Cells are evaluated in blocks, one instruction at a time over the whole block.
+    constexpr std::size_t CELL_BLOCK = 256;
+
+    // Deeper expressions are rejected, so evaluation can use a fixed-size stack.
+    constexpr std::size_t MAX_STACK_DEPTH = 32;
+
+    // Bounds the parser's recursion on inputs such as "((((...".
+    constexpr std::size_t MAX_NESTING = 256;
+
+    bool IsIdentifierStart(char c)
+    {
+      return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+    }
+
+    bool IsIdentifierChar(char c)
+    {
+      return IsIdentifierStart(c) || (c >= '0' && c <= '9');
+    }
+  }  // namespace
+
+  /// @brief A recursive descent parser that builds an expression tree, folding constant
+  ///        subtrees as it goes, and then emits the tree as postfix code
+  class ExpressionCompiler
+  {
+   public:
+    explicit ExpressionCompiler(std::string_view source)
+        : source_(source)
+    {
+    }
+
+    std::expected<Expression, ExpressionError> Compile()
+    {
+      SkipSpace();
+      const bool is_lambda = Peek() == '[';
+      if (is_lambda && !ParseLambdaHead())
+        return std::unexpected(error_);
+
+      const auto root = ParseSum();
+      if (!root)
+        return std::unexpected(error_);
+
+      if (is_lambda && !(Accept(';') && Accept('}')))
+        Fail("Expected ';' and '}' after the returned expression");
+      else if (SkipSpace(); position_ != source_.size())
+        Fail(mc_fmt::format("Unexpected '{}'", source_[position_]));
+      if (!error_.message.empty())
+        return std::unexpected(error_);
+
+      Expression expression;
+      expression.stack_depth_ = Emit(*root, expression);
+      if (expression.stack_depth_ > MAX_STACK_DEPTH)
+      {
+        position_ = 0;
+        Fail(mc_fmt::format("Expression needs more than {} intermediate values", MAX_STACK_DEPTH));
+        return std::unexpected(error_);
+      }
+      return expression;
+    }
+
+    static double Apply(Expression::Op op, double a, double b)
+    {
+      using Op = Expression::Op;
+      switch (op)
+      {
+        case Op::Negate: return -a;
+        case Op::Add: return a + b;
+        case Op::Subtract: return a - b;
+        case Op::Multiply: return a * b;
+        case Op::Divide: return a / b;
+        case Op::Exp: return std::exp(a);
+        case Op::Log: return std::log(a);
+        case Op::Log10: return std::log10(a);
+        case Op::Sqrt: return std::sqrt(a);
+        case Op::Abs: return std::abs(a);
+        case Op::Pow: return std::pow(a, b);
+        case Op::Min: return std::min(a, b);
+        case Op::Max: return std::max(a, b);
+        default: return 0.0;
+      }
+    }
+
+   private:
+    using Op = Expression::Op;
+
+    struct Node
+    {
+      Op op;
+      double value{ 0.0 };
+      // Operand nodes, or NO_NODE
+      std::size_t left;
+      std::size_t right;
+    };
+
+    static constexpr std::size_t NO_NODE = static_cast<std::size_t>(-1);
+
+    struct Function
+    {
+      std::string_view name;
+      Op op;
+      std::size_t arguments;
+    };
+
+    static constexpr std::array<Function, 11> FUNCTIONS{ {
+        { "exp", Op::Exp, 1 },
+        { "log", Op::Log, 1 },
+        { "log10", Op::Log10, 1 },
+        { "sqrt", Op::Sqrt, 1 },
+        { "abs", Op::Abs, 1 },
+        { "fabs", Op::Abs, 1 },
+        { "pow", Op::Pow, 2 },
+        { "min", Op::Min, 2 },
+        { "max", Op::Max, 2 },
+        { "fmin", Op::Min, 2 },
+        { "fmax", Op::Max, 2 },
+    } };
+
+    std::string_view source_;
+    std::size_t position_{ 0 };
+    std::size_t nesting_{ 0 };
+    std::vector<Node> nodes_;
+    // Names bound to the temperature and pressure
+    std::string_view temperature_name_{ "T" };
+    std::string_view pressure_name_{ "P" };
+    ExpressionError error_;
+
+    // Records an error at the current position
+    // @return false, for returning from the parse functions
+    bool Fail(std::string message)
+    {
+      error_.message = std::move(message);
+      error_.line = 0;
+      error_.column = 0;
+      for (std::size_t i = 0; i < position_ && i < source_.size(); ++i)
+      {
+        if (source_[i] == '\n')
+        {
+          ++error_.line;
+          error_.column = 0;
+        }
+        else
+          ++error_.column;
+      }
+      return false;
+    }
+
+    // Records an error at the current position
+    // @return No node, for returning from the parse functions
+    std::nullopt_t Missing(std::string message)
+    {
+      Fail(std::move(message));
+      return std::nullopt;
+    }
+
+    char Peek() const
+    {
+      return position_ < source_.size() ? source_[position_] : '\0';
+    }
+
+    void SkipSpace()
+    {
+      while (position_ < source_.size() &&
+             (source_[position_] == ' ' || source_[position_] == '\t' || source_[position_] == '\n' ||
+              source_[position_] == '\r'))
+        ++position_;
+    }
+
+    bool Accept(char c)
+    {
+      SkipSpace();
+      if (Peek() != c)
+        return false;
+      ++position_;
+      return true;
+    }
+
+    std::string_view Identifier()
+    {
+      SkipSpace();
+      const std::size_t start = position_;
+      if (!IsIdentifierStart(Peek()))
+        return {};
+      while (IsIdentifierChar(Peek()))
+        ++position_;
+      return source_.substr(start, position_ - start);
+    }
+
+    // [](double T, double P) {  return
+    bool ParseLambdaHead()
+    {
+      if (!Accept('[') || !Accept(']'))
+        return Fail("Expected '[]' to begin the lambda");
+      if (!Accept('('))
+        return Fail("Expected '(' after '[]'");
+      std::vector<std::string_view> parameters;
+      if (!Accept(')'))
+      {
+        do
+        {
+          std::string_view type = Identifier();
+          if (type == "const")
+            type = Identifier();
+          if (type != "double" && type != "auto")
+            return Fail("Expected a parameter of type 'double'");
+          const std::string_view name = Identifier();
+          if (name.empty())
+            return Fail("Expected a parameter name");
+          parameters.push_back(name);
+        } while (Accept(','));
+        if (!Accept(')'))
+          return Fail("Expected ')' after the lambda parameters");
+      }
+      if (parameters.empty() || parameters.size() > 2)
+        return Fail("The lambda must take the temperature and, optionally, the pressure");
+      temperature_name_ = parameters[0];
+      pressure_name_ = parameters.size() > 1 ? parameters[1] : std::string_view{};
+
+      if (Accept('-'))
+      {
+        if (!Accept('>') || Identifier() != "double")
+          return Fail("Expected '-> double'");
+      }
+      if (!Accept('{'))
+        return Fail("Expected '{' to begin the lambda body");
+      if (Identifier() != "return")
+        return Fail("The lambda body must be a single return statement");
+      return true;
+    }
+
+    std::size_t Add(Node node)
+    {
+      nodes_.push_back(node);
+      return nodes_.size() - 1;
+    }
+
+    std::size_t Constant(double value)
+    {
+      return Add({ Op::Constant, value, NO_NODE, NO_NODE });
+    }
+
+    // Makes an operation node, or its value if every operand is constant
+    std::size_t Operation(Op op, std::size_t left, std::size_t right = NO_NODE)
+    {
+      const bool constant =
+          nodes_[left].op == Op::Constant && (right == NO_NODE || nodes_[right].op == Op::Constant);
+      if (constant)
+        return Constant(Apply(op, nodes_[left].value, right == NO_NODE ? 0.0 : nodes_[right].value));
+      return Add({ op, 0.0, left, right });
+    }
+
+    // sum := product (('+' | '-') product)*
+    std::optional<std::size_t> ParseSum()
+    {
+      auto left = ParseProduct();
+      while (left)
+      {
+        const Op op = Accept('+') ? Op::Add : Accept('-') ? Op::Subtract : Op::Constant;
+        if (op == Op::Constant)
+          break;
+        const auto right = ParseProduct();
+        if (!right)
+          return std::nullopt;
+        left = Operation(op, *left, *right);
+      }
+      return left;
+    }
+
+    // product := unary (('*' | '/') unary)*
+    std::optional<std::size_t> ParseProduct()
+    {
+      auto left = ParseUnary();
+      while (left)
+      {
+        const Op op = Accept('*') ? Op::Multiply : Accept('/') ? Op::Divide : Op::Constant;
+        if (op == Op::Constant)
+          break;
+        const auto right = ParseUnary();
+        if (!right)
+          return std::nullopt;
+        left = Operation(op, *left, *right);
+      }
+      return left;
+    }
+
+    // unary := ('-' | '+') unary | primary
+    std::optional<std::size_t> ParseUnary()
+    {
+      if (++nesting_ > MAX_NESTING)
+        return Missing(mc_fmt::format("Expression is nested more than {} levels deep", MAX_NESTING));
+      std::optional<std::size_t> node;
+      if (Accept('-'))
+      {
+        node = ParseUnary();
+        if (node)
+          node = Operation(Op::Negate, *node);
+      }
+      else if (Accept('+'))
+        node = ParseUnary();
+      else
+        node = ParsePrimary();
+      --nesting_;
+      return node;
+    }
+
+    // primary := number | variable | function '(' arguments ')' | '(' sum ')'
+    std::optional<std::size_t> ParsePrimary()
+    {
+      SkipSpace();
+      const char c = Peek();
+      if (c == '(')
+      {
+        ++position_;
+        const auto inner = ParseSum();
+        if (inner && !Accept(')'))
+          return Missing("Expected ')'");
+        return inner;
+      }
+      if ((c >= '0' && c <= '9') || c == '.')
+        return ParseNumber();
+      if (!IsIdentifierStart(c))
+        return Missing(c == '\0' ? "Unexpected end of expression" : mc_fmt::format("Unexpected '{}'", c));
+
+      const std::size_t start = position_;
+      std::string_view name = Identifier();
+      if (name == "std" && source_.substr(position_, 2) == "::")
+      {
+        position_ += 2;
+        name = Identifier();
+      }
+      if (!pressure_name_.empty() && name == pressure_name_)
+        return Add({ Op::Pressure, 0.0, NO_NODE, NO_NODE });
+      if (name == temperature_name_)
+        return Add({ Op::Temperature, 0.0, NO_NODE, NO_NODE });
+
+      const auto function =
+          std::find_if(FUNCTIONS.begin(), FUNCTIONS.end(), [name](const Function& f) { return f.name == name; });
+      if (function == FUNCTIONS.end())
+      {
+        position_ = start;
+        return Missing(mc_fmt::format("Unknown name '{}'", name));
+      }
+      if (!Accept('('))
+        return Missing(mc_fmt::format("Expected '(' after '{}'", name));
+      std::array<std::size_t, 2> arguments{ NO_NODE, NO_NODE };
+      for (std::size_t i = 0; i < function->arguments; ++i)
+      {
+        if (i > 0 && !Accept(','))
+          return Missing(mc_fmt::format("'{}' takes {} arguments", name, function->arguments));
+        const auto argument = ParseSum();
+        if (!argument)
+          return std::nullopt;
+        arguments[i] = *argument;
+      }
+      if (!Accept(')'))
+        return Missing(mc_fmt::format("Expected ')' to close the arguments of '{}'", name));
+      return Operation(function->op, arguments[0], arguments[1]);
+    }
+
+    std::optional<std::size_t> ParseNumber()
+    {
+      double value = 0.0;
+      const char* first = source_.data() + position_;
+      const auto [end, error] = std::from_chars(first, source_.data() + source_.size(), value);
+      if (error != std::errc{})
+        return Missing("Invalid number");
+      position_ += static_cast<std::size_t>(end - first);
+      // C++ floating-point literal suffixes
+      if (Peek() == 'f' || Peek() == 'F' || Peek() == 'l' || Peek() == 'L')
+        ++position_;
+      if (IsIdentifierChar(Peek()))
+        return Missing("Invalid number");
+      return Constant(value);
+    }
+
+    // Appends node's code, operands first
+    // @return The stack depth the node needs
+    std::size_t Emit(std::size_t node, Expression& expression) const
+    {
+      const Node& n = nodes_[node];
+      std::size_t depth = 1;
+      if (n.left != NO_NODE)
+        depth = Emit(n.left, expression);
+      if (n.right != NO_NODE)
+        depth = std::max(depth, Emit(n.right, expression) + 1);
+      expression.code_.push_back({ n.op, n.value });
+      if (n.op == Op::Pressure)
+        expression.uses_pressure_ = true;
+      return depth;
+    }
+  };
+
+  std::expected<Expression, ExpressionError> Expression::Compile(std::string_view source)
+  {
+    return ExpressionCompiler(source).Compile();
+  }
+
+  double Expression::Evaluate(double temperature, double pressure) const
+  {
+    std::array<double, MAX_STACK_DEPTH> stack;
+    std::size_t top = 0;
+    for (const Instruction& instruction : code_)
+    {
+      switch (instruction.op)
+      {
+        case Op::Constant: stack[top++] = instruction.value; break;
+        case Op::Temperature: stack[top++] = temperature; break;
+        case Op::Pressure: stack[top++] = pressure; break;
+        case Op::Negate:
+        case Op::Exp:
+        case Op::Log:
+        case Op::Log10:
+        case Op::Sqrt:
+        case Op::Abs: stack[top - 1] = ExpressionCompiler::Apply(instruction.op, stack[top - 1], 0.0); break;
+        default:
+          --top;
+          stack[top - 1] = ExpressionCompiler::Apply(instruction.op, stack[top - 1], stack[top]);
+          break;
+      }
+    }
+    return stack[0];
+  }
+
+  void Expression::Evaluate(std::span<const double> temperature, std::span<const double> pressure, std::span<double> values)
+      const
+  {
+    const std::size_t cells = temperature.size();
+    if ((uses_pressure_ && pressure.size() != cells) || values.size() != cells)
+      throw std::invalid_argument("the expression needs one temperature, pressure and output value per cell");
+    if (IsConstant())
+    {
+      std::fill(values.begin(), values.end(), code_.front().value);
+      return;
+    }
+
+    // Each stack slot holds a block of cells, and each instruction is a loop over the block.
+    std::vector<double> stack(stack_depth_ * CELL_BLOCK);
+    for (std::size_t first = 0; first < cells; first += CELL_BLOCK)
+    {
+      const std::size_t size = std::min(CELL_BLOCK, cells - first);
+      double* top = stack.data();
+      for (const Instruction& instruction : code_)
+      {
+        double* a = top - CELL_BLOCK;
+        double* b = top;
+        switch (instruction.op)
+        {
+          case Op::Constant:
+            std::fill_n(top, size, instruction.value);
+            top += CELL_BLOCK;
+            break;
+          case Op::Temperature:
+            std::copy_n(temperature.begin() + first, size, top);
+            top += CELL_BLOCK;
+            break;
+          case Op::Pressure:
+            std::copy_n(pressure.begin() + first, size, top);
+            top += CELL_BLOCK;
+            break;
+          case Op::Negate:
+            for (std::size_t c = 0; c < size; ++c)
+              a[c] = -a[c];
+            break;
+          case Op::Exp:
+            for (std::size_t c = 0; c < size; ++c)
+              a[c] = std::exp(a[c]);
+            break;
+          case Op::Log:
+            for (std::size_t c = 0; c < size; ++c)
+              a[c] = std::log(a[c]);
+            break;
+          case Op::Log10:
+            for (std::size_t c = 0; c < size; ++c)
+              a[c] = std::log10(a[c]);
+            break;
+          case Op::Sqrt:
+            for (std::size_t c = 0; c < size; ++c)
+              a[c] = std::sqrt(a[c]);
+            break;
+          case Op::Abs:
+            for (std::size_t c = 0; c < size; ++c)
+              a[c] = std::abs(a[c]);
+            break;
+          default:
+            // Binary operations pop b and replace a
+            top -= CELL_BLOCK;
+            a = top - CELL_BLOCK;
+            b = top;
+            switch (instruction.op)
+            {
+              case Op::Add:
+                for (std::size_t c = 0; c < size; ++c)
+                  a[c] += b[c];
+                break;
+              case Op::Subtract:
+                for (std::size_t c = 0; c < size; ++c)
+                  a[c] -= b[c];
+                break;
+              case Op::Multiply:
+                for (std::size_t c = 0; c < size; ++c)
+                  a[c] *= b[c];
+                break;
+              case Op::Divide:
+                for (std::size_t c = 0; c < size; ++c)
+                  a[c] /= b[c];
+                break;
+              default:
+                for (std::size_t c = 0; c < size; ++c)
+                  a[c] = ExpressionCompiler::Apply(instruction.op, a[c], b[c]);
+                break;
+            }
+            break;
+        }
+      }
+      std::copy_n(stack.data(), size, values.begin() + first);
+    }
+  }
+}  // namespace mechanism_configuration
@@ -0,0 +1,217 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/jacobian.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <set>
+#include <utility>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    using Graph = std::vector<std::vector<std::size_t>>;
+
+    SparsityPattern FromRows(std::vector<std::vector<std::size_t>>& rows)
+    {
+      SparsityPattern pattern;
+      pattern.offsets.reserve(rows.size() + 1);
+      for (auto& row : rows)
+      {
+        std::ranges::sort(row);
+        const auto [first, last] = std::ranges::unique(row);
+        row.erase(first, last);
+        pattern.indices.insert(pattern.indices.end(), row.begin(), row.end());
+        pattern.offsets.push_back(pattern.indices.size());
+      }
+      return pattern;
+    }
+
+    std::span<const std::size_t> Row(const SparsityPattern& pattern, std::size_t row)
+    {
+      return std::span(pattern.indices).subspan(pattern.offsets[row], pattern.offsets[row + 1] - pattern.offsets[row]);
+    }
+
+    // The structure of A + Aᵀ without the diagonal, each neighbour list sorted.
+    Graph SymmetricGraph(const SparsityPattern& pattern)
+    {
+      Graph neighbours(pattern.rows());
+      for (std::size_t i = 0; i < pattern.rows(); ++i)
+      {
+        for (std::size_t j : Row(pattern, i))
+        {
+          if (i == j)
+            continue;
+          neighbours[i].push_back(j);
+          neighbours[j].push_back(i);
+        }
+      }
+      for (auto& list : neighbours)
+      {
+        std::ranges::sort(list);
+        const auto [first, last] = std::ranges::unique(list);
+        list.erase(first, last);
+      }
+      return neighbours;
+    }
+
+    std::vector<std::size_t> MinimumDegree(Graph graph)
+    {
+      const std::size_t n = graph.size();
+      std::set<std::pair<std::size_t, std::size_t>> queue;  // (degree, node)
+      for (std::size_t v = 0; v < n; ++v)
+        queue.emplace(graph[v].size(), v);
+
+      std::vector<std::size_t> order;
+      order.reserve(n);
+      std::vector<std::size_t> merged;
+      while (!queue.empty())
+      {
+        const std::size_t v = queue.begin()->second;
+        queue.erase(queue.begin());
+        order.push_back(v);
+
+        // Eliminating v joins its remaining neighbours into a clique.
+        const std::vector<std::size_t> clique = std::move(graph[v]);
+        for (std::size_t u : clique)
+        {
+          queue.erase({ graph[u].size(), u });
+          merged.clear();
+          std::ranges::set_union(graph[u], clique, std::back_inserter(merged));
+          std::erase_if(merged, [u, v](std::size_t w) { return w == u || w == v; });
+          graph[u].swap(merged);
+          queue.emplace(graph[u].size(), u);
+        }
+      }
+      return order;
+    }
+
+    std::vector<std::size_t> ReverseCuthillMcKee(const Graph& graph)
+    {
+      const std::size_t n = graph.size();
+      std::vector<std::size_t> by_degree(n);
+      for (std::size_t v = 0; v < n; ++v)
+        by_degree[v] = v;
+      std::ranges::stable_sort(by_degree, {}, [&graph](std::size_t v) { return graph[v].size(); });
+
+      std::vector<std::size_t> order;
+      order.reserve(n);
+      std::vector<bool> visited(n, false);
+      std::vector<std::size_t> next;
+      // Each connected component is searched breadth first from its lowest-degree node.
+      for (std::size_t start : by_degree)
+      {
+        if (visited[start])
+          continue;
+        visited[start] = true;
+        order.push_back(start);
+        for (std::size_t head = order.size() - 1; head < order.size(); ++head)
+        {
+          next.clear();
+          for (std::size_t u : graph[order[head]])
+          {
+            if (!visited[u])
+            {
+              visited[u] = true;
+              next.push_back(u);
+            }
+          }
+          std::ranges::stable_sort(next, {}, [&graph](std::size_t v) { return graph[v].size(); });
+          order.insert(order.end(), next.begin(), next.end());
+        }
+      }
+      std::ranges::reverse(order);
+      return order;
+    }
+  }  // namespace
+
+  SparsityPattern BuildJacobianSparsity(const Stoichiometry& stoichiometry)
+  {
+    const CompressedMatrix& net = stoichiometry.net.by_reaction;
+    const CompressedMatrix& reactants = stoichiometry.reactants.by_reaction;
+
+    std::vector<std::vector<std::size_t>> rows(stoichiometry.species);
+    for (std::size_t i = 0; i < stoichiometry.species; ++i)
+      rows[i].push_back(i);
+    auto changes = [&](const CompressedMatrix& changed, std::size_t column, std::size_t reaction)
+    {
+      for (std::size_t k = changed.offsets[column]; k < changed.offsets[column + 1]; ++k)
+        for (std::size_t l = reactants.offsets[reaction]; l < reactants.offsets[reaction + 1]; ++l)
+          rows[changed.indices[k]].push_back(reactants.indices[l]);
+    };
+    for (std::size_t reaction = 0; reaction + 1 < net.offsets.size(); ++reaction)
+      changes(net, reaction, reaction);
+    // Branched reactions keep their products apart from `net`
+    for (std::size_t i = 0; i + 1 < stoichiometry.nitrate_products.by_reaction.offsets.size(); ++i)
+    {
+      changes(stoichiometry.nitrate_products.by_reaction, i, stoichiometry.order.branched + i);
+      changes(stoichiometry.alkoxy_products.by_reaction, i, stoichiometry.order.branched + i);
+    }
+    return FromRows(rows);
+  }
+
+  std::vector<std::size_t> OrderSpecies(const SparsityPattern& jacobian, SpeciesOrdering ordering)
+  {
+    Graph graph = SymmetricGraph(jacobian);
+    if (ordering == SpeciesOrdering::ReverseCuthillMcKee)
+      return ReverseCuthillMcKee(graph);
+    return MinimumDegree(std::move(graph));
+  }
+
+  SparsityPattern PermutePattern(const SparsityPattern& pattern, std::span<const std::size_t> order)
+  {
+    std::vector<std::size_t> position(order.size());
+    for (std::size_t k = 0; k < order.size(); ++k)
+      position[order[k]] = k;
+
+    std::vector<std::vector<std::size_t>> rows(order.size());
+    for (std::size_t k = 0; k < order.size(); ++k)
+      for (std::size_t j : Row(pattern, order[k]))
+        rows[k].push_back(position[j]);
+    return FromRows(rows);
+  }
+
+  SparsityPattern SymbolicLU(const SparsityPattern& pattern, std::span<const std::size_t> order)
+  {
+    const SparsityPattern permuted = PermutePattern(pattern, order);
+    const std::size_t n = permuted.rows();
+
+    // Row i of L + U is row i of A plus, for every k < i in it (including fill found on the
+    // way), the entries of row k of U. The k are taken in increasing order from a min-heap.
+    std::vector<std::vector<std::size_t>> upper(n);
+    std::vector<std::vector<std::size_t>> rows(n);
+    std::vector<std::size_t> marker(n, n);
+    std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<>> lower;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      auto& row = rows[i];
+      auto add = [&](std::size_t j)
+      {
+        if (marker[j] == i)
+          return;
+        marker[j] = i;
+        row.push_back(j);
+        if (j < i)
+          lower.push(j);
+      };
+      for (std::size_t j : Row(permuted, i))
+        add(j);
+      while (!lower.empty())
+      {
+        const std::size_t k = lower.top();
+        lower.pop();
+        for (std::size_t j : upper[k])
+          add(j);
+      }
+      for (std::size_t j : row)
+        if (j > i)
+          upper[i].push_back(j);
+    }
+    return FromRows(rows);
+  }
+}  // namespace mechanism_configuration
@@ -0,0 +1,58 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/location.hpp"
+
+#include <string_view>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    thread_local int line_origin = 0;
+    thread_local std::string_view source_text;
+  }  // namespace
+
+  ErrorLocation LocationOf(const YAML::Node& node)
+  {
+    return ErrorLocation{ node.Mark().line + line_origin, node.Mark().column };
+  }
+
+  std::string ExceptionMessage(const std::exception& e)
+  {
+    const auto* yaml_exception = dynamic_cast<const YAML::Exception*>(&e);
+    if (yaml_exception == nullptr || line_origin == 0 || yaml_exception->mark.is_null())
+      return e.what();
+    YAML::Mark mark = yaml_exception->mark;
+    mark.line += line_origin;
+    return YAML::Exception(mark, yaml_exception->msg).what();
+  }
+
+  ScopedLineOrigin::ScopedLineOrigin(int line)
+      : previous_(line_origin)
+  {
+    line_origin = line;
+  }
+
+  ScopedLineOrigin::~ScopedLineOrigin()
+  {
+    line_origin = previous_;
+  }
+
+  std::string_view SourceText()
+  {
+    return source_text;
+  }
+
+  ScopedSource::ScopedSource(std::string_view text)
+      : previous_(source_text)
+  {
+    source_text = text;
+  }
+
+  ScopedSource::~ScopedSource()
+  {
+    source_text = previous_;
+  }
+}  // namespace mechanism_configuration
@@ -0,0 +1,33 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/map_view.hpp"
+
+namespace mechanism_configuration
+{
+  MapView::MapView(const YAML::Node& node)
+      : node_(node)
+  {
+    if (!node.IsDefined() || !node.IsMap())
+      return;
+    entries_.reserve(node.size());
+    for (const auto& entry : node)
+    {
+      // The key's text lives in the document, which node_ keeps alive
+      const std::string& key = entry.first.Scalar();
+      entries_.push_back({ key, entry.second });
+    }
+  }
+
+  const YAML::Node& MapView::Undefined()
+  {
+    // yaml-cpp only makes undefined nodes for a missing key of a const map
+    static const YAML::Node undefined = []
+    {
+      const YAML::Node empty(YAML::NodeType::Map);
+      return YAML::Node(empty[""]);
+    }();
+    return undefined;
+  }
+}  // namespace mechanism_configuration
@@ -0,0 +1,561 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/error_format.hpp"
+#include "detail/stream.hpp"
+
+#include <mechanism_configuration/mapped.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    using mapped::ComponentRecord;
+    using mapped::RangeRecord;
+    using mapped::ReactionRecord;
+    using mapped::StringRecord;
+
+    // Every image starts with MAPPED_MAGIC, MAPPED_FORMAT_VERSION and BYTE_ORDER_MARK. Records are
+    // stored in the host's byte order, so an image is only opened on a host with the same one.
+    constexpr std::string_view MAPPED_MAGIC{ "MECHMAP\n", 8 };
+    constexpr std::uint32_t MAPPED_FORMAT_VERSION = 1;
+    constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    // The reaction arrays, in the order of the types::Reactions members.
+    enum ReactionKind : std::size_t
+    {
+      ARRHENIUS,
+      BRANCHED,
+      EMISSION,
+      FIRST_ORDER_LOSS,
+      PHOTOLYSIS,
+      SURFACE,
+      TAYLOR_SERIES,
+      TROE,
+      TERNARY_CHEMICAL_ACTIVATION,
+      TUNNELING,
+      USER_DEFINED,
+      LAMBDA_RATE_CONSTANT,
+      REACTION_KINDS
+    };
+
+    // How many rate parameters each kind of reaction has (Taylor series have at least this many).
+    constexpr std::array<std::uint32_t, REACTION_KINDS> PARAMETER_COUNTS{ 5, 4, 1, 1, 1, 1, 5, 8, 8, 3, 1, 0 };
+
+    // Kinds whose first component group is a single reactant rather than a list.
+    constexpr bool HasSingleReactant(std::size_t kind)
+    {
+      return kind == FIRST_ORDER_LOSS || kind == PHOTOLYSIS || kind == SURFACE;
+    }
+
+    struct SectionRecord
+    {
+      std::uint64_t offset;  // from the start of the image
+      std::uint64_t count;   // number of elements
+    };
+
+    struct MappedHeader
+    {
+      char magic[8];
+      std::uint32_t format_version;
+      std::uint32_t byte_order;
+      std::uint64_t image_size;
+      StringRecord name;
+      std::uint32_t version[3];
+      std::uint32_t reserved;
+      double relative_tolerance;
+      SectionRecord strings;
+      SectionRecord species;
+      SectionRecord components;
+      SectionRecord parameters;
+      SectionRecord reactions[REACTION_KINDS];
+    };
+
+    static_assert(std::is_trivially_copyable_v<MappedHeader> && std::is_trivially_copyable_v<ReactionRecord>);
+    static_assert(sizeof(ComponentRecord) == 24 && sizeof(ReactionRecord) == 56, "records must not be padded");
+
+    struct InvalidImage : std::runtime_error
+    {
+      using std::runtime_error::runtime_error;
+    };
+    struct UnsupportedFormatVersion : InvalidImage
+    {
+      using InvalidImage::InvalidImage;
+    };
+
+    std::uint32_t Index32(std::size_t value)
+    {
+      if (value > std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("the mechanism is too large for a mapped image");
+      return static_cast<std::uint32_t>(value);
+    }
+
+    // ----------------------------------------
+    // Writing
+    // ----------------------------------------
+
+    // Collects a mechanism into the flat arrays of an image.
+    class ImageBuilder
+    {
+     public:
+      explicit ImageBuilder(const Mechanism& mechanism)
+      {
+        header_.name = String(mechanism.name);
+        header_.version[0] = mechanism.version.major;
+        header_.version[1] = mechanism.version.minor;
+        header_.version[2] = mechanism.version.patch;
+        header_.relative_tolerance = mechanism.relative_tolerance;
+
+        for (const auto& species : mechanism.species)
+        {
+          species_index_.try_emplace(species.name, Index32(species_.size()));
+          species_.push_back(String(species.name));
+        }
+
+        const types::Reactions& reactions = mechanism.reactions;
+        for (const auto& r : reactions.arrhenius)
+          AddReaction(ARRHENIUS, r, Parameters({ r.A, r.B, r.C, r.D, r.E }), r.reactants, r.products);
+        for (const auto& r : reactions.branched)
+        {
+          auto& record = AddReaction(
+              BRANCHED, r, Parameters({ r.X, r.Y, r.a0, static_cast<double>(r.n) }), r.reactants, r.nitrate_products);
+          record.components[2] = Components(r.alkoxy_products);
+        }
+        for (const auto& r : reactions.emission)
+          AddReaction(EMISSION, r, Parameters({ r.scaling_factor }), {}, r.products);
+        for (const auto& r : reactions.first_order_loss)
+          AddReaction(FIRST_ORDER_LOSS, r, Parameters({ r.scaling_factor }), { r.reactants }, r.products);
+        for (const auto& r : reactions.photolysis)
+          AddReaction(PHOTOLYSIS, r, Parameters({ r.scaling_factor }), { r.reactants }, r.products);
+        for (const auto& r : reactions.surface)
+        {
+          auto& record = AddReaction(
+              SURFACE, r, Parameters({ r.reaction_probability }), { r.gas_phase_species }, r.gas_phase_products);
+          record.text = String(r.condensed_phase);
+        }
+        for (const auto& r : reactions.taylor_series)
+        {
+          const RangeRecord parameters = Parameters({ r.A, r.B, r.C, r.D, r.E }, r.taylor_coefficients);
+          AddReaction(TAYLOR_SERIES, r, parameters, r.reactants, r.products);
+        }
+        for (const auto& r : reactions.troe)
+          AddReaction(TROE, r, FalloffParameters(r), r.reactants, r.products);
+        for (const auto& r : reactions.ternary_chemical_activation)
+          AddReaction(TERNARY_CHEMICAL_ACTIVATION, r, FalloffParameters(r), r.reactants, r.products);
+        for (const auto& r : reactions.tunneling)
+          AddReaction(TUNNELING, r, Parameters({ r.A, r.B, r.C }), r.reactants, r.products);
+        for (const auto& r : reactions.user_defined)
+          AddReaction(USER_DEFINED, r, Parameters({ r.scaling_factor }), r.reactants, r.products);
+        for (const auto& r : reactions.lambda_rate_constant)
+        {
+          auto& record = AddReaction(LAMBDA_RATE_CONSTANT, r, Parameters({}), r.reactants, r.products);
+          record.text = String(r.lambda_function);
+        }
+      }
+
+      // The image: the header, then each array aligned to 8 bytes.
+      std::string Bytes()
+      {
+        std::string bytes(sizeof(MappedHeader), '\0');
+        auto append = [&bytes](const auto& values)
+        {
+          bytes.resize((bytes.size() + 7) / 8 * 8, '\0');
+          const SectionRecord section{ bytes.size(), values.size() };
+          bytes.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(values[0]));
+          return section;
+        };
+        header_.strings = append(strings_);
+        header_.species = append(species_);
+        header_.components = append(components_);
+        header_.parameters = append(parameters_);
+        for (std::size_t kind = 0; kind < REACTION_KINDS; ++kind)
+          header_.reactions[kind] = append(reactions_[kind]);
+
+        std::memcpy(header_.magic, MAPPED_MAGIC.data(), MAPPED_MAGIC.size());
+        header_.format_version = MAPPED_FORMAT_VERSION;
+        header_.byte_order = BYTE_ORDER_MARK;
+        header_.image_size = bytes.size();
+        std::memcpy(bytes.data(), &header_, sizeof(header_));
+        return bytes;
+      }
+
+     private:
+      // Strings are stored once, however many records refer to them.
+      StringRecord String(const std::string& value)
+      {
+        auto [interned, inserted] = interned_.try_emplace(value);
+        if (inserted)
+        {
+          interned->second = StringRecord{ Index32(strings_.size()), Index32(value.size()) };
+          strings_ += value;
+          Index32(strings_.size());
+        }
+        return interned->second;
+      }
+
+      RangeRecord Components(const std::vector<types::ReactionComponent>& components)
+      {
+        const RangeRecord range{ Index32(components_.size()), Index32(components.size()) };
+        for (const auto& component : components)
+        {
+          const auto species = species_index_.find(component.name);
+          components_.push_back(ComponentRecord{ String(component.name),
+                                                 species == species_index_.end() ? mapped::NO_SPECIES : species->second,
+                                                 0,
+                                                 component.coefficient });
+        }
+        return range;
+      }
+
+      RangeRecord Parameters(std::initializer_list<double> values, const std::vector<double>& more = {})
+      {
+        const RangeRecord range{ Index32(parameters_.size()), Index32(values.size() + more.size()) };
+        parameters_.insert(parameters_.end(), values);
+        parameters_.insert(parameters_.end(), more.begin(), more.end());
+        return range;
+      }
+
+      template<typename Falloff>
+      RangeRecord FalloffParameters(const Falloff& r)
+      {
+        return Parameters({ r.k0_A, r.k0_B, r.k0_C, r.kinf_A, r.kinf_B, r.kinf_C, r.Fc, r.N });
+      }
+
+      template<typename Reaction>
+      ReactionRecord& AddReaction(
+          ReactionKind kind,
+          const Reaction& reaction,
+          RangeRecord parameters,
+          const std::vector<types::ReactionComponent>& reactants,
+          const std::vector<types::ReactionComponent>& products)
+      {
+        ReactionRecord record{};
+        record.name = String(reaction.name);
+        record.gas_phase = String(reaction.gas_phase);
+        record.parameters = parameters;
+        record.components[0] = Components(reactants);
+        record.components[1] = Components(products);
+        Index32(reactions_[kind].size() + 1);
+        return reactions_[kind].emplace_back(record);
+      }
+
+      MappedHeader header_{};
+      std::string strings_;
+      std::unordered_map<std::string, StringRecord> interned_;
+      std::unordered_map<std::string, std::uint32_t> species_index_;
+      std::vector<StringRecord> species_;
+      std::vector<ComponentRecord> components_;
+      std::vector<double> parameters_;
+      std::array<std::vector<ReactionRecord>, REACTION_KINDS> reactions_;
+    };
+
+    // ----------------------------------------
+    // Mapping
+    // ----------------------------------------
+
+    // A whole file mapped read-only and shared, so every process mapping it uses the same pages.
+    class FileMapping
+    {
+     public:
+      explicit FileMapping(const std::filesystem::path& path)
+      {
+        try
+        {
+          Map(path);
+        }
+        catch (...)
+        {
+          Release();
+          throw;
+        }
+      }
+
+      ~FileMapping()
+      {
+        Release();
+      }
+
+      FileMapping(const FileMapping&) = delete;
+      FileMapping& operator=(const FileMapping&) = delete;
+
+      const char* data() const
+      {
+        return data_;
+      }
+      std::size_t size() const
+      {
+        return size_;
+      }
+
+     private:
+#ifdef _WIN32
+      void Map(const std::filesystem::path& path)
+      {
+        file_ = CreateFileW(
+            path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE)
+          throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "cannot open the file");
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file_, &size))
+          throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "cannot read the file size");
+        size_ = static_cast<std::size_t>(size.QuadPart);
+        if (size_ == 0)
+          return;  // an empty file cannot be mapped, and is not a valid image anyway
+        mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr)
+          throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "cannot map the file");
+        data_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_ == nullptr)
+          throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "cannot map the file");
+      }
+
+      void Release() noexcept
+      {
+        if (data_ != nullptr)
+          UnmapViewOfFile(data_);
+        if (mapping_ != nullptr)
+          CloseHandle(mapping_);
+        if (file_ != INVALID_HANDLE_VALUE)
+          CloseHandle(file_);
+        data_ = nullptr;
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+      }
+
+      HANDLE file_{ INVALID_HANDLE_VALUE };
+      HANDLE mapping_{ nullptr };
+#else
+      void Map(const std::filesystem::path& path)
+      {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+          throw std::system_error(errno, std::generic_category(), "cannot open the file");
+        struct stat status;
+        if (::fstat(fd, &status) != 0)
+        {
+          const int error = errno;
+          ::close(fd);
+          throw std::system_error(error, std::generic_category(), "cannot read the file size");
+        }
+        size_ = static_cast<std::size_t>(status.st_size);
+        if (size_ == 0)
+        {
+          ::close(fd);
+          return;  // an empty file cannot be mapped, and is not a valid image anyway
+        }
+        void* data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+        const int error = errno;
+        ::close(fd);  // the mapping keeps the file open
+        if (data == MAP_FAILED)
+          throw std::system_error(error, std::generic_category(), "cannot map the file");
+        data_ = static_cast<const char*>(data);
+      }
+
+      void Release() noexcept
+      {
+        if (data_ != nullptr)
+          ::munmap(const_cast<char*>(data_), size_);
+        data_ = nullptr;
+      }
+#endif
+
+      const char* data_{ nullptr };
+      std::size_t size_{ 0 };
+    };
+
+    // ----------------------------------------
+    // Validation
+    // ----------------------------------------
+    //
+    // Open checks every offset in the image once, so the views can then read it without any
+    // bounds checks.
+
+    template<typename T>
+    const T* Section(const FileMapping& file, const SectionRecord& section, std::string_view what)
+    {
+      if (section.offset % alignof(T) != 0 || section.offset > file.size() ||
+          section.count > (file.size() - section.offset) / sizeof(T))
+        throw InvalidImage(mc_fmt::format("the {} array is out of bounds", what));
+      return reinterpret_cast<const T*>(file.data() + section.offset);
+    }
+
+    void CheckString(const StringRecord& string, std::uint64_t strings_size)
+    {
+      if (string.offset > strings_size || string.size > strings_size - string.offset)
+        throw InvalidImage("a string is out of bounds");
+    }
+
+    void CheckRange(const RangeRecord& range, std::uint64_t count, std::string_view what)
+    {
+      if (range.begin > count || range.count > count - range.begin)
+        throw InvalidImage(mc_fmt::format("a range of {} is out of bounds", what));
+    }
+
+    void CheckReactions(std::size_t kind, const ReactionRecord* records, const MappedHeader& header)
+    {
+      for (std::size_t i = 0; i < header.reactions[kind].count; ++i)
+      {
+        const ReactionRecord& record = records[i];
+        CheckString(record.name, header.strings.count);
+        CheckString(record.gas_phase, header.strings.count);
+        CheckString(record.text, header.strings.count);
+        CheckRange(record.parameters, header.parameters.count, "rate parameters");
+        for (const auto& components : record.components)
+          CheckRange(components, header.components.count, "reaction components");
+
+        const bool parameters_match = kind == TAYLOR_SERIES ? record.parameters.count >= PARAMETER_COUNTS[kind]
+                                                            : record.parameters.count == PARAMETER_COUNTS[kind];
+        if (!parameters_match)
+          throw InvalidImage("a reaction has the wrong number of rate parameters");
+        if (HasSingleReactant(kind) && record.components[0].count != 1)
+          throw InvalidImage("a reaction has the wrong number of reactants");
+      }
+    }
+  }  // namespace
+
+  struct MappedMechanism::Mapping
+  {
+    explicit Mapping(const std::filesystem::path& path)
+        : file(path)
+    {
+    }
+
+    FileMapping file;
+    mapped::ImageArrays arrays;
+  };
+
+  std::expected<MappedMechanism, Errors> MappedMechanism::Open(const std::filesystem::path& path)
+  {
+    auto failure = [&](ErrorCode code, const std::string& message)
+    {
+      return std::unexpected(
+          Errors{ { code, mc_fmt::format("Failed to open mapped mechanism '{}': {}", path.string(), message) } });
+    };
+    std::error_code exists_error;
+    if (!std::filesystem::is_regular_file(path, exists_error))
+      return failure(ErrorCode::FileNotFound, "the file does not exist or is not a regular file");
+
+    try
+    {
+      auto mapping = std::make_shared<Mapping>(path);
+      const FileMapping& file = mapping->file;
+
+      MappedHeader header;
+      if (file.size() < sizeof(header))
+        throw InvalidImage("not a mapped mechanism");
+      std::memcpy(&header, file.data(), sizeof(header));
+      if (std::string_view(header.magic, sizeof(header.magic)) != MAPPED_MAGIC)
+        throw InvalidImage("not a mapped mechanism");
+      if (header.format_version != MAPPED_FORMAT_VERSION)
+      {
+        throw UnsupportedFormatVersion(mc_fmt::format(
+            "image format version {} is not supported (expected {})", header.format_version, MAPPED_FORMAT_VERSION));
+      }
+      if (header.byte_order != BYTE_ORDER_MARK)
+        throw InvalidImage("the image was written on a host with a different byte order");
+      if (header.image_size != file.size())
+        throw InvalidImage("the image is truncated");
+
+      mapped::ImageArrays& arrays = mapping->arrays;
+      arrays.strings = Section<char>(file, header.strings, "string");
+      arrays.components = Section<ComponentRecord>(file, header.components, "component");
+      arrays.parameters = Section<double>(file, header.parameters, "parameter");
+      const auto* species = Section<StringRecord>(file, header.species, "species");
+      std::array<const ReactionRecord*, REACTION_KINDS> reactions;
+      for (std::size_t kind = 0; kind < REACTION_KINDS; ++kind)
+        reactions[kind] = Section<ReactionRecord>(file, header.reactions[kind], "reaction");
+
+      CheckString(header.name, header.strings.count);
+      for (std::size_t i = 0; i < header.species.count; ++i)
+        CheckString(species[i], header.strings.count);
+      for (std::size_t i = 0; i < header.components.count; ++i)
+      {
+        const ComponentRecord& component = arrays.components[i];
+        CheckString(component.name, header.strings.count);
+        if (component.species != mapped::NO_SPECIES && component.species >= header.species.count)
+          throw InvalidImage("a reaction component refers to an unknown species");
+      }
+      for (std::size_t kind = 0; kind < REACTION_KINDS; ++kind)
+        CheckReactions(kind, reactions[kind], header);
+
+      MappedMechanism mechanism;
+      mechanism.name_ = arrays.String(header.name);
+      mechanism.version_ = Version(header.version[0], header.version[1], header.version[2]);
+      mechanism.relative_tolerance_ = header.relative_tolerance;
+      mechanism.species_ = mapped::Range<mapped::Species>(&arrays, species, header.species.count);
+
+      auto range = [&]<typename View>(ReactionKind kind, mapped::Range<View>& out)
+      {
+        out = mapped::Range<View>(&arrays, reactions[kind], header.reactions[kind].count);
+      };
+      mapped::Reactions& r = mechanism.reactions_;
+      range(ARRHENIUS, r.arrhenius);
+      range(BRANCHED, r.branched);
+      range(EMISSION, r.emission);
+      range(FIRST_ORDER_LOSS, r.first_order_loss);
+      range(PHOTOLYSIS, r.photolysis);
+      range(SURFACE, r.surface);
+      range(TAYLOR_SERIES, r.taylor_series);
+      range(TROE, r.troe);
+      range(TERNARY_CHEMICAL_ACTIVATION, r.ternary_chemical_activation);
+      range(TUNNELING, r.tunneling);
+      range(USER_DEFINED, r.user_defined);
+      range(LAMBDA_RATE_CONSTANT, r.lambda_rate_constant);
+
+      mechanism.mapping_ = std::move(mapping);
+      return mechanism;
+    }
+    catch (const UnsupportedFormatVersion& e)
+    {
+      return failure(ErrorCode::InvalidVersion, e.what());
+    }
+    catch (const std::exception& e)
+    {
+      return failure(ErrorCode::UnexpectedError, e.what());
+    }
+  }
+
+  Errors SaveMappedImage(const Mechanism& mechanism, const std::filesystem::path& path)
+  {
+    try
+    {
+      WriteFileAtomically(path, ImageBuilder(mechanism).Bytes());
+      return {};
+    }
+    catch (const std::exception& e)
+    {
+      return { { ErrorCode::UnexpectedError,
+                 mc_fmt::format("Failed to save mapped mechanism '{}': {}", path.string(), e.what()) } };
+    }
+  }
+}  // namespace mechanism_configuration
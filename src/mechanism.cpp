@@ -0,0 +1,183 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/mechanism.hpp>
+
+#include <variant>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    // Sets the species and phase indices of every entry from its names.
+    class IndexAssigner
+    {
+     public:
+      explicit IndexAssigner(const types::Symbols& symbols)
+          : species_(symbols.species),
+            phases_(symbols.phases)
+      {
+      }
+
+      void operator()(std::vector<types::ReactionComponent>& components) const
+      {
+        for (auto& component : components)
+          (*this)(component);
+      }
+
+      void operator()(types::ReactionComponent& component) const
+      {
+        component.species_index = species_.IndexOf(component.name);
+      }
+
+      void operator()(types::Phase& phase) const
+      {
+        for (auto& species : phase.species)
+          species.species_index = species_.IndexOf(species.name);
+      }
+
+      // Every reaction type has reactants and/or products and a gas phase; the few that name
+      // their components differently are handled below.
+      template<typename Reaction>
+      void operator()(Reaction& reaction) const
+      {
+        reaction.gas_phase_index = phases_.IndexOf(reaction.gas_phase);
+        if constexpr (requires { reaction.reactants; })
+          (*this)(reaction.reactants);
+        if constexpr (requires { reaction.products; })
+          (*this)(reaction.products);
+      }
+
+      void operator()(types::Branched& reaction) const
+      {
+        reaction.gas_phase_index = phases_.IndexOf(reaction.gas_phase);
+        (*this)(reaction.reactants);
+        (*this)(reaction.nitrate_products);
+        (*this)(reaction.alkoxy_products);
+      }
+
+      void operator()(types::Surface& reaction) const
+      {
+        reaction.gas_phase_index = phases_.IndexOf(reaction.gas_phase);
+        reaction.condensed_phase_index = phases_.IndexOf(reaction.condensed_phase);
+        (*this)(reaction.gas_phase_species);
+        (*this)(reaction.gas_phase_products);
+      }
+
+      template<typename Reaction>
+      void operator()(std::vector<Reaction>& reactions) const
+      {
+        for (auto& reaction : reactions)
+          (*this)(reaction);
+      }
+
+      void operator()(types::Representation& representation) const
+      {
+        std::visit(
+            [this](auto& r)
+            {
+              r.phase_indices.clear();
+              for (const auto& phase : r.phases)
+                r.phase_indices.push_back(phases_.IndexOf(phase));
+            },
+            representation);
+      }
+
+      void operator()(types::Process& process) const
+      {
+        std::visit([this](auto& p) { Aerosol(p); }, process);
+      }
+
+      void operator()(types::Constraint& constraint) const
+      {
+        std::visit([this](auto& c) { Aerosol(c); }, constraint);
+      }
+
+     private:
+      template<typename Dissolved>
+      void Aerosol(Dissolved& entry) const
+      {
+        entry.phase_index = phases_.IndexOf(entry.phase);
+        entry.solvent_index = species_.IndexOf(entry.solvent);
+        (*this)(entry.reactants);
+        (*this)(entry.products);
+      }
+
+      void Aerosol(types::DissolvedEquilibrium& entry) const
+      {
+        entry.phase_index = phases_.IndexOf(entry.phase);
+        entry.algebraic_species_index = species_.IndexOf(entry.algebraic_species);
+        entry.solvent_index = species_.IndexOf(entry.solvent);
+        (*this)(entry.reactants);
+        (*this)(entry.products);
+      }
+
+      // HenrysLawPhaseTransfer and HenrysLawEquilibrium
+      template<typename HenrysLaw>
+        requires requires(HenrysLaw h) { h.gas_species; }
+      void Aerosol(HenrysLaw& entry) const
+      {
+        entry.gas_phase_index = phases_.IndexOf(entry.gas_phase);
+        entry.gas_species_index = species_.IndexOf(entry.gas_species);
+        entry.condensed_phase_index = phases_.IndexOf(entry.condensed_phase);
+        entry.condensed_species_index = species_.IndexOf(entry.condensed_species);
+        entry.solvent_index = species_.IndexOf(entry.solvent);
+      }
+
+      void Aerosol(types::LinearConstraint& entry) const
+      {
+        entry.algebraic_phase_index = phases_.IndexOf(entry.algebraic_phase);
+        entry.algebraic_species_index = species_.IndexOf(entry.algebraic_species);
+        for (auto& term : entry.terms)
+        {
+          term.phase_index = phases_.IndexOf(term.phase);
+          term.species_index = species_.IndexOf(term.name);
+        }
+      }
+
+      const types::SymbolTable& species_;
+      const types::SymbolTable& phases_;
+    };
+  }  // namespace
+
+  void AssignIndices(Mechanism& mechanism)
+  {
+    types::Symbols& symbols = mechanism.symbols;
+    symbols.species.clear();
+    symbols.phases.clear();
+    for (const auto& species : mechanism.species)
+      symbols.species.Append(species.name);
+    for (const auto& phase : mechanism.phases)
+      symbols.phases.Append(phase.name);
+
+    const IndexAssigner assign(symbols);
+    for (auto& phase : mechanism.phases)
+      assign(phase);
+
+    types::Reactions& r = mechanism.reactions;
+    assign(r.arrhenius);
+    assign(r.branched);
+    assign(r.emission);
+    assign(r.first_order_loss);
+    assign(r.photolysis);
+    assign(r.surface);
+    assign(r.taylor_series);
+    assign(r.troe);
+    assign(r.ternary_chemical_activation);
+    assign(r.tunneling);
+    assign(r.user_defined);
+    assign(r.lambda_rate_constant);
+
+    if (mechanism.aerosol)
+    {
+      for (auto& representation : mechanism.aerosol->representations)
+        assign(representation);
+      for (auto& process : mechanism.aerosol->processes)
+        assign(process);
+      for (auto& constraint : mechanism.aerosol->constraints)
+        assign(constraint);
+    }
+  }
+}  // namespace mechanism_configuration
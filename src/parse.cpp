@@ -2,7 +2,12 @@
 //                         University of Illinois at Urbana-Champaign
 // SPDX-License-Identifier: Apache-2.0
 
+#include "detail/compiled.hpp"
 #include "detail/error_format.hpp"
+#include "detail/location.hpp"
+#include "detail/parallel.hpp"
+#include "detail/parse_stats.hpp"
+#include "detail/stream.hpp"
 #include "detail/v0/parser.hpp"
 #include "detail/v1/parser.hpp"
 
@@ -14,6 +19,10 @@
 
 #include <filesystem>
 #include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace mechanism_configuration
@@ -26,7 +35,98 @@ namespace mechanism_configuration
     std::optional<ErrorLocation> location;
   };
 
-  std::expected<DetectedVersion, Errors> GetVersion(const std::filesystem::path& config_path)
+  // Reads the dispatch version out of an already-loaded root document. The version field is
+  // version-agnostic (it's how we dispatch), so read it literally rather than depending on any
+  // version's key vocabulary.
+  DetectedVersion GetVersion(const YAML::Node& object)
+  {
+    if (!object["version"])
+    {
+      // assume it's a v0 config
+      return DetectedVersion{ Version(0, 0, 0), std::nullopt };
+    }
+
+    const YAML::Node version_node = object["version"];
+    return DetectedVersion{ Version(version_node.as<std::string>()),
+                            ErrorLocation{ version_node.Mark().line, version_node.Mark().column } };
+  }
+
+  // True when a document scanned out of its text declares a v1 version. Scanning stops at the
+  // version field, so this does not build the document tree.
+  bool IsV1Document(std::string_view content)
+  {
+    try
+    {
+      const std::optional<TopLevelScalar> version = FindTopLevelScalar(content, "version");
+      return version && Version(version->value).major == 1;
+    }
+    catch (const std::exception&)
+    {
+      // Let the regular path report malformed documents and versions.
+      return false;
+    }
+  }
+
+  template<typename Object>
+  void ResetUnknownPropertiesIds(std::vector<Object>& objects);
+
+  // Resets the unknown properties id of an object, and of each component or phase species it
+  // holds, to types::NO_PROPERTIES.
+  template<typename Object>
+  void ResetUnknownPropertiesIds(Object& object)
+  {
+    object.unknown_properties_id = types::NO_PROPERTIES;
+    if constexpr (requires { object.species; })
+      ResetUnknownPropertiesIds(object.species);
+    if constexpr (requires { object.reactants; })
+      ResetUnknownPropertiesIds(object.reactants);
+    if constexpr (requires { object.products; })
+      ResetUnknownPropertiesIds(object.products);
+    if constexpr (requires { object.nitrate_products; })
+      ResetUnknownPropertiesIds(object.nitrate_products);
+    if constexpr (requires { object.alkoxy_products; })
+      ResetUnknownPropertiesIds(object.alkoxy_products);
+    if constexpr (requires { object.gas_phase_species; })
+      ResetUnknownPropertiesIds(object.gas_phase_species);
+    if constexpr (requires { object.gas_phase_products; })
+      ResetUnknownPropertiesIds(object.gas_phase_products);
+  }
+
+  template<typename Object>
+  void ResetUnknownPropertiesIds(std::vector<Object>& objects)
+  {
+    for (auto& object : objects)
+      ResetUnknownPropertiesIds(object);
+  }
+
+  // Drops the unknown properties of a mechanism, as if it had been parsed without collecting them.
+  void DropUnknownProperties(Mechanism& mechanism)
+  {
+    mechanism.unknown_properties = {};
+    ResetUnknownPropertiesIds(mechanism.species);
+    ResetUnknownPropertiesIds(mechanism.phases);
+    auto& reactions = mechanism.reactions;
+    ResetUnknownPropertiesIds(reactions.arrhenius);
+    ResetUnknownPropertiesIds(reactions.branched);
+    ResetUnknownPropertiesIds(reactions.emission);
+    ResetUnknownPropertiesIds(reactions.first_order_loss);
+    ResetUnknownPropertiesIds(reactions.photolysis);
+    ResetUnknownPropertiesIds(reactions.surface);
+    ResetUnknownPropertiesIds(reactions.taylor_series);
+    ResetUnknownPropertiesIds(reactions.troe);
+    ResetUnknownPropertiesIds(reactions.ternary_chemical_activation);
+    ResetUnknownPropertiesIds(reactions.tunneling);
+    ResetUnknownPropertiesIds(reactions.user_defined);
+    ResetUnknownPropertiesIds(reactions.lambda_rate_constant);
+    if (mechanism.emissions)
+      ResetUnknownPropertiesIds(mechanism.emissions->sources);
+  }
+
+  // Parses the configuration at config_path, recording in `sources` every file it was read from.
+  std::expected<Mechanism, Errors> ParseFile(
+      const std::filesystem::path& config_path,
+      const ParseOptions& options,
+      std::vector<std::filesystem::path>& sources)
   {
     if (!std::filesystem::exists(config_path))
     {
@@ -34,15 +134,36 @@ namespace mechanism_configuration
           { ErrorCode::FileNotFound, mc_fmt::format("Configuration file '{}' does not exist.", config_path.string()) } });
     }
 
-    if (std::filesystem::exists(config_path) && std::filesystem::is_directory(config_path))
+    // A directory is always a version-0 (CAMP) configuration; there is no root document to load.
+    if (std::filesystem::is_directory(config_path))
     {
-      return DetectedVersion{ Version(0, 0, 0), std::nullopt };
+      v0::Parser parser{ options };
+      auto mechanism = parser.Parse(config_path);
+      sources = parser.SourceFiles();
+      return mechanism;
     }
 
+    // Load the root document exactly once: the detected version and the version-specific
+    // parser both work from this node, so large mechanisms are not parsed twice. Its text is kept
+    // as the ScopedSource while it is parsed. Streaming only applies to v1 documents; anything
+    // else is loaded from the text already read rather than read again.
+    std::string content;
     YAML::Node object;
+    bool stream = false;
     try
     {
-      object = YAML::LoadFile(config_path.string());
+      if (options.stream_reactions)
+      {
+        std::optional<std::string> text = ReadFileContents(config_path, options.observer);
+        if (!text)
+          throw YAML::BadFile(config_path.string());
+        content = std::move(*text);
+        stream = IsV1Document(content);
+        if (!stream)
+          object = LoadDocument(content, options.observer, config_path);
+      }
+      else
+        object = LoadFile(config_path, options.observer, content);
     }
     catch (const YAML::Exception& e)
     {
@@ -50,53 +171,73 @@ namespace mechanism_configuration
           { ErrorCode::UnexpectedError, mc_fmt::format("Failed to parse '{}': {}", config_path.string(), e.what()) } });
     }
 
-    // The version field is version-agnostic (it's how we dispatch), so read it literally
-    // rather than depending on any version's key vocabulary.
-    if (!object["version"])
-    {
-      // assume it's a v0 config
-      return DetectedVersion{ Version(0, 0, 0), std::nullopt };
-    }
-
-    const YAML::Node version_node = object["version"];
-    return DetectedVersion{ Version(version_node.as<std::string>()),
-                            ErrorLocation{ version_node.Mark().line, version_node.Mark().column } };
-  }
-
-  std::expected<Mechanism, Errors> Parse(const std::filesystem::path& config_path)
-  {
-    auto version = GetVersion(config_path);
+    if (stream)
+      return v1::Parser{ options }.ParseStreaming(std::move(content), config_path, &sources);
 
-    if (!version)
-    {
-      return std::unexpected(std::move(version.error()));
-    }
+    const ScopedSource source(content);
+    const DetectedVersion version = GetVersion(object);
 
-    switch (version->version.major)
+    switch (version.version.major)
     {
-      case 0: return v0::Parser{}.Parse(config_path);
-      case 1: return v1::Parser{}.Parse(config_path);
+      case 0:
+      {
+        v0::Parser parser{ options };
+        auto mechanism = parser.Parse(config_path, object);
+        sources = parser.SourceFiles();
+        return mechanism;
+      }
+      case 1:
+      {
+        return v1::Parser{ options }.Parse(object, config_path, &sources);
+      }
       default:
       {
         // We only reach here after reading the version out of config_path, so it names a real
         // file and the version field has a location; point the error at it (path:line:col).
         const std::string body =
-            version->location
+            version.location
                 ? mc_fmt::format(
-                      "{} error: Unsupported version number '{}'.", *version->location, version->version.to_string())
-                : mc_fmt::format("error: Unsupported version number '{}'.", version->version.to_string());
+                      "{} error: Unsupported version number '{}'.", *version.location, version.version.to_string())
+                : mc_fmt::format("error: Unsupported version number '{}'.", version.version.to_string());
         return std::unexpected(Errors{ { ErrorCode::InvalidVersion, config_path.string() + ":" + body } });
       }
     }
   }
 
-  std::expected<Mechanism, Errors> ParseFromString(const std::string& config)
+  std::expected<Mechanism, Errors> Parse(const std::filesystem::path& config_path, const ParseOptions& options)
+  {
+    if (options.cache_path.empty())
+    {
+      std::vector<std::filesystem::path> sources;
+      return ParseFile(config_path, options, sources);
+    }
+
+    // Cached images always carry the unknown properties; drop them if they were not asked for.
+    if (std::optional<Mechanism> cached = LoadCachedMechanism(options.cache_path, config_path))
+    {
+      if (!options.collect_unknown_properties)
+        DropUnknownProperties(*cached);
+      return std::move(*cached);
+    }
+
+    std::vector<std::filesystem::path> sources;
+    auto mechanism = ParseFile(config_path, options, sources);
+    // Only cache complete mechanisms, so a cached image never lacks the unknown properties.
+    if (mechanism && options.collect_unknown_properties)
+      SaveCachedMechanism(options.cache_path, config_path, sources, *mechanism);
+    return mechanism;
+  }
+
+  std::expected<Mechanism, Errors> ParseFromString(const std::string& config, const ParseOptions& options)
   {
+    if (options.stream_reactions && IsV1Document(config))
+      return v1::Parser{ options }.ParseStreaming(config);
+
     // only v1 supports parsing from a string, so we must first detect the version from the string
     YAML::Node object;
     try
     {
-      object = YAML::Load(config);
+      object = LoadDocument(config, options.observer);
       if (!object["version"])
       {
         return std::unexpected(Errors{ { ErrorCode::InvalidVersion, "error: Unsupported version number '0.0.0'." } });
@@ -107,7 +248,8 @@ namespace mechanism_configuration
         return std::unexpected(Errors{
             { ErrorCode::InvalidVersion, mc_fmt::format("error: Unsupported version number '{}'.", version.to_string()) } });
       }
-      return v1::Parser{}.Parse(config);
+      const ScopedSource source(config);
+      return v1::Parser{ options }.Parse(object);
     }
     catch (const YAML::Exception& e)
     {
@@ -116,4 +258,26 @@ namespace mechanism_configuration
     }
   }
 
+  std::vector<std::expected<Mechanism, Errors>> ParseMany(
+      std::span<const std::filesystem::path> config_paths,
+      const ParseOptions& options)
+  {
+    std::vector<std::expected<Mechanism, Errors>> mechanisms(config_paths.size());
+    ParallelFor(
+        config_paths.size(),
+        [&](std::size_t i)
+        {
+          try
+          {
+            mechanisms[i] = Parse(config_paths[i], options);
+          }
+          catch (const std::exception& e)
+          {
+            const std::string message = mc_fmt::format("Failed to parse '{}': {}", config_paths[i].string(), e.what());
+            mechanisms[i] = std::unexpected(Errors{ { ErrorCode::UnexpectedError, message } });
+          }
+        });
+    return mechanisms;
+  }
+
 }  // namespace mechanism_configuration
@@ -0,0 +1,172 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/parse_stats.hpp"
+
+#include "detail/stream.hpp"
+
+#include <mechanism_configuration/parse_stats.hpp>
+
+#include <yaml-cpp/yaml.h>
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+  #include <sys/resource.h>
+#endif
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    // The process's peak resident memory so far, or 0 where it cannot be read
+    std::size_t PeakMemoryBytes()
+    {
+#ifdef _WIN32
+      return 0;
+#else
+      rusage usage{};
+      if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+  #ifdef __APPLE__
+      return static_cast<std::size_t>(usage.ru_maxrss);  // bytes
+  #else
+      return static_cast<std::size_t>(usage.ru_maxrss) * 1024;  // kilobytes
+  #endif
+#endif
+    }
+  }  // namespace
+
+  std::string ParseStageToString(ParseStage stage)
+  {
+    switch (stage)
+    {
+      case ParseStage::ReadFile: return "ReadFile";
+      case ParseStage::LoadDocument: return "LoadDocument";
+      case ParseStage::StreamReactions: return "StreamReactions";
+      case ParseStage::ResolveFiles: return "ResolveFiles";
+      case ParseStage::CheckSchema: return "CheckSchema";
+      case ParseStage::ValidateSemantics: return "ValidateSemantics";
+      case ParseStage::Build: return "Build";
+      default: return "Unknown";
+    }
+  }
+
+  void ParseStats::OnStage(const ParseStageStats& stats)
+  {
+    std::lock_guard lock(mutex_);
+    stages_.push_back(stats);
+  }
+
+  std::vector<ParseStageStats> ParseStats::Stages() const
+  {
+    std::lock_guard lock(mutex_);
+    return stages_;
+  }
+
+  std::chrono::nanoseconds ParseStats::WallTime(ParseStage stage) const
+  {
+    std::lock_guard lock(mutex_);
+    std::chrono::nanoseconds total{ 0 };
+    for (const auto& stats : stages_)
+      if (stats.stage == stage)
+        total += stats.wall_time;
+    return total;
+  }
+
+  StageTimer::StageTimer(ParseObserver* observer, ParseStage stage, const std::filesystem::path& file)
+      : observer_(observer),
+        stage_(stage)
+  {
+    if (!observer_)
+      return;
+    file_ = file;
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  void StageTimer::Stop()
+  {
+    if (observer_)
+      stop_ = std::chrono::steady_clock::now();
+  }
+
+  StageTimer::~StageTimer()
+  {
+    if (!observer_)
+      return;
+    if (stop_ == std::chrono::steady_clock::time_point{})
+      Stop();
+    ParseStageStats stats{ .stage = stage_,
+                           .file = std::move(file_),
+                           .wall_time = stop_ - start_,
+                           .bytes = bytes,
+                           .nodes = nodes,
+                           .peak_memory_bytes = PeakMemoryBytes() };
+    observer_->OnStage(stats);
+  }
+
+  std::size_t CountNodes(const YAML::Node& node)
+  {
+    std::size_t count = 1;
+    if (node.IsSequence())
+    {
+      for (const auto& item : node)
+        count += CountNodes(item);
+    }
+    else if (node.IsMap())
+    {
+      for (const auto& entry : node)
+        count += CountNodes(entry.first) + CountNodes(entry.second);
+    }
+    return count;
+  }
+
+  std::optional<std::string> ReadFileContents(const std::filesystem::path& path, ParseObserver* observer)
+  {
+    StageTimer timer(observer, ParseStage::ReadFile, path);
+    std::optional<std::string> content = ReadFileContents(path);
+    if (timer && content)
+      timer.bytes = content->size();
+    return content;
+  }
+
+  YAML::Node LoadDocument(const std::string& content, ParseObserver* observer, const std::filesystem::path& file)
+  {
+    StageTimer timer(observer, ParseStage::LoadDocument, file);
+    YAML::Node document = YAML::Load(content);
+    if (timer)
+    {
+      timer.Stop();
+      timer.bytes = content.size();
+      timer.nodes = CountNodes(document);
+    }
+    return document;
+  }
+
+  YAML::Node LoadFile(const std::filesystem::path& path, ParseObserver* observer)
+  {
+    if (!observer)
+      return YAML::LoadFile(path.string());
+    std::optional<std::string> content = ReadFileContents(path, observer);
+    if (!content)
+      throw YAML::BadFile(path.string());
+    return LoadDocument(*content, observer, path);
+  }
+
+  YAML::Node LoadFile(const std::filesystem::path& path, ParseObserver* observer, std::string& content)
+  {
+    std::optional<std::string> text = ReadFileContents(path, observer);
+    if (!text)
+      throw YAML::BadFile(path.string());
+    content = std::move(*text);
+    return LoadDocument(content, observer, path);
+  }
+}  // namespace mechanism_configuration
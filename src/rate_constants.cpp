@@ -0,0 +1,685 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/constants.hpp"
+
+// The default rate table resolution, set at build time
+#ifndef MECH_CONFIG_RATE_TABLE_TEMPERATURE_POINTS
+  #define MECH_CONFIG_RATE_TABLE_TEMPERATURE_POINTS 151
+#endif
+#ifndef MECH_CONFIG_RATE_TABLE_AIR_DENSITY_POINTS
+  #define MECH_CONFIG_RATE_TABLE_AIR_DENSITY_POINTS 41
+#endif
+
+#include <mechanism_configuration/rate_constants.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    // Cells are evaluated in blocks small enough for the per-cell terms to stay in L1.
+    constexpr std::size_t CELL_BLOCK = 256;
+
+    // The reference temperature of the Troe and ternary chemical activation k0 and k∞
+    constexpr double FALLOFF_D = 300.0;
+
+    // The per-cell terms shared by every reaction of a block
+    struct CellBlock
+    {
+      std::size_t first;
+      std::size_t size;
+      std::array<double, CELL_BLOCK> inverse_T;
+      std::array<double, CELL_BLOCK> log_T;
+      std::array<double, CELL_BLOCK> pressure;
+      std::array<double, CELL_BLOCK> air_density;
+
+      CellBlock(
+          std::span<const double> temperature,
+          std::span<const double> pressure_in,
+          std::span<const double> air_density_in,
+          std::size_t first_cell)
+          : first(first_cell),
+            size(std::min(CELL_BLOCK, temperature.size() - first_cell))
+      {
+        for (std::size_t c = 0; c < size; ++c)
+        {
+          inverse_T[c] = 1.0 / temperature[first + c];
+          log_T[c] = std::log(temperature[first + c]);
+        }
+        std::copy_n(pressure_in.begin() + first, size, pressure.begin());
+        std::copy_n(air_density_in.begin() + first, size, air_density.begin());
+      }
+    };
+
+    // Where a reaction's rate constants go in the output
+    struct Output
+    {
+      double* data;
+      std::size_t cells;
+
+      double* Row(std::size_t reaction, const CellBlock& block) const
+      {
+        return data + reaction * cells + block.first;
+      }
+    };
+
+    // The terms of a rate expression a kernel evaluates. A reaction is handled by the kernel of
+    // exactly its active terms, so inactive ones cost nothing.
+    constexpr unsigned HAS_B = 1;   // (T/D)^B, or the Tunneling e^(-B/T)
+    constexpr unsigned HAS_C = 2;   // e^(C/T), or the Tunneling e^(C/T^3)
+    constexpr unsigned HAS_E = 4;   // (1 + E P)
+    constexpr unsigned HAS_FC = 4;  // the fall-off broadening factor, Fc != 1
+    constexpr unsigned ALL_TERMS = 7;
+
+    // A e^(C/T) (T/D)^B (1 + E P), with ln D given, computed with one exp
+    template<unsigned TERMS>
+    inline double Arrhenius(double A, double B, double C, double log_D, double E, const CellBlock& cells, std::size_t c)
+    {
+      double exponent = 0.0;
+      if constexpr ((TERMS & HAS_C) != 0)
+        exponent += C * cells.inverse_T[c];
+      if constexpr ((TERMS & HAS_B) != 0)
+        exponent += B * (cells.log_T[c] - log_D);
+      double k = A;
+      if constexpr ((TERMS & (HAS_B | HAS_C)) != 0)
+        k *= std::exp(exponent);
+      if constexpr ((TERMS & HAS_E) != 0)
+        k *= 1.0 + E * cells.pressure[c];
+      return k;
+    }
+
+    template<unsigned TERMS>
+    void ArrheniusKernel(
+        const ArrheniusParameters& p,
+        std::span<const double> log_D,
+        std::span<const std::size_t> reactions,
+        const CellBlock& cells,
+        Output out)
+    {
+      for (std::size_t i : reactions)
+      {
+        double* k = out.Row(p.reaction_index[i], cells);
+        if constexpr (TERMS == 0)
+          std::fill_n(k, cells.size, p.A[i]);
+        else
+          for (std::size_t c = 0; c < cells.size; ++c)
+            k[c] = Arrhenius<TERMS>(p.A[i], p.B[i], p.C[i], log_D[i], p.E[i], cells, c);
+      }
+    }
+
+    // The Troe and ternary chemical activation forms differ only in whether k0 is multiplied by
+    // [M] in the leading factor. Their k0 and k∞ have D = 300 K and E = 0.
+    template<bool TROE, unsigned TERMS>
+    inline double Falloff(
+        const FalloffParameters& p,
+        std::size_t i,
+        double log_Fc,
+        double inverse_N,
+        const CellBlock& cells,
+        std::size_t c)
+    {
+      constexpr unsigned K_TERMS = TERMS & (HAS_B | HAS_C);
+      const double log_D = std::log(FALLOFF_D);
+      const double k0 = Arrhenius<K_TERMS>(p.k0_A[i], p.k0_B[i], p.k0_C[i], log_D, 0.0, cells, c);
+      const double kinf = Arrhenius<K_TERMS>(p.kinf_A[i], p.kinf_B[i], p.kinf_C[i], log_D, 0.0, cells, c);
+      const double ratio = k0 * cells.air_density[c] / kinf;
+      double rate = (TROE ? k0 * cells.air_density[c] : k0) / (1.0 + ratio);
+      if constexpr ((TERMS & HAS_FC) != 0)
+      {
+        const double log_ratio = std::log10(ratio);
+        rate *= std::exp(log_Fc / (1.0 + inverse_N * log_ratio * log_ratio));
+      }
+      return rate;
+    }
+
+    template<bool TROE, unsigned TERMS>
+    void FalloffKernel(
+        const FalloffParameters& p,
+        std::span<const std::size_t> reactions,
+        const CellBlock& cells,
+        Output out)
+    {
+      for (std::size_t i : reactions)
+      {
+        double* k = out.Row(p.reaction_index[i], cells);
+        const double log_Fc = std::log(p.Fc[i]);
+        const double inverse_N = 1.0 / p.N[i];
+        for (std::size_t c = 0; c < cells.size; ++c)
+          k[c] = Falloff<TROE, TERMS>(p, i, log_Fc, inverse_N, cells, c);
+      }
+    }
+
+    // A e^(-B/T) e^(C/T^3)
+    template<unsigned TERMS>
+    void TunnelingKernel(
+        const TunnelingParameters& p,
+        std::span<const std::size_t> reactions,
+        const CellBlock& cells,
+        Output out)
+    {
+      for (std::size_t i : reactions)
+      {
+        double* k = out.Row(p.reaction_index[i], cells);
+        if constexpr (TERMS == 0)
+          std::fill_n(k, cells.size, p.A[i]);
+        else
+        {
+          for (std::size_t c = 0; c < cells.size; ++c)
+          {
+            const double inverse_T = cells.inverse_T[c];
+            double exponent = 0.0;
+            if constexpr ((TERMS & HAS_B) != 0)
+              exponent -= p.B[i] * inverse_T;
+            if constexpr ((TERMS & HAS_C) != 0)
+              exponent += p.C[i] * inverse_T * inverse_T * inverse_T;
+            k[c] = p.A[i] * std::exp(exponent);
+          }
+        }
+      }
+    }
+
+    using Reactions = std::span<const std::size_t>;
+    using ArrheniusKernelFn =
+        void (*)(const ArrheniusParameters&, std::span<const double>, Reactions, const CellBlock&, Output);
+    using FalloffKernelFn = void (*)(const FalloffParameters&, Reactions, const CellBlock&, Output);
+    using TunnelingKernelFn = void (*)(const TunnelingParameters&, Reactions, const CellBlock&, Output);
+
+    // One kernel per combination of terms, indexed by the combination
+    template<std::size_t... TERMS>
+    constexpr std::array<ArrheniusKernelFn, sizeof...(TERMS)> ArrheniusKernels(std::index_sequence<TERMS...>)
+    {
+      return { &ArrheniusKernel<TERMS>... };
+    }
+    template<bool TROE, std::size_t... TERMS>
+    constexpr std::array<FalloffKernelFn, sizeof...(TERMS)> FalloffKernels(std::index_sequence<TERMS...>)
+    {
+      return { &FalloffKernel<TROE, TERMS>... };
+    }
+    template<std::size_t... TERMS>
+    constexpr std::array<TunnelingKernelFn, sizeof...(TERMS)> TunnelingKernels(std::index_sequence<TERMS...>)
+    {
+      return { &TunnelingKernel<TERMS>... };
+    }
+
+    constexpr auto ARRHENIUS_KERNELS = ArrheniusKernels(std::make_index_sequence<ALL_TERMS + 1>{});
+    constexpr auto TROE_KERNELS = FalloffKernels<true>(std::make_index_sequence<ALL_TERMS + 1>{});
+    constexpr auto TERNARY_CHEMICAL_ACTIVATION_KERNELS = FalloffKernels<false>(std::make_index_sequence<ALL_TERMS + 1>{});
+    constexpr auto TUNNELING_KERNELS = TunnelingKernels(std::make_index_sequence<(HAS_B | HAS_C) + 1>{});
+
+    // Puts reaction i in the group of terms(i), or every reaction in the full-formula group
+    template<typename Terms>
+    void Group(
+        std::array<std::vector<std::size_t>, 8>& groups,
+        std::size_t count,
+        bool specialize,
+        unsigned all,
+        Terms terms)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+        groups[specialize ? terms(i) : all].push_back(i);
+    }
+
+    // A(T, [M], n) of the branched reaction, with k0 = 2e-22 e^n in mol m-3 units
+    double BranchedA(double k0, double temperature, double air_density)
+    {
+      const double a = k0 * air_density;
+      const double b = a / (0.43 * std::pow(temperature / 298.0, -8.0));
+      const double log_b = std::log10(b);
+      return a / (1.0 + b) * std::pow(0.41, 1.0 / (1.0 + log_b * log_b));
+    }
+
+    // Moves the reactions selected by `tabulated` from `groups` to the same group of `tabulated_groups`
+    void SplitTabulated(
+        std::array<std::vector<std::size_t>, 8>& groups,
+        std::array<std::vector<std::size_t>, 8>& tabulated_groups,
+        const std::vector<bool>& tabulated)
+    {
+      for (std::size_t g = 0; g < groups.size(); ++g)
+      {
+        std::vector<std::size_t> remaining;
+        for (std::size_t i : groups[g])
+          (tabulated[i] ? tabulated_groups[g] : remaining).push_back(i);
+        groups[g] = std::move(remaining);
+      }
+    }
+
+    // Where the cells of a block fall in the rate tables. A value is interpolated from
+    // POINTS × POINTS table entries; entry (a, b) is at rows[a][c] + columns[b][c] and has the
+    // weight row_weights[a][c] * column_weights[b][c].
+    struct TableStencil
+    {
+      using Offsets = std::array<std::array<std::size_t, CELL_BLOCK>, 4>;
+      using Weights = std::array<std::array<double, CELL_BLOCK>, 4>;
+      Offsets rows;
+      Offsets columns;
+      Weights row_weights;
+      Weights column_weights;
+    };
+
+    // The stencil along one axis of a cell at fractional grid position u in [0, points - 1]
+    template<std::size_t POINTS>
+    void AxisStencil(
+        double u,
+        std::size_t points,
+        std::size_t stride,
+        TableStencil::Offsets& offsets,
+        TableStencil::Weights& weights,
+        std::size_t c)
+    {
+      const std::size_t i = std::min(static_cast<std::size_t>(u), points - 2);
+      const double t = u - static_cast<double>(i);
+      if constexpr (POINTS == 2)
+      {
+        offsets[0][c] = i * stride;
+        offsets[1][c] = (i + 1) * stride;
+        weights[0][c] = 1.0 - t;
+        weights[1][c] = t;
+      }
+      else
+      {
+        // Catmull-Rom. The entries one step beyond the edges of the table are extrapolated
+        // linearly from the two nearest (clamping them would halve the slope at the edges, where
+        // ln k is often still steep, e.g. linear in ln [M] in the low-pressure limit).
+        const double t2 = t * t;
+        const double t3 = t2 * t;
+        double w0 = 0.5 * (-t3 + 2.0 * t2 - t);
+        double w1 = 0.5 * (3.0 * t3 - 5.0 * t2 + 2.0);
+        double w2 = 0.5 * (-3.0 * t3 + 4.0 * t2 + t);
+        double w3 = 0.5 * (t3 - t2);
+        std::size_t first = i;
+        if (i == 0)
+        {
+          // entry -1 = 2 × entry 0 - entry 1
+          w1 += 2.0 * w0;
+          w2 -= w0;
+          w0 = 0.0;
+        }
+        else
+          first = i - 1;
+        std::size_t last = i + 2;
+        if (i + 2 == points)
+        {
+          // entry points = 2 × entry (points - 1) - entry (points - 2)
+          w2 += 2.0 * w3;
+          w1 -= w3;
+          w3 = 0.0;
+          last = i + 1;
+        }
+        weights[0][c] = w0;
+        weights[1][c] = w1;
+        weights[2][c] = w2;
+        weights[3][c] = w3;
+        offsets[0][c] = first * stride;
+        offsets[1][c] = i * stride;
+        offsets[2][c] = (i + 1) * stride;
+        offsets[3][c] = last * stride;
+      }
+    }
+
+    // Fills the stencil of every cell of a block
+    // @return false if any cell is outside the tables
+    template<std::size_t POINTS, typename Tables>
+    bool Locate(const Tables& tables, const CellBlock& cells, TableStencil& stencil)
+    {
+      const auto last_row = static_cast<double>(tables.temperature_points - 1);
+      const auto last_column = static_cast<double>(tables.air_density_points - 1);
+      for (std::size_t c = 0; c < cells.size; ++c)
+      {
+        const double u = (cells.inverse_T[c] - tables.inverse_temperature_origin) / tables.inverse_temperature_step;
+        const double v = (std::log(cells.air_density[c]) - tables.log_air_density_origin) / tables.log_air_density_step;
+        // Negated so that NaN conditions are out of range
+        if (!(u >= 0.0 && u <= last_row && v >= 0.0 && v <= last_column))
+          return false;
+        AxisStencil<POINTS>(u, tables.temperature_points, tables.air_density_points, stencil.rows, stencil.row_weights, c);
+        AxisStencil<POINTS>(v, tables.air_density_points, 1, stencil.columns, stencil.column_weights, c);
+      }
+      return true;
+    }
+
+    // k = exp of the interpolated ln k, for every cell of a block
+    template<std::size_t POINTS>
+    void Interpolate(const double* table, const TableStencil& stencil, std::size_t size, double* k)
+    {
+      for (std::size_t c = 0; c < size; ++c)
+      {
+        double log_k = 0.0;
+        for (std::size_t a = 0; a < POINTS; ++a)
+        {
+          const double* row = table + stencil.rows[a][c];
+          double along_row = 0.0;
+          for (std::size_t b = 0; b < POINTS; ++b)
+            along_row += stencil.column_weights[b][c] * row[stencil.columns[b][c]];
+          log_k += stencil.row_weights[a][c] * along_row;
+        }
+        k[c] = std::exp(log_k);
+      }
+    }
+
+    // Evaluates every table for the cells of a block
+    // @return false, without writing anything, if any cell is outside the tables
+    template<typename Tables>
+    bool InterpolateTables(const Tables& tables, const CellBlock& cells, Output out)
+    {
+      TableStencil stencil;
+      const bool cubic = tables.interpolation == RateTableInterpolation::Cubic;
+      if (!(cubic ? Locate<4>(tables, cells, stencil) : Locate<2>(tables, cells, stencil)))
+        return false;
+      for (std::size_t t = 0; t < tables.rows.size(); ++t)
+      {
+        const double* table = tables.log_rate.data() + t * tables.size();
+        double* k = out.Row(tables.rows[t], cells);
+        if (cubic)
+          Interpolate<4>(table, stencil, cells.size, k);
+        else
+          Interpolate<2>(table, stencil, cells.size, k);
+      }
+      return true;
+    }
+
+    // The conditions at the points of a table grid, shifted by `shift` steps along both axes
+    template<typename Tables>
+    void GridConditions(
+        const Tables& tables,
+        std::size_t temperature_points,
+        std::size_t air_density_points,
+        double shift,
+        std::vector<double>& temperature,
+        std::vector<double>& air_density)
+    {
+      for (std::size_t i = 0; i < temperature_points; ++i)
+      {
+        for (std::size_t j = 0; j < air_density_points; ++j)
+        {
+          const double u = static_cast<double>(i) + shift;
+          const double v = static_cast<double>(j) + shift;
+          temperature.push_back(1.0 / (tables.inverse_temperature_origin + u * tables.inverse_temperature_step));
+          air_density.push_back(std::exp(tables.log_air_density_origin + v * tables.log_air_density_step));
+        }
+      }
+    }
+
+    // The full-formula rate of fall-off reaction i at each condition
+    template<bool TROE>
+    std::vector<double> FalloffAt(
+        const FalloffParameters& p,
+        std::size_t i,
+        std::span<const double> temperature,
+        std::span<const double> air_density)
+    {
+      const std::vector<double> pressure(temperature.size(), 0.0);
+      const double log_Fc = std::log(p.Fc[i]);
+      const double inverse_N = 1.0 / p.N[i];
+      std::vector<double> k;
+      for (std::size_t first = 0; first < temperature.size(); first += CELL_BLOCK)
+      {
+        const CellBlock block(temperature, pressure, air_density, first);
+        for (std::size_t c = 0; c < block.size; ++c)
+          k.push_back(Falloff<TROE, ALL_TERMS>(p, i, log_Fc, inverse_N, block, c));
+      }
+      return k;
+    }
+
+    void CheckSizes(std::size_t cells, std::initializer_list<std::size_t> inputs, std::size_t outputs, std::size_t expected)
+    {
+      for (std::size_t size : inputs)
+        if (size != cells)
+          throw std::invalid_argument("all condition arrays must have one value per cell");
+      if (outputs != expected)
+        throw std::invalid_argument("the output array must have one value per reaction and cell");
+    }
+  }  // namespace
+
+  RateConstantEngine::RateConstantEngine(const Mechanism& mechanism, const RateConstantOptions& options)
+      : order_(mechanism.reactions),
+        parameters_(ExportRateParameters(mechanism))
+  {
+    const bool specialize = options.specialize_kernels;
+    const ArrheniusParameters& arrhenius = parameters_.arrhenius;
+    Group(
+        arrhenius_kernels_,
+        arrhenius.size(),
+        specialize,
+        ALL_TERMS,
+        [&arrhenius](std::size_t i)
+        {
+          return (arrhenius.B[i] != 0.0 ? HAS_B : 0) | (arrhenius.C[i] != 0.0 ? HAS_C : 0) |
+                 (arrhenius.E[i] != 0.0 ? HAS_E : 0);
+        });
+    auto falloff_terms = [](const FalloffParameters& p)
+    {
+      return [&p](std::size_t i)
+      {
+        return (p.k0_B[i] != 0.0 || p.kinf_B[i] != 0.0 ? HAS_B : 0) | (p.k0_C[i] != 0.0 || p.kinf_C[i] != 0.0 ? HAS_C : 0) |
+               (p.Fc[i] != 1.0 ? HAS_FC : 0);
+      };
+    };
+    Group(troe_kernels_, parameters_.troe.size(), specialize, ALL_TERMS, falloff_terms(parameters_.troe));
+    Group(
+        ternary_chemical_activation_kernels_,
+        parameters_.ternary_chemical_activation.size(),
+        specialize,
+        ALL_TERMS,
+        falloff_terms(parameters_.ternary_chemical_activation));
+    const TunnelingParameters& tunneling = parameters_.tunneling;
+    Group(
+        tunneling_kernels_,
+        tunneling.size(),
+        specialize,
+        HAS_B | HAS_C,
+        [&tunneling](std::size_t i) { return (tunneling.B[i] != 0.0 ? HAS_B : 0) | (tunneling.C[i] != 0.0 ? HAS_C : 0); });
+
+    if (options.tables.enabled)
+      BuildTables(options.tables);
+
+    for (const auto& reaction : mechanism.reactions.lambda_rate_constant)
+    {
+      auto expression = Expression::Compile(reaction.lambda_function);
+      if (!expression)
+        throw std::invalid_argument(
+            "invalid lambda function '" + reaction.lambda_function + "': " + expression.error().message);
+      lambdas_.push_back(std::move(*expression));
+    }
+
+    for (double D : parameters_.arrhenius.D)
+      arrhenius_log_D_.push_back(std::log(D));
+    for (double D : parameters_.taylor_series.D)
+      taylor_series_log_D_.push_back(std::log(D));
+
+    // [M] in the branching ratio is in molecule cm-3; folding the conversion into k0 lets it
+    // take mol m-3.
+    constexpr double MOLECULES_PER_CM3 = constants::AVOGADRO * 1.0e-6;
+    constexpr double Z_TEMPERATURE = 293.0;
+    constexpr double Z_AIR_DENSITY = 2.45e19 / MOLECULES_PER_CM3;
+    for (const auto& reaction : mechanism.reactions.branched)
+    {
+      const double k0 = 2.0e-22 * std::exp(reaction.n) * MOLECULES_PER_CM3;
+      branched_.X.push_back(reaction.X);
+      branched_.Y.push_back(reaction.Y);
+      branched_.k0.push_back(k0);
+      branched_.Z.push_back(BranchedA(k0, Z_TEMPERATURE, Z_AIR_DENSITY) * (1.0 - reaction.a0) / reaction.a0);
+    }
+  }
+
+  void RateConstantEngine::BuildTables(const RateTableOptions& options)
+  {
+    const std::size_t temperature_points =
+        options.temperature_points != 0 ? options.temperature_points : MECH_CONFIG_RATE_TABLE_TEMPERATURE_POINTS;
+    const std::size_t air_density_points =
+        options.air_density_points != 0 ? options.air_density_points : MECH_CONFIG_RATE_TABLE_AIR_DENSITY_POINTS;
+    const std::size_t minimum_points = options.interpolation == RateTableInterpolation::Cubic ? 4 : 2;
+    if (!(options.min_temperature > 0.0 && options.min_temperature < options.max_temperature))
+      throw std::invalid_argument("the rate table temperature range must be positive and not empty");
+    if (!(options.min_air_density > 0.0 && options.min_air_density < options.max_air_density))
+      throw std::invalid_argument("the rate table air density range must be positive and not empty");
+    if (temperature_points < minimum_points || air_density_points < minimum_points)
+      throw std::invalid_argument("rate tables need at least 2 points per axis (4 for cubic interpolation)");
+
+    tables_.interpolation = options.interpolation;
+    tables_.temperature_points = temperature_points;
+    tables_.air_density_points = air_density_points;
+    tables_.inverse_temperature_origin = 1.0 / options.max_temperature;
+    tables_.inverse_temperature_step =
+        (1.0 / options.min_temperature - 1.0 / options.max_temperature) / static_cast<double>(temperature_points - 1);
+    tables_.log_air_density_origin = std::log(options.min_air_density);
+    tables_.log_air_density_step =
+        std::log(options.max_air_density / options.min_air_density) / static_cast<double>(air_density_points - 1);
+
+    std::vector<double> grid_temperature, grid_air_density;
+    GridConditions(tables_, temperature_points, air_density_points, 0.0, grid_temperature, grid_air_density);
+    // The centers of the table cells, where the interpolation error is largest
+    std::vector<double> center_temperature, center_air_density;
+    GridConditions(tables_, temperature_points - 1, air_density_points - 1, 0.5, center_temperature, center_air_density);
+    const std::vector<double> center_pressure(center_temperature.size(), 0.0);
+
+    auto tabulate = [&](bool troe, const FalloffParameters& p, KernelGroups& groups, KernelGroups& tabulated_groups)
+    {
+      auto rate_at = [&](std::size_t i, std::span<const double> temperature, std::span<const double> air_density)
+      {
+        return troe ? FalloffAt<true>(p, i, temperature, air_density) : FalloffAt<false>(p, i, temperature, air_density);
+      };
+      std::vector<bool> tabulated(p.size(), false);
+      for (std::size_t i = 0; i < p.size(); ++i)
+      {
+        const std::vector<double> k = rate_at(i, grid_temperature, grid_air_density);
+        if (!std::ranges::all_of(k, [](double value) { return value > 0.0 && std::isfinite(value); }))
+          continue;
+        tabulated[i] = true;
+        tables_.rows.push_back(p.reaction_index[i]);
+        for (double value : k)
+          tables_.log_rate.push_back(std::log(value));
+
+        const std::vector<double> exact = rate_at(i, center_temperature, center_air_density);
+        const double* table = tables_.log_rate.data() + (tables_.rows.size() - 1) * tables_.size();
+        double max_relative_error = 0.0;
+        TableStencil stencil;
+        std::array<double, CELL_BLOCK> interpolated;
+        for (std::size_t first = 0; first < center_temperature.size(); first += CELL_BLOCK)
+        {
+          const CellBlock block(center_temperature, center_pressure, center_air_density, first);
+          if (tables_.interpolation == RateTableInterpolation::Cubic)
+          {
+            Locate<4>(tables_, block, stencil);
+            Interpolate<4>(table, stencil, block.size, interpolated.data());
+          }
+          else
+          {
+            Locate<2>(tables_, block, stencil);
+            Interpolate<2>(table, stencil, block.size, interpolated.data());
+          }
+          for (std::size_t c = 0; c < block.size; ++c)
+            max_relative_error =
+                std::max(max_relative_error, std::abs(interpolated[c] - exact[first + c]) / exact[first + c]);
+        }
+        table_errors_.push_back({ p.reaction_index[i], max_relative_error });
+      }
+      SplitTabulated(groups, tabulated_groups, tabulated);
+    };
+    tabulate(true, parameters_.troe, troe_kernels_, troe_tabulated_kernels_);
+    tabulate(
+        false,
+        parameters_.ternary_chemical_activation,
+        ternary_chemical_activation_kernels_,
+        ternary_chemical_activation_tabulated_kernels_);
+  }
+
+  void RateConstantEngine::Evaluate(
+      std::span<const double> temperature,
+      std::span<const double> pressure,
+      std::span<const double> air_density,
+      std::span<double> rate_constants) const
+  {
+    const std::size_t cells = temperature.size();
+    CheckSizes(cells, { pressure.size(), air_density.size() }, rate_constants.size(), order_.size * cells);
+
+    const Output out{ rate_constants.data(), cells };
+    for (std::size_t first = 0; first < cells; first += CELL_BLOCK)
+    {
+      const CellBlock block(temperature, pressure, air_density, first);
+
+      for (std::size_t terms = 0; terms < arrhenius_kernels_.size(); ++terms)
+        if (!arrhenius_kernels_[terms].empty())
+          ARRHENIUS_KERNELS[terms](parameters_.arrhenius, arrhenius_log_D_, arrhenius_kernels_[terms], block, out);
+
+      for (std::size_t i = 0; i < branched_.X.size(); ++i)
+      {
+        double* k = out.Row(order_.branched + i, block);
+        const double X = branched_.X[i];
+        const double Y = branched_.Y[i];
+        for (std::size_t c = 0; c < block.size; ++c)
+          k[c] = X * std::exp(-Y * block.inverse_T[c]);
+      }
+
+      // The Taylor series multiplies the Arrhenius form by Σ C_i T^i.
+      const TaylorSeriesParameters& taylor = parameters_.taylor_series;
+      for (std::size_t i = 0; i < taylor.size(); ++i)
+      {
+        double* k = out.Row(taylor.reaction_index[i], block);
+        const auto& offsets = taylor.taylor_coefficient_offsets;
+        const auto coefficients = taylor.taylor_coefficients.subspan(offsets[i], offsets[i + 1] - offsets[i]);
+        for (std::size_t c = 0; c < block.size; ++c)
+        {
+          const double T = temperature[first + c];
+          double series = 0.0;
+          for (std::size_t j = coefficients.size(); j-- > 0;)
+            series = series * T + coefficients[j];
+          k[c] = series *
+                 Arrhenius<ALL_TERMS>(taylor.A[i], taylor.B[i], taylor.C[i], taylor_series_log_D_[i], taylor.E[i], block, c);
+        }
+      }
+
+      // Tabulated reactions fall back to their kernels when the block leaves the tables.
+      const bool tabulated = !tables_.rows.empty() && InterpolateTables(tables_, block, out);
+      for (std::size_t terms = 0; terms < troe_kernels_.size(); ++terms)
+      {
+        if (!troe_kernels_[terms].empty())
+          TROE_KERNELS[terms](parameters_.troe, troe_kernels_[terms], block, out);
+        if (!ternary_chemical_activation_kernels_[terms].empty())
+          TERNARY_CHEMICAL_ACTIVATION_KERNELS[terms](
+              parameters_.ternary_chemical_activation, ternary_chemical_activation_kernels_[terms], block, out);
+        if (tabulated)
+          continue;
+        if (!troe_tabulated_kernels_[terms].empty())
+          TROE_KERNELS[terms](parameters_.troe, troe_tabulated_kernels_[terms], block, out);
+        if (!ternary_chemical_activation_tabulated_kernels_[terms].empty())
+          TERNARY_CHEMICAL_ACTIVATION_KERNELS[terms](
+              parameters_.ternary_chemical_activation, ternary_chemical_activation_tabulated_kernels_[terms], block, out);
+      }
+
+      for (std::size_t terms = 0; terms < TUNNELING_KERNELS.size(); ++terms)
+        if (!tunneling_kernels_[terms].empty())
+          TUNNELING_KERNELS[terms](parameters_.tunneling, tunneling_kernels_[terms], block, out);
+    }
+
+    // Lambda expressions run their own block loop over the cells.
+    for (std::size_t i = 0; i < lambdas_.size(); ++i)
+      lambdas_[i].Evaluate(temperature, pressure, rate_constants.subspan((order_.lambda_rate_constant + i) * cells, cells));
+  }
+
+  void RateConstantEngine::EvaluateNitrateFractions(
+      std::span<const double> temperature,
+      std::span<const double> air_density,
+      std::span<double> fractions) const
+  {
+    const std::size_t cells = temperature.size();
+    CheckSizes(cells, { air_density.size() }, fractions.size(), branched_.X.size() * cells);
+
+    for (std::size_t i = 0; i < branched_.X.size(); ++i)
+    {
+      double* f = fractions.data() + i * cells;
+      for (std::size_t c = 0; c < cells; ++c)
+      {
+        const double A = BranchedA(branched_.k0[i], temperature[c], air_density[c]);
+        f[c] = A / (A + branched_.Z[i]);
+      }
+    }
+  }
+}  // namespace mechanism_configuration
@@ -0,0 +1,167 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/rate_parameters.hpp>
+
+#include <array>
+#include <cstring>
+#include <new>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    constexpr std::size_t Padded(std::size_t bytes)
+    {
+      return (bytes + RATE_PARAMETER_ALIGNMENT - 1) / RATE_PARAMETER_ALIGNMENT * RATE_PARAMETER_ALIGNMENT;
+    }
+
+    template<typename Reaction, typename Parameters>
+    using Field = std::pair<double Reaction::*, std::span<const double> Parameters::*>;
+
+    constexpr std::array<Field<types::Arrhenius, ArrheniusParameters>, 5> ARRHENIUS_FIELDS{ {
+        { &types::Arrhenius::A, &ArrheniusParameters::A },
+        { &types::Arrhenius::B, &ArrheniusParameters::B },
+        { &types::Arrhenius::C, &ArrheniusParameters::C },
+        { &types::Arrhenius::D, &ArrheniusParameters::D },
+        { &types::Arrhenius::E, &ArrheniusParameters::E },
+    } };
+
+    constexpr std::array<Field<types::TaylorSeries, TaylorSeriesParameters>, 5> TAYLOR_SERIES_FIELDS{ {
+        { &types::TaylorSeries::A, &TaylorSeriesParameters::A },
+        { &types::TaylorSeries::B, &TaylorSeriesParameters::B },
+        { &types::TaylorSeries::C, &TaylorSeriesParameters::C },
+        { &types::TaylorSeries::D, &TaylorSeriesParameters::D },
+        { &types::TaylorSeries::E, &TaylorSeriesParameters::E },
+    } };
+
+    template<typename Reaction>
+    constexpr std::array<Field<Reaction, FalloffParameters>, 8> FALLOFF_FIELDS{ {
+        { &Reaction::k0_A, &FalloffParameters::k0_A },
+        { &Reaction::k0_B, &FalloffParameters::k0_B },
+        { &Reaction::k0_C, &FalloffParameters::k0_C },
+        { &Reaction::kinf_A, &FalloffParameters::kinf_A },
+        { &Reaction::kinf_B, &FalloffParameters::kinf_B },
+        { &Reaction::kinf_C, &FalloffParameters::kinf_C },
+        { &Reaction::Fc, &FalloffParameters::Fc },
+        { &Reaction::N, &FalloffParameters::N },
+    } };
+
+    constexpr std::array<Field<types::Tunneling, TunnelingParameters>, 3> TUNNELING_FIELDS{ {
+        { &types::Tunneling::A, &TunnelingParameters::A },
+        { &types::Tunneling::B, &TunnelingParameters::B },
+        { &types::Tunneling::C, &TunnelingParameters::C },
+    } };
+
+    // Hands out consecutive aligned arrays of a zeroed block.
+    class Arena
+    {
+     public:
+      explicit Arena(std::byte* block)
+          : block_(block)
+      {
+      }
+
+      template<typename T>
+      std::span<T> Take(std::size_t count)
+      {
+        if (count == 0)
+          return {};
+        T* first = reinterpret_cast<T*>(block_ + used_);
+        used_ += Padded(count * sizeof(T));
+        return { first, count };
+      }
+
+     private:
+      std::byte* block_;
+      std::size_t used_{ 0 };
+    };
+
+    // Bytes taken by a group of `fields` arrays plus its reaction index for `count` reactions.
+    constexpr std::size_t GroupBytes(std::size_t fields, std::size_t count)
+    {
+      return fields * Padded(count * sizeof(double)) + Padded(count * sizeof(std::size_t));
+    }
+
+    template<typename Reaction, typename Parameters, std::size_t N>
+    void ExportGroup(
+        const std::vector<Reaction>& reactions,
+        std::size_t first_reaction,
+        const std::array<Field<Reaction, Parameters>, N>& fields,
+        Parameters& parameters,
+        Arena& arena)
+    {
+      for (const auto& [from, to] : fields)
+      {
+        auto values = arena.Take<double>(reactions.size());
+        for (std::size_t i = 0; i < reactions.size(); ++i)
+          values[i] = reactions[i].*from;
+        parameters.*to = values;
+      }
+      auto index = arena.Take<std::size_t>(reactions.size());
+      std::iota(index.begin(), index.end(), first_reaction);
+      parameters.reaction_index = index;
+    }
+  }  // namespace
+
+  void RateParameters::AlignedDelete::operator()(std::byte* storage) const
+  {
+    ::operator delete(storage, std::align_val_t{ RATE_PARAMETER_ALIGNMENT });
+  }
+
+  RateParameters ExportRateParameters(const Mechanism& mechanism)
+  {
+    const types::Reactions& reactions = mechanism.reactions;
+    const ReactionOrder order(reactions);
+
+    std::size_t coefficients = 0;
+    for (const auto& reaction : reactions.taylor_series)
+      coefficients += reaction.taylor_coefficients.size();
+
+    const std::size_t bytes = GroupBytes(ARRHENIUS_FIELDS.size(), reactions.arrhenius.size()) +
+                              GroupBytes(TAYLOR_SERIES_FIELDS.size(), reactions.taylor_series.size()) +
+                              Padded(coefficients * sizeof(double)) +
+                              Padded((reactions.taylor_series.size() + 1) * sizeof(std::size_t)) +
+                              GroupBytes(FALLOFF_FIELDS<types::Troe>.size(), reactions.troe.size()) +
+                              GroupBytes(
+                                  FALLOFF_FIELDS<types::TernaryChemicalActivation>.size(),
+                                  reactions.ternary_chemical_activation.size()) +
+                              GroupBytes(TUNNELING_FIELDS.size(), reactions.tunneling.size());
+
+    RateParameters parameters;
+    parameters.storage_.reset(
+        static_cast<std::byte*>(::operator new(bytes, std::align_val_t{ RATE_PARAMETER_ALIGNMENT })));
+    std::memset(parameters.storage_.get(), 0, bytes);
+    Arena arena(parameters.storage_.get());
+
+    ExportGroup(reactions.arrhenius, order.arrhenius, ARRHENIUS_FIELDS, parameters.arrhenius, arena);
+    ExportGroup(reactions.taylor_series, order.taylor_series, TAYLOR_SERIES_FIELDS, parameters.taylor_series, arena);
+    ExportGroup(reactions.troe, order.troe, FALLOFF_FIELDS<types::Troe>, parameters.troe, arena);
+    ExportGroup(
+        reactions.ternary_chemical_activation,
+        order.ternary_chemical_activation,
+        FALLOFF_FIELDS<types::TernaryChemicalActivation>,
+        parameters.ternary_chemical_activation,
+        arena);
+    ExportGroup(reactions.tunneling, order.tunneling, TUNNELING_FIELDS, parameters.tunneling, arena);
+
+    auto values = arena.Take<double>(coefficients);
+    auto offsets = arena.Take<std::size_t>(reactions.taylor_series.size() + 1);
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < reactions.taylor_series.size(); ++i)
+    {
+      offsets[i] = next;
+      for (double coefficient : reactions.taylor_series[i].taylor_coefficients)
+        values[next++] = coefficient;
+    }
+    offsets[reactions.taylor_series.size()] = next;
+    parameters.taylor_series.taylor_coefficients = values;
+    parameters.taylor_series.taylor_coefficient_offsets = offsets;
+
+    return parameters;
+  }
+}  // namespace mechanism_configuration
@@ -0,0 +1,31 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/reaction_order.hpp>
+
+namespace mechanism_configuration
+{
+  ReactionOrder::ReactionOrder(const types::Reactions& reactions)
+  {
+    std::size_t next = 0;
+    auto place = [&next](std::size_t& first, std::size_t count)
+    {
+      first = next;
+      next += count;
+    };
+    place(arrhenius, reactions.arrhenius.size());
+    place(branched, reactions.branched.size());
+    place(emission, reactions.emission.size());
+    place(first_order_loss, reactions.first_order_loss.size());
+    place(photolysis, reactions.photolysis.size());
+    place(surface, reactions.surface.size());
+    place(taylor_series, reactions.taylor_series.size());
+    place(troe, reactions.troe.size());
+    place(ternary_chemical_activation, reactions.ternary_chemical_activation.size());
+    place(tunneling, reactions.tunneling.size());
+    place(user_defined, reactions.user_defined.size());
+    place(lambda_rate_constant, reactions.lambda_rate_constant.size());
+    size = next;
+  }
+}  // namespace mechanism_configuration
@@ -5,21 +5,169 @@
 #include "detail/schema.hpp"
 
 #include "detail/error_format.hpp"
+#include "detail/location.hpp"
 
-#include <iostream>
+#include <mechanism_configuration/expression.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
 
 namespace mechanism_configuration
 {
-  Errors CheckSchema(
-      const YAML::Node& object,
+  namespace
+  {
+    // FNV-1a, with the seed folded into the offset basis
+    std::uint64_t Hash(std::string_view key, std::uint64_t seed)
+    {
+      std::uint64_t hash = 0xcbf29ce484222325ULL ^ (seed * 0x9e3779b97f4a7c15ULL);
+      for (char c : key)
+      {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ULL;
+      }
+      return hash ^ (hash >> 32);
+    }
+
+    // The `line` (0-based) of `text`, without its line break
+    std::string_view LineOf(std::string_view text, std::size_t line)
+    {
+      std::size_t begin = 0;
+      for (; line > 0; --line)
+      {
+        begin = text.find('\n', begin);
+        if (begin == std::string_view::npos)
+          return {};
+        ++begin;
+      }
+      std::string_view result = text.substr(begin, text.find('\n', begin) - begin);
+      if (!result.empty() && result.back() == '\r')
+        result.remove_suffix(1);
+      return result;
+    }
+
+    // The source location of `line`:`column` (0-based) of a scalar's text. The text is only mapped
+    // onto the source where it appears there verbatim: a plain or quoted scalar on one line, or a
+    // line of a literal (`|`) block scalar. Anything else (escapes, folded lines, or no SourceText
+    // holding the scalar) is located at the start of the scalar.
+    ErrorLocation LocationInScalar(const YAML::Node& scalar, std::size_t line, std::size_t column)
+    {
+      ErrorLocation location = LocationOf(scalar);
+      const std::string_view source = SourceText();
+      const std::string_view text = scalar.Scalar();
+      const auto start = static_cast<std::size_t>(scalar.Mark().pos);
+      if (start >= source.size())
+        return location;
+
+      const char indicator = source[start];
+      if (indicator == '|')
+      {
+        // The header is the rest of the indicator's line; an explicit indentation is not supported
+        const std::size_t header_end = source.find('\n', start);
+        if (header_end == std::string_view::npos)
+          return location;
+        const std::string_view header = source.substr(start + 1, header_end - start - 1);
+        if (header.find_first_of("123456789") != std::string_view::npos)
+          return location;
+
+        // Content lines map one to one onto source lines, indented as the first non-blank one
+        const std::string_view content = source.substr(header_end + 1);
+        std::size_t indentation = std::string_view::npos;
+        for (std::size_t i = 0; indentation == std::string_view::npos && i <= line; ++i)
+        {
+          const std::string_view source_line = LineOf(content, i);
+          const std::size_t first = source_line.find_first_not_of(' ');
+          if (first != std::string_view::npos)
+            indentation = first;
+        }
+        const std::string_view source_line = LineOf(content, line);
+        if (indentation == std::string_view::npos || source_line.size() < indentation ||
+            source_line.substr(indentation) != LineOf(text, line))
+          return location;
+        location.line += static_cast<int>(line) + 1;
+        location.column = static_cast<int>(indentation + column) + 1;
+        return location;
+      }
+
+      const std::size_t quote = (indicator == '"' || indicator == '\'') ? 1 : 0;
+      const std::size_t end = start + quote + text.size();
+      if (line != 0 || text.find('\n') != std::string_view::npos || end + quote > source.size() ||
+          source.substr(start + quote, text.size()) != text || (quote && source[end] != indicator))
+        return location;
+      location.column += static_cast<int>(quote + column);
+      return location;
+    }
+  }  // namespace
+
+  Schema::Schema(
       const std::vector<std::string_view>& required_keys,
       const std::vector<std::string_view>& optional_keys,
       const std::vector<std::vector<std::string_view>>& exactly_one_of)
+  {
+    for (const auto* keys : { &required_keys, &optional_keys })
+      keys_.insert(keys_.end(), keys->begin(), keys->end());
+    for (const auto& group : exactly_one_of)
+      keys_.insert(keys_.end(), group.begin(), group.end());
+    std::sort(keys_.begin(), keys_.end());
+    keys_.erase(std::unique(keys_.begin(), keys_.end()), keys_.end());
+    if (keys_.size() > MAX_KEYS)
+      throw std::invalid_argument(mc_fmt::format("A schema can hold at most {} keys", MAX_KEYS));
+
+    // Look for a seed that gives every key its own slot, doubling the table every so often
+    std::size_t n_slots = 8;
+    while (n_slots < 2 * keys_.size())
+      n_slots *= 2;
+    for (std::uint64_t attempt = 0;; ++attempt)
+    {
+      if (attempt > 0 && attempt % 64 == 0)
+        n_slots *= 2;
+      seed_ = attempt;
+      slot_mask_ = n_slots - 1;
+      slots_.assign(n_slots, 0);
+      bool collision = false;
+      for (std::size_t i = 0; i < keys_.size() && !collision; ++i)
+      {
+        auto& slot = slots_[Hash(keys_[i], seed_) & slot_mask_];
+        collision = slot != 0;
+        slot = static_cast<std::uint8_t>(i + 1);
+      }
+      if (!collision)
+        break;
+    }
+
+    for (const auto& key : required_keys)
+      required_ |= Mask{ 1 } << Find(key);
+    for (const auto& group : exactly_one_of)
+    {
+      Mask mask = 0;
+      std::string names;
+      for (const auto& key : group)
+      {
+        mask |= Mask{ 1 } << Find(key);
+        names += (names.empty() ? "'" : ", '") + std::string(key) + "'";
+      }
+      groups_.push_back(mask);
+      group_names_.push_back(std::move(names));
+    }
+  }
+
+  std::size_t Schema::Find(std::string_view key) const
+  {
+    const std::uint8_t slot = slots_[Hash(key, seed_) & slot_mask_];
+    if (slot == 0 || keys_[slot - 1] != key)
+      return NOT_FOUND;
+    return slot - 1;
+  }
+
+  Errors Schema::Check(const MapView& object) const
   {
     Errors errors;
-    ErrorLocation error_location{ object.Mark().line, object.Mark().column };
+    ErrorLocation error_location = LocationOf(object);
 
-    if (!object || object.IsNull())
+    if (!object.node() || object.node().IsNull())
     {
       std::string message = mc_fmt::format("{} error: Object is null.", error_location);
       errors.push_back({ ErrorCode::EmptyObject, message });
@@ -27,93 +175,50 @@ namespace mechanism_configuration
       return errors;
     }
 
-    // Collect all keys from the object
-    std::vector<std::string> object_keys;
-    for (const auto& key : object)
+    Mask present = 0;
+    bool has_invalid_keys = false;
+    for (const auto& entry : object.entries())
     {
-      object_keys.emplace_back(key.first.as<std::string>());
+      const std::size_t bit = Find(entry.key);
+      if (bit != NOT_FOUND)
+        present |= Mask{ 1 } << bit;
+      // Anything else must be a standard comment, containing __
+      else if (entry.key.find("__") == std::string_view::npos)
+        has_invalid_keys = true;
     }
 
-    // Sort keys for comparison (own the strings so comparisons stay homogeneous)
-    std::vector<std::string> sorted_required_keys(required_keys.begin(), required_keys.end());
-    std::vector<std::string> sorted_optional_keys(optional_keys.begin(), optional_keys.end());
-    std::sort(object_keys.begin(), object_keys.end());
-    std::sort(sorted_required_keys.begin(), sorted_required_keys.end());
-    std::sort(sorted_optional_keys.begin(), sorted_optional_keys.end());
-
-    // Find missing required keys
-    std::vector<std::string> missing_keys;
-    std::set_difference(
-        sorted_required_keys.begin(),
-        sorted_required_keys.end(),
-        object_keys.begin(),
-        object_keys.end(),
-        std::back_inserter(missing_keys));
-
-    for (const auto& key : missing_keys)
+    for (Mask missing = required_ & ~present; missing != 0; missing &= missing - 1)
     {
+      const auto& key = keys_[std::countr_zero(missing)];
       std::string message = mc_fmt::format("{} error: Required key '{}' is missing.", error_location, key);
       errors.push_back({ ErrorCode::RequiredKeyNotFound, message });
     }
 
-    // Exactly-one-of groups: exactly one member of each group must be present.
-    // Group members also count as allowed keys, so they are never flagged as invalid.
-    for (const auto& group : exactly_one_of)
+    for (std::size_t g = 0; g < groups_.size(); ++g)
     {
-      std::vector<std::string> present;
-      for (const auto& key : group)
+      const int count = std::popcount(present & groups_[g]);
+      if (count == 0)
       {
-        std::string key_str(key);
-        sorted_optional_keys.push_back(key_str);
-        if (std::find(object_keys.begin(), object_keys.end(), key_str) != object_keys.end())
-          present.push_back(key_str);
+        std::string message =
+            mc_fmt::format("{} error: Exactly one of {} is required.", error_location, group_names_[g]);
+        errors.push_back({ ErrorCode::RequiredKeyNotFound, message });
       }
-
-      if (present.size() != 1)
+      else if (count > 1)
       {
-        std::string joined;
-        for (size_t i = 0; i < group.size(); ++i)
-        {
-          joined += "'" + std::string(group[i]) + "'";
-          if (i + 1 < group.size())
-            joined += ", ";
-        }
-
-        if (present.empty())
-        {
-          std::string message = mc_fmt::format("{} error: Exactly one of {} is required.", error_location, joined);
-          errors.push_back({ ErrorCode::RequiredKeyNotFound, message });
-        }
-        else
-        {
-          std::string message = mc_fmt::format("{} error: Only one of {} may be specified.", error_location, joined);
-          errors.push_back({ ErrorCode::MutuallyExclusiveOption, message });
-        }
+        std::string message =
+            mc_fmt::format("{} error: Only one of {} may be specified.", error_location, group_names_[g]);
+        errors.push_back({ ErrorCode::MutuallyExclusiveOption, message });
       }
     }
-    std::sort(sorted_optional_keys.begin(), sorted_optional_keys.end());
-
-    // Find keys that are neither required nor optional
-    std::vector<std::string> extra_keys;
-    std::set_difference(
-        object_keys.begin(),
-        object_keys.end(),
-        sorted_required_keys.begin(),
-        sorted_required_keys.end(),
-        std::back_inserter(extra_keys));
-
-    std::vector<std::string> invalid_keys;
-    std::set_difference(
-        extra_keys.begin(),
-        extra_keys.end(),
-        sorted_optional_keys.begin(),
-        sorted_optional_keys.end(),
-        std::back_inserter(invalid_keys));
-
-    // now, anything left must be standard comment starting with __
-    for (auto& key : invalid_keys)
+
+    if (has_invalid_keys)
     {
-      if (key.find("__") == std::string::npos)
+      std::vector<std::string_view> invalid_keys;
+      for (const auto& entry : object.entries())
+        if (Find(entry.key) == NOT_FOUND && entry.key.find("__") == std::string_view::npos)
+          invalid_keys.push_back(entry.key);
+      std::sort(invalid_keys.begin(), invalid_keys.end());
+      for (const auto& key : invalid_keys)
       {
         std::string message = mc_fmt::format("{} error: Non-standard key '{}' found.", error_location, key);
         errors.push_back({ ErrorCode::InvalidKey, message });
@@ -122,4 +227,33 @@ namespace mechanism_configuration
 
     return errors;
   }
+
+  Errors CheckSchema(
+      const YAML::Node& object,
+      const std::vector<std::string_view>& required_keys,
+      const std::vector<std::string_view>& optional_keys,
+      const std::vector<std::vector<std::string_view>>& exactly_one_of)
+  {
+    return Schema(required_keys, optional_keys, exactly_one_of).Check(object);
+  }
+
+  Errors CheckExpression(const YAML::Node& object, std::string_view what, bool allow_pressure)
+  {
+    if (!object.IsScalar())
+      return {};
+    auto compiled = Expression::Compile(object.Scalar());
+    std::optional<ExpressionError> error;
+    if (!compiled)
+      error = compiled.error();
+    else if (!allow_pressure && compiled->UsesPressure())
+      error = ExpressionError{ "Only the temperature may be used here", 0, 0 };
+    if (!error)
+      return {};
+
+    // Point at the offending character where it can be found in the source
+    ErrorLocation error_location = LocationInScalar(object, error->line, error->column);
+    std::string message =
+        mc_fmt::format("{} error: Invalid {} '{}': {}.", error_location, what, object.Scalar(), error->message);
+    return { { ErrorCode::InvalidExpression, message } };
+  }
 }  // namespace mechanism_configuration
@@ -0,0 +1,237 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/format_compat.hpp>
+#include <mechanism_configuration/stoichiometry.hpp>
+
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    // Builds a matrix one column at a time. Entries of the same row within a column are merged
+    // through `position_`, which maps a row to its entry in the open column.
+    class ColumnBuilder
+    {
+     public:
+      ColumnBuilder(CompressedMatrix& matrix, std::size_t rows, bool drop_zeros)
+          : matrix_(matrix),
+            position_(rows, types::NO_INDEX),
+            drop_zeros_(drop_zeros)
+      {
+      }
+
+      void Add(std::size_t row, double value)
+      {
+        std::size_t& position = position_[row];
+        if (position == types::NO_INDEX)
+        {
+          position = matrix_.values.size();
+          matrix_.indices.push_back(row);
+          matrix_.values.push_back(value);
+        }
+        else
+          matrix_.values[position] += value;
+      }
+
+      void CloseColumn()
+      {
+        const std::size_t first = matrix_.offsets.back();
+        std::size_t kept = first;
+        for (std::size_t k = first; k < matrix_.values.size(); ++k)
+        {
+          position_[matrix_.indices[k]] = types::NO_INDEX;
+          if (drop_zeros_ && matrix_.values[k] == 0.0)
+            continue;
+          matrix_.indices[kept] = matrix_.indices[k];
+          matrix_.values[kept] = matrix_.values[k];
+          ++kept;
+        }
+        matrix_.indices.resize(kept);
+        matrix_.values.resize(kept);
+        matrix_.offsets.push_back(kept);
+      }
+
+     private:
+      CompressedMatrix& matrix_;
+      std::vector<std::size_t> position_;
+      bool drop_zeros_;
+    };
+
+    // Counting-sort transpose; the result has its indices in increasing order.
+    CompressedMatrix Transpose(const CompressedMatrix& matrix, std::size_t columns)
+    {
+      CompressedMatrix transposed;
+      transposed.offsets.assign(columns + 1, 0);
+      for (std::size_t column : matrix.indices)
+        ++transposed.offsets[column + 1];
+      for (std::size_t i = 0; i < columns; ++i)
+        transposed.offsets[i + 1] += transposed.offsets[i];
+
+      transposed.indices.resize(matrix.size());
+      transposed.values.resize(matrix.size());
+      std::vector<std::size_t> next(transposed.offsets.begin(), transposed.offsets.end() - 1);
+      for (std::size_t row = 0; row + 1 < matrix.offsets.size(); ++row)
+      {
+        for (std::size_t k = matrix.offsets[row]; k < matrix.offsets[row + 1]; ++k)
+        {
+          const std::size_t position = next[matrix.indices[k]]++;
+          transposed.indices[position] = row;
+          transposed.values[position] = matrix.values[k];
+        }
+      }
+      return transposed;
+    }
+
+    // The columns of each matrix, before they are sorted into both compressed forms
+    struct Columns
+    {
+      CompressedMatrix reactants;
+      CompressedMatrix net;
+      CompressedMatrix nitrate_products;
+      CompressedMatrix alkoxy_products;
+    };
+
+    // Adds every reaction to the reactant and net matrices, one column each, and every branched
+    // reaction to the two branch product matrices.
+    class StoichiometryBuilder
+    {
+     public:
+      StoichiometryBuilder(std::size_t species, Columns& columns, Errors& errors)
+          : species_(species),
+            reactants_(columns.reactants, species, false),
+            net_(columns.net, species, true),
+            nitrate_products_(columns.nitrate_products, species, false),
+            alkoxy_products_(columns.alkoxy_products, species, false),
+            errors_(errors)
+      {
+      }
+
+      template<typename Reaction>
+      void operator()(const std::vector<Reaction>& reactions, std::string_view type)
+      {
+        for (const auto& reaction : reactions)
+        {
+          Add(reaction, type);
+          reactants_.CloseColumn();
+          net_.CloseColumn();
+          if constexpr (std::is_same_v<Reaction, types::Branched>)
+          {
+            nitrate_products_.CloseColumn();
+            alkoxy_products_.CloseColumn();
+          }
+        }
+      }
+
+     private:
+      template<typename Reaction>
+      void Add(const Reaction& reaction, std::string_view type)
+      {
+        if constexpr (requires { reaction.reactants; })
+          Consume(reaction.reactants, type);
+        if constexpr (requires { reaction.products; })
+          Produce(reaction.products, type, net_);
+      }
+
+      void Add(const types::Branched& reaction, std::string_view type)
+      {
+        Consume(reaction.reactants, type);
+        Produce(reaction.nitrate_products, type, nitrate_products_);
+        Produce(reaction.alkoxy_products, type, alkoxy_products_);
+      }
+
+      void Add(const types::Surface& reaction, std::string_view type)
+      {
+        Consume(reaction.gas_phase_species, type);
+        Produce(reaction.gas_phase_products, type, net_);
+      }
+
+      void Consume(const types::ReactionComponent& component, std::string_view type)
+      {
+        Consume(std::span(&component, 1), type);
+      }
+
+      void Consume(std::span<const types::ReactionComponent> components, std::string_view type)
+      {
+        for (const auto& component : components)
+        {
+          if (!Known(component, type))
+            continue;
+          reactants_.Add(component.species_index, component.coefficient);
+          net_.Add(component.species_index, -component.coefficient);
+        }
+      }
+
+      void Produce(std::span<const types::ReactionComponent> components, std::string_view type, ColumnBuilder& products)
+      {
+        for (const auto& component : components)
+          if (Known(component, type))
+            products.Add(component.species_index, component.coefficient);
+      }
+
+      bool Known(const types::ReactionComponent& component, std::string_view type)
+      {
+        if (component.species_index < species_)
+          return true;
+        errors_.push_back({ ErrorCode::ReactionRequiresUnknownSpecies,
+                            mc_fmt::format("Unknown species '{}' used in '{}' reaction.", component.name, type) });
+        return false;
+      }
+
+      std::size_t species_;
+      ColumnBuilder reactants_;
+      ColumnBuilder net_;
+      ColumnBuilder nitrate_products_;
+      ColumnBuilder alkoxy_products_;
+      Errors& errors_;
+    };
+  }  // namespace
+
+  std::expected<Stoichiometry, Errors> BuildStoichiometry(const Mechanism& mechanism)
+  {
+    Stoichiometry stoichiometry;
+    stoichiometry.species = mechanism.species.size();
+    stoichiometry.order = ReactionOrder(mechanism.reactions);
+
+    // Built column by column, so the columns are in ReactionOrder but the rows within a column
+    // are in the order the species first appear. Transposing twice sorts both forms.
+    Columns columns;
+    Errors errors;
+    StoichiometryBuilder add(stoichiometry.species, columns, errors);
+
+    const types::Reactions& r = mechanism.reactions;
+    add(r.arrhenius, "arrhenius");
+    add(r.branched, "branched");
+    add(r.emission, "emission");
+    add(r.first_order_loss, "first order loss");
+    add(r.photolysis, "photolysis");
+    add(r.surface, "surface");
+    add(r.taylor_series, "taylor series");
+    add(r.troe, "troe");
+    add(r.ternary_chemical_activation, "ternary chemical activation");
+    add(r.tunneling, "tunneling");
+    add(r.user_defined, "user defined");
+    add(r.lambda_rate_constant, "lambda rate constant");
+
+    if (!errors.empty())
+      return std::unexpected(std::move(errors));
+
+    auto sort = [&](const CompressedMatrix& matrix_columns, std::size_t count, StoichiometryMatrix& matrix)
+    {
+      matrix.by_species = Transpose(matrix_columns, stoichiometry.species);
+      matrix.by_reaction = Transpose(matrix.by_species, count);
+    };
+    const std::size_t reactions = stoichiometry.order.size;
+    const std::size_t branched = r.branched.size();
+    sort(columns.reactants, reactions, stoichiometry.reactants);
+    sort(columns.net, reactions, stoichiometry.net);
+    sort(columns.nitrate_products, branched, stoichiometry.nitrate_products);
+    sort(columns.alkoxy_products, branched, stoichiometry.alkoxy_products);
+    return stoichiometry;
+  }
+}  // namespace mechanism_configuration
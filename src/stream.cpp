@@ -0,0 +1,579 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/stream.hpp"
+
+#include "detail/location.hpp"
+
+#include <yaml-cpp/eventhandler.h>
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <stdexcept>
+#include <streambuf>
+#include <system_error>
+#include <thread>
+
+namespace mechanism_configuration
+{
+  namespace
+  {
+    // Lets yaml-cpp read an in-memory document without copying it into a std::istringstream.
+    class MemoryBuffer : public std::streambuf
+    {
+     public:
+      explicit MemoryBuffer(std::string_view text)
+      {
+        char* begin = const_cast<char*>(text.data());
+        setg(begin, begin, begin + text.size());
+      }
+    };
+
+    // Thrown by an event handler to stop the scan once it has what it needs.
+    struct StopScan
+    {
+    };
+
+    // Thrown by an event handler when the document cannot be streamed.
+    struct CannotStream
+    {
+    };
+
+    enum class NodeKind
+    {
+      Scalar,
+      Null,
+      Alias,
+      Sequence,
+      Map,
+    };
+
+    bool IsSpace(char c)
+    {
+      return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    // Returns the index just past the quoted scalar that opens at `begin`, or npos if unterminated.
+    std::size_t QuotedScalarEnd(std::string_view text, std::size_t begin)
+    {
+      const char quote = text[begin];
+      for (std::size_t i = begin + 1; i < text.size(); ++i)
+      {
+        if (quote == '"' && text[i] == '\\')
+          ++i;
+        else if (text[i] == quote)
+        {
+          // '' is an escaped quote inside a single-quoted scalar
+          if (quote == '\'' && i + 1 < text.size() && text[i + 1] == '\'')
+            ++i;
+          else
+            return i + 1;
+        }
+      }
+      return std::string_view::npos;
+    }
+
+    // Returns the length of the flow node at the start of `text`: through the matching bracket for
+    // a flow collection, or up to the next flow indicator for a scalar. Flow scalars cannot contain
+    // unquoted brackets or commas, so only quotes and comments need special handling. Returns npos
+    // if the node is not terminated.
+    std::size_t FlowNodeLength(std::string_view text)
+    {
+      int depth = 0;
+      char previous = ',';  // last significant character; a quote only opens a scalar after one of ",:[{?"
+      for (std::size_t i = 0; i < text.size(); ++i)
+      {
+        const char c = text[i];
+        switch (c)
+        {
+          case '{':
+          case '[': ++depth; break;
+          case '}':
+          case ']':
+            if (depth == 0)
+              return i;
+            if (--depth == 0)
+              return i + 1;
+            break;
+          case ',':
+            if (depth == 0)
+              return i;
+            break;
+          case '"':
+          case '\'':
+            if (previous == ',' || previous == ':' || previous == '[' || previous == '{' || previous == '?')
+            {
+              const std::size_t end = QuotedScalarEnd(text, i);
+              if (end == std::string_view::npos)
+                return end;
+              i = end - 1;
+            }
+            break;
+          case '#':
+            if (i > 0 && IsSpace(text[i - 1]))
+            {
+              while (i < text.size() && text[i] != '\n')
+                ++i;
+              continue;
+            }
+            break;
+          default: break;
+        }
+        if (!IsSpace(c))
+          previous = c;
+      }
+      return depth == 0 ? text.size() : std::string_view::npos;
+    }
+
+    // Counts the scalar and null nodes (map keys included) under a loaded node.
+    std::size_t CountLeaves(const YAML::Node& node)
+    {
+      switch (node.Type())
+      {
+        case YAML::NodeType::Scalar:
+        case YAML::NodeType::Null: return 1;
+        case YAML::NodeType::Sequence:
+        {
+          std::size_t count = 0;
+          for (const auto& item : node)
+            count += CountLeaves(item);
+          return count;
+        }
+        case YAML::NodeType::Map:
+        {
+          std::size_t count = 0;
+          for (const auto& item : node)
+            count += CountLeaves(item.first) + CountLeaves(item.second);
+          return count;
+        }
+        default: return 0;
+      }
+    }
+
+    // Tracks container depth and which root-map child (key or value) each node is. Derived
+    // handlers see every node start through OnNode and every container end through OnEnd.
+    class DocumentScanner : public YAML::EventHandler
+    {
+     public:
+      void OnDocumentStart(const YAML::Mark&) override
+      {
+      }
+
+      void OnDocumentEnd() override
+      {
+        OnDocumentFinished();
+      }
+
+      void OnNull(const YAML::Mark& mark, YAML::anchor_t anchor) override
+      {
+        Begin(mark, anchor, NodeKind::Null, nullptr, YAML::EmitterStyle::Default);
+      }
+
+      void OnAlias(const YAML::Mark& mark, YAML::anchor_t) override
+      {
+        Begin(mark, YAML::NullAnchor, NodeKind::Alias, nullptr, YAML::EmitterStyle::Default);
+      }
+
+      void OnScalar(const YAML::Mark& mark, const std::string&, YAML::anchor_t anchor, const std::string& value) override
+      {
+        Begin(mark, anchor, NodeKind::Scalar, &value, YAML::EmitterStyle::Default);
+      }
+
+      void OnSequenceStart(
+          const YAML::Mark& mark,
+          const std::string&,
+          YAML::anchor_t anchor,
+          YAML::EmitterStyle::value style) override
+      {
+        Begin(mark, anchor, NodeKind::Sequence, nullptr, style);
+        ++depth_;
+      }
+
+      void OnSequenceEnd() override
+      {
+        --depth_;
+        OnEnd();
+      }
+
+      void OnMapStart(
+          const YAML::Mark& mark,
+          const std::string&,
+          YAML::anchor_t anchor,
+          YAML::EmitterStyle::value style) override
+      {
+        Begin(mark, anchor, NodeKind::Map, nullptr, style);
+        ++depth_;
+      }
+
+      void OnMapEnd() override
+      {
+        --depth_;
+        OnEnd();
+      }
+
+     protected:
+      // Number of containers open around the node being reported.
+      int depth_ = 0;
+      // Whether the document root is a map; root-map children are then reported with `is_key`.
+      bool root_is_map_ = false;
+
+      virtual void OnNode(
+          const YAML::Mark& mark,
+          YAML::anchor_t anchor,
+          NodeKind kind,
+          const std::string* value,
+          YAML::EmitterStyle::value style,
+          bool is_key) = 0;
+      virtual void OnEnd() = 0;
+      virtual void OnDocumentFinished() = 0;
+
+     private:
+      std::size_t root_children_ = 0;
+
+      void Begin(
+          const YAML::Mark& mark,
+          YAML::anchor_t anchor,
+          NodeKind kind,
+          const std::string* value,
+          YAML::EmitterStyle::value style)
+      {
+        if (depth_ == 0)
+          root_is_map_ = kind == NodeKind::Map;
+        const bool is_key = depth_ == 1 && root_is_map_ && root_children_ % 2 == 0;
+        if (depth_ == 1)
+          ++root_children_;
+        OnNode(mark, anchor, kind, value, style, is_key);
+      }
+    };
+
+    class TopLevelScalarFinder : public DocumentScanner
+    {
+     public:
+      explicit TopLevelScalarFinder(std::string_view key)
+          : key_(key)
+      {
+      }
+
+      std::optional<TopLevelScalar> found;
+
+     protected:
+      void OnNode(
+          const YAML::Mark& mark,
+          YAML::anchor_t,
+          NodeKind kind,
+          const std::string* value,
+          YAML::EmitterStyle::value,
+          bool is_key) override
+      {
+        if (depth_ == 0 && !root_is_map_)
+          throw StopScan{};
+        if (depth_ != 1)
+          return;
+        if (is_key)
+        {
+          matched_ = kind == NodeKind::Scalar && *value == key_;
+          return;
+        }
+        if (!matched_)
+          return;
+        if (kind == NodeKind::Scalar)
+          found = TopLevelScalar{ *value, ErrorLocation{ mark.line, mark.column } };
+        throw StopScan{};
+      }
+
+      void OnEnd() override
+      {
+      }
+
+      void OnDocumentFinished() override
+      {
+      }
+
+     private:
+      std::string_view key_;
+      bool matched_ = false;
+    };
+
+    // Streams the elements of the target sequence. An element's text runs from its start mark to
+    // the start mark of whatever follows it, trimmed back to the element itself.
+    class SequenceStreamer : public DocumentScanner
+    {
+     public:
+      SequenceStreamer(std::string_view text, std::string_view key, const std::function<void(const YAML::Node&)>& visit)
+          : text_(text),
+            key_(key),
+            visit_(visit)
+      {
+      }
+
+      // Replaces the streamed sequence by `[]`, keeping every other character's position.
+      bool BlankSequence(std::string& text) const
+      {
+        if (!sequence_begin_)
+          return true;
+        std::size_t end = sequence_end_;
+        if (sequence_flow_)
+        {
+          const std::size_t length = FlowNodeLength(std::string_view(text).substr(*sequence_begin_));
+          if (length == std::string_view::npos)
+            return false;
+          end = *sequence_begin_ + length;
+        }
+        if (end < *sequence_begin_ + 2 || end > text.size())
+          return false;
+        text[*sequence_begin_] = '[';
+        text[*sequence_begin_ + 1] = ']';
+        for (std::size_t i = *sequence_begin_ + 2; i < end; ++i)
+          if (text[i] != '\n' && text[i] != '\r')
+            text[i] = ' ';
+        return true;
+      }
+
+     protected:
+      void OnNode(
+          const YAML::Mark& mark,
+          YAML::anchor_t anchor,
+          NodeKind kind,
+          const std::string* value,
+          YAML::EmitterStyle::value style,
+          bool is_key) override
+      {
+        // Anchors and aliases tie elements to other parts of the document.
+        if (anchor != YAML::NullAnchor || kind == NodeKind::Alias)
+          throw CannotStream{};
+
+        Reached(static_cast<std::size_t>(mark.pos));
+
+        if (depth_ == 0)
+        {
+          if (key_.empty() && kind != NodeKind::Sequence)
+            throw CannotStream{};
+          if (!key_.empty() && !root_is_map_)
+            throw StopScan{};
+        }
+
+        if (!sequence_begin_)
+        {
+          const bool is_target = key_.empty() ? depth_ == 0 : (depth_ == 1 && !is_key && matched_);
+          if (depth_ == 1 && is_key)
+            matched_ = kind == NodeKind::Scalar && *value == key_;
+          if (is_target && kind != NodeKind::Sequence)
+            throw StopScan{};
+          if (is_target)
+          {
+            sequence_begin_ = static_cast<std::size_t>(mark.pos);
+            sequence_flow_ = style == YAML::EmitterStyle::Flow;
+            sequence_depth_ = depth_ + 1;
+            in_sequence_ = true;
+          }
+          return;
+        }
+
+        if (!in_sequence_)
+          return;
+
+        if (depth_ == sequence_depth_)
+        {
+          if (kind == NodeKind::Null)
+            throw CannotStream{};
+          element_ = Element{ mark, 0, false };
+        }
+        if (kind == NodeKind::Scalar || kind == NodeKind::Null)
+        {
+          ++element_->leaves;
+          if (depth_ == sequence_depth_)
+            element_->complete = true;
+        }
+      }
+
+      void OnEnd() override
+      {
+        if (!in_sequence_)
+          return;
+        if (depth_ == sequence_depth_ && element_)
+          element_->complete = true;
+        else if (depth_ == sequence_depth_ - 1)
+        {
+          in_sequence_ = false;
+          awaiting_end_ = true;
+        }
+      }
+
+      void OnDocumentFinished() override
+      {
+        Reached(text_.size());
+      }
+
+     private:
+      struct Element
+      {
+        YAML::Mark mark;
+        std::size_t leaves;
+        bool complete;
+      };
+
+      std::string_view text_;
+      std::string_view key_;
+      const std::function<void(const YAML::Node&)>& visit_;
+
+      bool matched_ = false;
+      std::optional<std::size_t> sequence_begin_;
+      std::size_t sequence_end_ = 0;
+      bool sequence_flow_ = false;
+      int sequence_depth_ = 0;
+      bool in_sequence_ = false;
+      bool awaiting_end_ = false;
+      std::optional<Element> element_;
+
+      // Called with the position of each mark (and the end of the document): whatever was
+      // pending before that position is now complete.
+      void Reached(std::size_t position)
+      {
+        if (element_ && element_->complete)
+        {
+          Visit(position);
+          element_.reset();
+        }
+        if (awaiting_end_)
+        {
+          sequence_end_ = position;
+          awaiting_end_ = false;
+          throw StopScan{};
+        }
+      }
+
+      void Visit(std::size_t end)
+      {
+        const std::size_t begin = static_cast<std::size_t>(element_->mark.pos);
+        if (end <= begin || end > text_.size())
+          throw CannotStream{};
+        std::string_view slice = text_.substr(begin, end - begin);
+
+        if (sequence_flow_ || slice.front() == '{' || slice.front() == '[')
+        {
+          const std::size_t length = FlowNodeLength(slice);
+          if (length == std::string_view::npos)
+            throw CannotStream{};
+          slice = slice.substr(0, length);
+        }
+        else
+        {
+          // A block element runs up to the next element's `-` indicator; drop that line.
+          const std::size_t last_line = slice.find_last_of('\n');
+          if (last_line != std::string_view::npos)
+          {
+            const std::string_view tail = slice.substr(last_line + 1);
+            const std::size_t indicator = tail.find_first_not_of(" \t");
+            if (indicator != std::string_view::npos && tail[indicator] == '-' &&
+                tail.find_first_not_of(" \t", indicator + 1) == std::string_view::npos)
+              slice = slice.substr(0, last_line + 1);
+          }
+        }
+
+        // Pad the first line so columns match the original document.
+        std::string fragment(static_cast<std::size_t>(element_->mark.column), ' ');
+        fragment.append(slice);
+
+        YAML::Node node;
+        try
+        {
+          node = YAML::Load(fragment);
+        }
+        catch (const YAML::Exception&)
+        {
+          throw CannotStream{};
+        }
+        // The slice must hold exactly the element, no more and no less.
+        if (CountLeaves(node) != element_->leaves)
+          throw CannotStream{};
+
+        ScopedLineOrigin origin(element_->mark.line);
+        ScopedSource source(fragment);
+        visit_(node);
+      }
+    };
+
+    void Scan(std::string_view text, YAML::EventHandler& handler)
+    {
+      MemoryBuffer buffer(text);
+      std::istream input(&buffer);
+      YAML::Parser parser(input);
+      try
+      {
+        parser.HandleNextDocument(handler);
+      }
+      catch (const StopScan&)
+      {
+      }
+    }
+  }  // namespace
+
+  std::optional<std::string> ReadFileContents(const std::filesystem::path& path)
+  {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+      return std::nullopt;
+    std::string contents{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    if (file.bad())
+      return std::nullopt;
+    return contents;
+  }
+
+  void WriteFileAtomically(const std::filesystem::path& path, std::string_view bytes)
+  {
+    const auto unique = std::hash<std::thread::id>{}(std::this_thread::get_id()) ^
+                        static_cast<std::size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    std::filesystem::path temporary = path;
+    temporary += ".tmp" + std::to_string(unique);
+    {
+      std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+      file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+      file.close();
+      if (!file)
+      {
+        std::error_code ignored;
+        std::filesystem::remove(temporary, ignored);
+        throw std::runtime_error("could not write '" + temporary.string() + "'");
+      }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error)
+    {
+      std::error_code ignored;
+      std::filesystem::remove(temporary, ignored);
+      throw std::runtime_error(error.message());
+    }
+  }
+
+  std::optional<TopLevelScalar> FindTopLevelScalar(std::string_view text, std::string_view key)
+  {
+    TopLevelScalarFinder finder(key);
+    Scan(text, finder);
+    return finder.found;
+  }
+
+  bool StreamSequence(std::string& text, std::string_view key, const std::function<void(const YAML::Node&)>& visit)
+  {
+    // Marks count characters after decoding; only plain UTF-8 (no byte-order mark) lines up
+    // with byte offsets into `text`.
+    if (text.starts_with("\xEF\xBB\xBF"))
+      return false;
+
+    SequenceStreamer streamer(text, key, visit);
+    try
+    {
+      Scan(text, streamer);
+    }
+    catch (const CannotStream&)
+    {
+      return false;
+    }
+    return streamer.BlankSequence(text);
+  }
+}  // namespace mechanism_configuration
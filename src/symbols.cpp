@@ -0,0 +1,68 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/types/symbols.hpp>
+
+namespace mechanism_configuration::types
+{
+  SymbolTable::SymbolTable(const SymbolTable& other)
+      : names_(other.names_)
+  {
+    Reindex();
+  }
+
+  SymbolTable& SymbolTable::operator=(const SymbolTable& other)
+  {
+    if (this != &other)
+    {
+      names_ = other.names_;
+      Reindex();
+    }
+    return *this;
+  }
+
+  std::size_t SymbolTable::Intern(std::string_view name)
+  {
+    if (auto existing = indices_.find(name); existing != indices_.end())
+      return existing->second;
+    const std::size_t index = names_.size();
+    names_.emplace_back(name);
+    indices_.emplace(names_.back(), index);
+    return index;
+  }
+
+  std::size_t SymbolTable::Append(std::string_view name)
+  {
+    const std::size_t index = names_.size();
+    names_.emplace_back(name);
+    indices_.try_emplace(names_.back(), index);
+    return index;
+  }
+
+  std::optional<std::size_t> SymbolTable::Find(std::string_view name) const
+  {
+    if (auto found = indices_.find(name); found != indices_.end())
+      return found->second;
+    return std::nullopt;
+  }
+
+  std::size_t SymbolTable::IndexOf(std::string_view name) const
+  {
+    return Find(name).value_or(NO_INDEX);
+  }
+
+  void SymbolTable::clear()
+  {
+    names_.clear();
+    indices_.clear();
+  }
+
+  void SymbolTable::Reindex()
+  {
+    indices_.clear();
+    indices_.reserve(names_.size());
+    for (std::size_t index = 0; index < names_.size(); ++index)
+      indices_.try_emplace(names_[index], index);
+  }
+}  // namespace mechanism_configuration::types
@@ -0,0 +1,971 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/synthetic.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  std::size_t SyntheticReactionCounts::Total() const
+  {
+    return arrhenius + branched + emission + first_order_loss + photolysis + surface + taylor_series + troe +
+           ternary_chemical_activation + tunneling + user_defined + lambda_rate_constant;
+  }
+
+  namespace
+  {
+    constexpr std::string_view GAS_PHASE = "gas";
+    constexpr std::string_view SOLVENT = "H2O";
+    constexpr std::string_view MECHANISM_NAME = "synthetic";
+
+    // The reaction kinds, in the order their reactions are written and numbered
+    enum class Kind
+    {
+      Arrhenius,
+      Branched,
+      Emission,
+      FirstOrderLoss,
+      Photolysis,
+      Surface,
+      TaylorSeries,
+      Troe,
+      TernaryChemicalActivation,
+      Tunneling,
+      UserDefined,
+      LambdaRateConstant,
+    };
+
+    std::array<std::size_t, 12> Counts(const SyntheticReactionCounts& c)
+    {
+      return { c.arrhenius, c.branched, c.emission, c.first_order_loss, c.photolysis, c.surface, c.taylor_series, c.troe,
+               c.ternary_chemical_activation, c.tunneling, c.user_defined, c.lambda_rate_constant };
+    }
+
+    std::string_view TypeName(Kind kind, int version)
+    {
+      switch (kind)
+      {
+        case Kind::Arrhenius: return "ARRHENIUS";
+        case Kind::Branched: return version == 0 ? "BRANCHED" : "BRANCHED_NO_RO2";
+        case Kind::Emission: return "EMISSION";
+        case Kind::FirstOrderLoss: return "FIRST_ORDER_LOSS";
+        case Kind::Photolysis: return "PHOTOLYSIS";
+        case Kind::Surface: return "SURFACE";
+        case Kind::TaylorSeries: return "TAYLOR_SERIES";
+        case Kind::Troe: return "TROE";
+        case Kind::TernaryChemicalActivation: return "TERNARY_CHEMICAL_ACTIVATION";
+        case Kind::Tunneling: return "TUNNELING";
+        case Kind::UserDefined: return "USER_DEFINED";
+        case Kind::LambdaRateConstant: return "LAMBDA_RATE_CONSTANT";
+      }
+      return "";
+    }
+
+    // Each entry draws its values from its own generator, seeded by (seed, stream, index), so an
+    // entry is the same whatever the format or file layout.
+    enum class Stream : std::uint64_t
+    {
+      Species = 1,
+      Reactions,
+      AerosolProcesses,
+      EmissionSources,
+    };
+
+    // SplitMix64. The standard distributions are implementation-defined, so values are computed
+    // from the raw 64-bit output to keep the generated bytes the same on every platform.
+    class Random
+    {
+     public:
+      Random(std::uint64_t seed, Stream stream, std::uint64_t index)
+          : state_(Mix(seed + Mix((static_cast<std::uint64_t>(stream) << 56) + index)))
+      {
+      }
+
+      std::uint64_t Next()
+      {
+        state_ += GOLDEN_GAMMA;
+        return Mix(state_);
+      }
+
+      /// @brief A value in [low, high)
+      double Uniform(double low, double high)
+      {
+        return low + (high - low) * static_cast<double>(Next() >> 11) * 0x1.0p-53;
+      }
+
+      /// @brief A value in [0, n)
+      std::size_t Index(std::size_t n)
+      {
+        return static_cast<std::size_t>(Next() % n);
+      }
+
+     private:
+      static constexpr std::uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+
+      static std::uint64_t Mix(std::uint64_t z)
+      {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+      }
+
+      std::uint64_t state_;
+    };
+
+    // A YAML scalar that reads back as the same string without quotes
+    bool IsPlainYaml(std::string_view text)
+    {
+      if (text.empty() || !std::isalpha(static_cast<unsigned char>(text.front())) || text.back() == ' ')
+        return false;
+      for (const char c : text)
+        if (!std::isalnum(static_cast<unsigned char>(c)) && std::string_view(" _-./[]").find(c) == std::string_view::npos)
+          return false;
+      for (const std::string_view reserved : { "y", "n", "yes", "no", "on", "off", "true", "false", "null" })
+        if (std::ranges::equal(
+                text, reserved, [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; }))
+          return false;
+      return true;
+    }
+
+    // Streams a document to `out` as block-style YAML or indented JSON, one value at a time, so
+    // that nothing but the open containers is held in memory.
+    class Writer
+    {
+     public:
+      Writer(std::ostream& out, SyntheticFormat format)
+          : out_(out),
+            yaml_(format == SyntheticFormat::Yaml)
+      {
+      }
+
+      /// @brief Sets the key of the next value written into a map
+      Writer& Key(std::string_view key)
+      {
+        key_ = key;
+        return *this;
+      }
+
+      void BeginMap()
+      {
+        Begin(true);
+      }
+
+      void BeginList()
+      {
+        Begin(false);
+      }
+
+      void End()
+      {
+        const Frame frame = std::move(frames_.back());
+        frames_.pop_back();
+        if (!yaml_)
+        {
+          if (frame.has_items)
+          {
+            out_ << '\n';
+            Indent(frames_.size() * 2);
+          }
+          out_ << (frame.map ? '}' : ']');
+          if (frames_.empty())
+            out_ << '\n';
+          return;
+        }
+        if (frame.open)
+          return;
+        // A container is only written once it has an entry, so an empty one is written here.
+        const std::string_view empty = frame.map ? "{}" : "[]";
+        if (frames_.empty())
+        {
+          out_ << empty << '\n';
+          return;
+        }
+        YamlEntry(frame.key);
+        out_ << ' ' << empty << '\n';
+      }
+
+      void String(std::string_view value)
+      {
+        if (yaml_ && IsPlainYaml(value))
+          Scalar(value);
+        else
+          Scalar(Quoted(value));
+      }
+
+      void Number(double value)
+      {
+        char buffer[32];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        Scalar(std::string_view(buffer, result.ptr));
+      }
+
+      void Integer(std::size_t value)
+      {
+        char buffer[24];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        Scalar(std::string_view(buffer, result.ptr));
+      }
+
+      void Field(std::string_view key, std::string_view value)
+      {
+        Key(key).String(value);
+      }
+
+      void Field(std::string_view key, double value)
+      {
+        Key(key).Number(value);
+      }
+
+     private:
+      struct Frame
+      {
+        bool map;
+        std::string key;         // The key of this container in its parent map
+        bool open{ false };      // YAML: whether the line introducing this container is written
+        bool has_items{ false };  // JSON: whether an entry is written
+      };
+
+      void Begin(bool map)
+      {
+        if (!yaml_ && !frames_.empty())
+          JsonEntry();
+        if (!yaml_)
+          out_ << (map ? '{' : '[');
+        frames_.push_back({ map, key_ });
+      }
+
+      void Scalar(std::string_view text)
+      {
+        if (yaml_)
+        {
+          YamlEntry(key_);
+          out_ << ' ' << text << '\n';
+          return;
+        }
+        JsonEntry();
+        out_ << text;
+      }
+
+      // Starts an entry of the innermost container: its key or list marker, on a new line.
+      void JsonEntry()
+      {
+        Frame& frame = frames_.back();
+        out_ << (frame.has_items ? ",\n" : "\n");
+        frame.has_items = true;
+        Indent(frames_.size() * 2);
+        if (frame.map)
+          out_ << Quoted(key_) << ": ";
+      }
+
+      // Starts an entry of the innermost container: "key:" or "-", after writing the lines that
+      // introduce any enclosing containers that have no entries yet.
+      void YamlEntry(std::string_view key)
+      {
+        Open(frames_.size() - 1);
+        const Frame& frame = frames_.back();
+        YamlIndent(frames_.size() - 1);
+        if (frame.map)
+          out_ << (IsPlainYaml(key) ? std::string(key) : Quoted(key)) << ':';
+        else
+          out_ << '-';
+      }
+
+      void Open(std::size_t depth)
+      {
+        if (frames_[depth].open)
+          return;
+        frames_[depth].open = true;
+        if (depth == 0)
+          return;
+        Open(depth - 1);
+        YamlIndent(depth - 1);
+        if (frames_[depth - 1].map)
+        {
+          const std::string& key = frames_[depth].key;
+          out_ << (IsPlainYaml(key) ? key : Quoted(key)) << ":\n";
+        }
+        else
+        {
+          // The first entry of a container in a list goes on the same line as its "- "
+          out_ << "- ";
+          same_line_ = true;
+        }
+      }
+
+      // Indents an entry of the container at `depth`, unless it follows a list marker
+      void YamlIndent(std::size_t depth)
+      {
+        if (same_line_)
+          same_line_ = false;
+        else
+          Indent(depth * 2);
+      }
+
+      void Indent(std::size_t width)
+      {
+        static const std::string spaces(64, ' ');
+        for (; width > spaces.size(); width -= spaces.size())
+          out_ << spaces;
+        out_.write(spaces.data(), static_cast<std::streamsize>(width));
+      }
+
+      static std::string Quoted(std::string_view text)
+      {
+        std::string quoted = "\"";
+        for (const char c : text)
+        {
+          if (c == '"' || c == '\\')
+            quoted += '\\';
+          quoted += c;
+        }
+        return quoted + '"';
+      }
+
+      std::ostream& out_;
+      bool yaml_;
+      std::string key_;
+      std::vector<Frame> frames_;
+      bool same_line_{ false };
+    };
+
+    std::string SpeciesName(std::size_t i)
+    {
+      return "S" + std::to_string(i);
+    }
+
+    // Condensed phases are numbered from 1, after the gas phase
+    std::string CondensedPhaseName(std::size_t p)
+    {
+      return "aqueous_" + std::to_string(p);
+    }
+
+    // Two different species
+    std::array<std::size_t, 2> PickSpecies(Random& random, std::size_t n_species)
+    {
+      const std::size_t first = random.Index(n_species);
+      return { first, (first + 1 + random.Index(n_species - 1)) % n_species };
+    }
+
+    // A reactant or product list of `count` (1 or 2) different species: a list of components in
+    // v1, and a map from species name to its `qty` or `yield` in v0.
+    void Components(
+        Writer& w,
+        const SyntheticOptions& options,
+        std::string_view key,
+        std::string_view name_key,
+        Random& random,
+        std::size_t count,
+        bool products)
+    {
+      const auto species = PickSpecies(random, options.species);
+      w.Key(key);
+      if (options.version == 0)
+        w.BeginMap();
+      else
+        w.BeginList();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const double coefficient = products ? random.Uniform(0.1, 2.0) : 1.0;
+        if (options.version == 0)
+        {
+          w.Key(SpeciesName(species[i])).BeginMap();
+          w.Field(products ? "yield" : "qty", coefficient);
+        }
+        else
+        {
+          w.BeginMap();
+          w.Field(name_key, SpeciesName(species[i]));
+          w.Field("coefficient", coefficient);
+        }
+        w.End();
+      }
+      w.End();
+    }
+
+    void Reaction(Writer& w, const SyntheticOptions& options, Kind kind, std::size_t i)
+    {
+      Random random(options.seed, Stream::Reactions, i);
+      const bool v0 = options.version == 0;
+      const std::string name = "R" + std::to_string(i);
+      auto components = [&](std::string_view key, std::size_t count, bool products)
+      { Components(w, options, key, "species name", random, count, products); };
+      auto species = [&](std::string_view key) { w.Field(key, SpeciesName(random.Index(options.species))); };
+
+      w.BeginMap();
+      w.Field("type", TypeName(kind, options.version));
+      if (!v0)
+      {
+        w.Field("name", name);
+        w.Field("gas phase", GAS_PHASE);
+      }
+      else if (kind == Kind::Emission || kind == Kind::FirstOrderLoss || kind == Kind::Photolysis || kind == Kind::Surface ||
+               kind == Kind::UserDefined)
+        w.Field("MUSICA name", name);
+
+      switch (kind)
+      {
+        case Kind::Arrhenius:
+        case Kind::TaylorSeries:
+          w.Field("A", random.Uniform(1.0e-13, 1.0e-11));
+          w.Field("B", random.Uniform(-2.0, 0.0));
+          w.Field("C", random.Uniform(-500.0, 500.0));
+          w.Field("D", 300.0);
+          w.Field("E", random.Uniform(0.0, 1.0e-3));
+          if (kind == Kind::TaylorSeries)
+          {
+            w.Key("taylor coefficients").BeginList();
+            w.Number(1.0);
+            w.Number(random.Uniform(-0.1, 0.1));
+            w.Number(random.Uniform(-0.01, 0.01));
+            w.End();
+          }
+          components("reactants", kind == Kind::Arrhenius ? 2 : 1, false);
+          components("products", 2, true);
+          break;
+        case Kind::Branched:
+          w.Field("X", random.Uniform(1.0e-5, 1.0e-3));
+          w.Field("Y", random.Uniform(100.0, 200.0));
+          w.Field("a0", random.Uniform(0.1, 0.3));
+          w.Field("n", static_cast<double>(random.Index(10) + 1));
+          components("reactants", 1, false);
+          components("alkoxy products", 2, true);
+          components("nitrate products", 1, true);
+          break;
+        case Kind::Emission:
+          w.Field("scaling factor", random.Uniform(0.5, 1.5));
+          if (v0)
+            species("species");
+          else
+            components("products", 1, true);
+          break;
+        case Kind::FirstOrderLoss:
+          w.Field("scaling factor", random.Uniform(0.5, 1.5));
+          if (v0)
+            species("species");
+          else
+            components("reactants", 1, false);
+          break;
+        case Kind::Photolysis:
+          w.Field("scaling factor", random.Uniform(0.5, 1.5));
+          components("reactants", 1, false);
+          components("products", 2, true);
+          break;
+        case Kind::Surface:
+          w.Field("reaction probability", random.Uniform(1.0e-3, 0.1));
+          species(v0 ? "gas-phase reactant" : "gas-phase species");
+          components("gas-phase products", 2, true);
+          break;
+        case Kind::Troe:
+        case Kind::TernaryChemicalActivation:
+          w.Field("k0_A", random.Uniform(1.0e-33, 1.0e-30));
+          w.Field("k0_B", random.Uniform(-3.0, 0.0));
+          w.Field("k0_C", random.Uniform(0.0, 100.0));
+          w.Field("kinf_A", random.Uniform(1.0e-12, 1.0e-10));
+          w.Field("kinf_B", random.Uniform(-1.0, 0.0));
+          w.Field("kinf_C", random.Uniform(0.0, 100.0));
+          w.Field("Fc", random.Uniform(0.4, 0.9));
+          w.Field("N", 1.0);
+          components("reactants", 2, false);
+          components("products", 1, true);
+          break;
+        case Kind::Tunneling:
+          w.Field("A", random.Uniform(1.0e-13, 1.0e-11));
+          w.Field("B", random.Uniform(1000.0, 2000.0));
+          w.Field("C", random.Uniform(1.0e7, 1.0e9));
+          components("reactants", 2, false);
+          components("products", 2, true);
+          break;
+        case Kind::UserDefined:
+          w.Field("scaling factor", random.Uniform(0.5, 1.5));
+          components("reactants", 2, false);
+          components("products", 1, true);
+          break;
+        case Kind::LambdaRateConstant:
+        {
+          char a[32], c[32];
+          const auto a_end = std::to_chars(a, a + sizeof(a), random.Uniform(1.0e-13, 1.0e-11)).ptr;
+          const auto c_end = std::to_chars(c, c + sizeof(c), random.Uniform(-500.0, 500.0)).ptr;
+          w.Field(
+              "lambda function",
+              "[](double T, double P) { return " + std::string(a, a_end) + " * exp(" + std::string(c, c_end) + " / T); }");
+          components("reactants", 1, false);
+          components("products", 1, true);
+          break;
+        }
+      }
+      w.End();
+    }
+
+    // The reactions numbered [begin, end), as a list
+    void ReactionList(Writer& w, const SyntheticOptions& options, std::size_t begin, std::size_t end)
+    {
+      w.BeginList();
+      const auto counts = Counts(options.reactions);
+      std::size_t first = 0;  // the number of the first reaction of each kind
+      for (std::size_t k = 0; k < counts.size(); ++k)
+      {
+        for (std::size_t i = std::max(begin, first); i < std::min(end, first + counts[k]); ++i)
+          Reaction(w, options, static_cast<Kind>(k), i);
+        first += counts[k];
+      }
+      w.End();
+    }
+
+    void V1SpeciesList(Writer& w, const SyntheticOptions& options)
+    {
+      w.BeginList();
+      for (std::size_t i = 0; i < options.species; ++i)
+      {
+        Random random(options.seed, Stream::Species, i);
+        w.BeginMap();
+        w.Field("name", SpeciesName(i));
+        w.Field("molecular weight [kg mol-1]", random.Uniform(0.01, 0.3));
+        w.End();
+      }
+      if (options.phases > 1)
+      {
+        w.BeginMap();
+        w.Field("name", SOLVENT);
+        w.Field("molecular weight [kg mol-1]", 0.01801);
+        w.End();
+      }
+      w.End();
+    }
+
+    void V1PhaseList(Writer& w, const SyntheticOptions& options)
+    {
+      w.BeginList();
+      w.BeginMap();
+      w.Field("name", GAS_PHASE);
+      w.Key("species").BeginList();
+      for (std::size_t i = 0; i < options.species; ++i)
+      {
+        Random random(options.seed, Stream::Species, i);
+        random.Next();  // the molecular weight
+        w.BeginMap();
+        w.Field("name", SpeciesName(i));
+        w.Field("diffusion coefficient [m2 s-1]", random.Uniform(1.0e-5, 3.0e-5));
+        w.End();
+      }
+      w.End();
+      w.End();
+      for (std::size_t p = 1; p < options.phases; ++p)
+      {
+        w.BeginMap();
+        w.Field("name", CondensedPhaseName(p));
+        w.Key("species").BeginList();
+        for (std::size_t i = 0; i < options.species; ++i)
+        {
+          w.BeginMap();
+          w.Field("name", SpeciesName(i));
+          w.End();
+        }
+        w.BeginMap();
+        w.Field("name", SOLVENT);
+        w.Field("density [kg m-3]", 997.0);
+        w.End();
+        w.End();
+        w.End();
+      }
+      w.End();
+    }
+
+    void AerosolRepresentationList(Writer& w, const SyntheticOptions& options)
+    {
+      w.BeginList();
+      for (std::size_t p = 1; p < options.phases; ++p)
+      {
+        w.BeginMap();
+        w.Field("type", "UNIFORM_SECTION");
+        w.Field("name", "section_" + std::to_string(p));
+        w.Key("phases").BeginList();
+        w.String(CondensedPhaseName(p));
+        w.End();
+        w.Field("minimum radius [m]", 1.0e-6);
+        w.Field("maximum radius [m]", 1.0e-5);
+        w.End();
+      }
+      w.End();
+    }
+
+    // Rate constants use the aerosol { type, A, C } form
+    void AerosolRateConstant(Writer& w, std::string_view key, std::string_view type, Random& random)
+    {
+      w.Key(key).BeginMap();
+      w.Field("type", type);
+      w.Field("A", random.Uniform(1.0e6, 1.0e9));
+      if (type == "EQUILIBRIUM")
+      {
+        w.Field("C [K]", random.Uniform(0.0, 5000.0));
+        w.Field("T0 [K]", 298.15);
+      }
+      else
+        w.Field("C", random.Uniform(0.0, 5000.0));
+      w.End();
+    }
+
+    // Processes alternate between dissolved and reversible dissolved reactions, and cycle through
+    // the condensed phases.
+    void AerosolProcessList(Writer& w, const SyntheticOptions& options, std::size_t begin, std::size_t end)
+    {
+      w.BeginList();
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        Random random(options.seed, Stream::AerosolProcesses, i);
+        const bool reversible = i % 2 == 1;
+        w.BeginMap();
+        w.Field("type", reversible ? "DISSOLVED_REVERSIBLE_REACTION" : "DISSOLVED_REACTION");
+        w.Field("condensed phase", CondensedPhaseName(1 + i % (options.phases - 1)));
+        w.Field("solvent", SOLVENT);
+        Components(w, options, "reactants", "name", random, 2, false);
+        Components(w, options, "products", "name", random, 1, true);
+        if (reversible)
+        {
+          AerosolRateConstant(w, "forward rate constant", "ARRHENIUS", random);
+          AerosolRateConstant(w, "equilibrium constant", "EQUILIBRIUM", random);
+        }
+        else
+          AerosolRateConstant(w, "rate constant", "ARRHENIUS", random);
+        w.End();
+      }
+      w.End();
+    }
+
+    // One inventory and species map shared by every source. Each source has its own
+    // (category, hierarchy) pair.
+    void Emissions(Writer& w, const SyntheticOptions& options)
+    {
+      static constexpr std::array<std::string_view, 6> SOURCE_TYPES = { "anthropogenic", "fire",     "biogenic",
+                                                                          "dust",          "sea salt", "lightning" };
+      constexpr std::size_t CATEGORIES = 10;
+
+      w.Key("emissions").BeginMap();
+      w.Key("inventories").BeginList();
+      w.BeginMap();
+      w.Field("name", "inventory");
+      w.Field("directory", "synthetic");
+      w.Field("file pattern", "synthetic_{YYYY}-{MM}.nc");
+      w.Field("convention", "uptempo");
+      w.End();
+      w.End();
+
+      w.Key("species maps").BeginList();
+      w.BeginMap();
+      w.Field("name", "species map");
+      w.Key("mappings").BeginList();
+      for (std::size_t i = 0; i < std::min<std::size_t>(options.species, 10); ++i)
+      {
+        w.BeginMap();
+        w.Field("inventory species", "E" + std::to_string(i));
+        w.Field("mechanism species", SpeciesName(i));
+        w.End();
+      }
+      w.End();
+      w.End();
+      w.End();
+
+      w.Key("regridding").BeginMap();
+      w.Field("type", "none");
+      w.End();
+
+      w.Key("sources").BeginList();
+      for (std::size_t i = 0; i < options.emission_sources; ++i)
+      {
+        Random random(options.seed, Stream::EmissionSources, i);
+        w.BeginMap();
+        w.Field("name", "source " + std::to_string(i));
+        w.Field("mode", "offline");
+        w.Field("type", SOURCE_TYPES[i % SOURCE_TYPES.size()]);
+        w.Field("inventory", "inventory");
+        w.Field("species map", "species map");
+        w.Field("temporal interpolation", "linear");
+        w.Field("vertical injection", "surface");
+        w.Key("category").Integer(i % CATEGORIES);
+        w.Key("hierarchy").Integer(i / CATEGORIES + 1);
+        w.Field("scaling factor", random.Uniform(0.5, 1.5));
+        w.End();
+      }
+      w.End();
+      w.End();
+    }
+
+    // Writes `body(writer)` to `path`, or reports why it could not be written.
+    template<typename Body>
+    bool WriteFile(const std::filesystem::path& path, SyntheticFormat format, Errors& errors, Body body)
+    {
+      std::vector<char> buffer(1 << 20);
+      std::ofstream out;
+      out.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      out.open(path, std::ios::binary | std::ios::trunc);
+      if (out)
+      {
+        Writer writer(out, format);
+        body(writer);
+        out.close();
+      }
+      if (!out)
+      {
+        errors.push_back({ ErrorCode::UnexpectedError, "Failed to write synthetic configuration '" + path.string() + "'." });
+        return false;
+      }
+      return true;
+    }
+
+    // The number of files to split `entries` entries across: no more than there are entries, so
+    // that no file is empty
+    std::size_t FileCount(const SyntheticOptions& options, std::size_t entries)
+    {
+      return std::min(options.files, std::max<std::size_t>(entries, 1));
+    }
+
+    // The names of `n_files` files, and the entries [begin, end) of `total` that file `f` holds
+    struct Split
+    {
+      std::vector<std::string> names;
+      std::size_t total;
+
+      Split(std::string_view prefix, std::string_view extension, std::size_t n_files, std::size_t total_entries)
+          : total(total_entries)
+      {
+        for (std::size_t f = 0; f < n_files; ++f)
+          names.push_back(std::string(prefix) + "_" + std::to_string(f) + std::string(extension));
+      }
+
+      std::size_t Begin(std::size_t f) const
+      {
+        return f * total / names.size();
+      }
+    };
+
+    void FileList(Writer& w, std::string_view key, const std::vector<std::string>& names)
+    {
+      w.Key(key).BeginMap();
+      w.Key("files").BeginList();
+      for (const auto& name : names)
+        w.String(name);
+      w.End();
+      w.End();
+    }
+
+    std::expected<std::filesystem::path, Errors>
+    WriteV1(const SyntheticOptions& options, const std::filesystem::path& directory, std::string_view extension)
+    {
+      Errors errors;
+      const SyntheticFormat format = options.format;
+      const bool split = options.files > 0;
+      const std::size_t n_reactions = options.reactions.Total();
+      const Split reactions("reactions", extension, FileCount(options, n_reactions), n_reactions);
+      const Split processes(
+          "aerosol_processes", extension, FileCount(options, options.aerosol_processes), options.aerosol_processes);
+      const std::string species_file = "species" + std::string(extension);
+      const std::string phases_file = "phases" + std::string(extension);
+
+      if (split)
+      {
+        WriteFile(directory / species_file, format, errors, [&](Writer& w) { V1SpeciesList(w, options); });
+        WriteFile(directory / phases_file, format, errors, [&](Writer& w) { V1PhaseList(w, options); });
+        for (std::size_t f = 0; f < reactions.names.size(); ++f)
+          WriteFile(
+              directory / reactions.names[f],
+              format,
+              errors,
+              [&](Writer& w) { ReactionList(w, options, reactions.Begin(f), reactions.Begin(f + 1)); });
+        if (options.aerosol_processes > 0)
+          for (std::size_t f = 0; f < processes.names.size(); ++f)
+            WriteFile(
+                directory / processes.names[f],
+                format,
+                errors,
+                [&](Writer& w) { AerosolProcessList(w, options, processes.Begin(f), processes.Begin(f + 1)); });
+      }
+
+      const std::filesystem::path main = directory / ("mechanism" + std::string(extension));
+      WriteFile(
+          main,
+          format,
+          errors,
+          [&](Writer& w)
+          {
+            w.BeginMap();
+            // The `files:` layout needs version 1.1
+            w.Field("version", split ? "1.1.0" : "1.0.0");
+            w.Field("name", MECHANISM_NAME);
+            if (split)
+            {
+              FileList(w, "species", { species_file });
+              FileList(w, "phases", { phases_file });
+              FileList(w, "reactions", reactions.names);
+            }
+            else
+            {
+              w.Key("species");
+              V1SpeciesList(w, options);
+              w.Key("phases");
+              V1PhaseList(w, options);
+              w.Key("reactions");
+              ReactionList(w, options, 0, n_reactions);
+            }
+            if (options.aerosol_processes > 0)
+            {
+              w.Key("aerosol representations");
+              AerosolRepresentationList(w, options);
+              if (split)
+                FileList(w, "aerosol processes", processes.names);
+              else
+              {
+                w.Key("aerosol processes");
+                AerosolProcessList(w, options, 0, options.aerosol_processes);
+              }
+            }
+            if (options.emission_sources > 0)
+              Emissions(w, options);
+            w.End();
+          });
+
+      if (!errors.empty())
+        return std::unexpected(std::move(errors));
+      return main;
+    }
+
+    void V0Species(Writer& w, const SyntheticOptions& options)
+    {
+      for (std::size_t i = 0; i < options.species; ++i)
+      {
+        Random random(options.seed, Stream::Species, i);
+        w.BeginMap();
+        w.Field("name", SpeciesName(i));
+        w.Field("type", "CHEM_SPEC");
+        w.Field("molecular weight [kg mol-1]", random.Uniform(0.01, 0.3));
+        w.End();
+      }
+    }
+
+    void V0Mechanism(Writer& w, const SyntheticOptions& options, std::size_t begin, std::size_t end)
+    {
+      w.BeginMap();
+      w.Field("type", "MECHANISM");
+      w.Field("name", MECHANISM_NAME);
+      w.Key("reactions");
+      ReactionList(w, options, begin, end);
+      w.End();
+    }
+
+    // Version 0 configurations are a `camp-files` list of files whose `camp-data` hold the
+    // species and the MECHANISM with the reactions.
+    std::expected<std::filesystem::path, Errors>
+    WriteV0(const SyntheticOptions& options, const std::filesystem::path& directory, std::string_view extension)
+    {
+      Errors errors;
+      const SyntheticFormat format = options.format;
+      const std::size_t n_reactions = options.reactions.Total();
+      std::vector<std::string> files;
+
+      auto camp_data = [&](const std::string& name, auto body)
+      {
+        files.push_back(name);
+        WriteFile(
+            directory / name,
+            format,
+            errors,
+            [&](Writer& w)
+            {
+              w.BeginMap();
+              w.Key("camp-data").BeginList();
+              body(w);
+              w.End();
+              w.End();
+            });
+      };
+
+      if (options.files > 0)
+      {
+        const Split reactions("reactions", extension, FileCount(options, n_reactions), n_reactions);
+        camp_data("species" + std::string(extension), [&](Writer& w) { V0Species(w, options); });
+        for (std::size_t f = 0; f < reactions.names.size(); ++f)
+          camp_data(
+              reactions.names[f],
+              [&](Writer& w) { V0Mechanism(w, options, reactions.Begin(f), reactions.Begin(f + 1)); });
+      }
+      else
+        camp_data(
+            "mechanism" + std::string(extension),
+            [&](Writer& w)
+            {
+              V0Species(w, options);
+              V0Mechanism(w, options, 0, n_reactions);
+            });
+
+      const std::filesystem::path config = directory / ("config" + std::string(extension));
+      WriteFile(
+          config,
+          format,
+          errors,
+          [&](Writer& w)
+          {
+            w.BeginMap();
+            w.Key("camp-files").BeginList();
+            for (const auto& file : files)
+              w.String(file);
+            w.End();
+            w.End();
+          });
+
+      if (!errors.empty())
+        return std::unexpected(std::move(errors));
+      return config;
+    }
+  }  // namespace
+
+  std::expected<std::filesystem::path, Errors>
+  WriteSyntheticMechanism(const SyntheticOptions& options, const std::filesystem::path& directory)
+  {
+    if (options.version != 0 && options.version != 1)
+      return std::unexpected(Errors{
+          { ErrorCode::InvalidVersion,
+            "Synthetic mechanisms can be written as version 0 or 1, not " + std::to_string(options.version) + "." } });
+
+    Errors errors;
+    if (options.species < 2)
+      errors.push_back({ ErrorCode::InvalidKey, "A synthetic mechanism needs at least 2 species." });
+    if (options.phases < 1)
+      errors.push_back({ ErrorCode::InvalidKey, "A synthetic mechanism needs at least the gas phase." });
+    if (options.aerosol_processes > 0 && options.phases < 2)
+      errors.push_back({ ErrorCode::InvalidKey, "Aerosol processes need at least one condensed phase (2 phases)." });
+    if (options.version == 0)
+    {
+      const std::vector<std::pair<bool, std::string_view>> unsupported = {
+        { options.phases > 1, "condensed phases" },
+        { options.reactions.taylor_series > 0, "TAYLOR_SERIES reactions" },
+        { options.reactions.lambda_rate_constant > 0, "LAMBDA_RATE_CONSTANT reactions" },
+        { options.aerosol_processes > 0, "aerosol processes" },
+        { options.emission_sources > 0, "emission sources" },
+      };
+      for (const auto& [requested, what] : unsupported)
+        if (requested)
+          errors.push_back(
+              { ErrorCode::InvalidVersion, "Version 0 configurations cannot have " + std::string(what) + "." });
+    }
+    if (!errors.empty())
+      return std::unexpected(std::move(errors));
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec)
+      return std::unexpected(Errors{
+          { ErrorCode::UnexpectedError, "Failed to create directory '" + directory.string() + "': " + ec.message() } });
+
+    const std::string_view extension = options.format == SyntheticFormat::Yaml ? ".yaml" : ".json";
+    return options.version == 0 ? WriteV0(options, directory, extension) : WriteV1(options, directory, extension);
+  }
+}  // namespace mechanism_configuration
@@ -0,0 +1,56 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/types/unknown_properties.hpp>
+
+#include <iterator>
+
+namespace mechanism_configuration::types
+{
+  PropertiesId UnknownProperties::Add(std::vector<UnknownProperty> properties)
+  {
+    if (properties.empty())
+      return NO_PROPERTIES;
+    const auto id = static_cast<PropertiesId>(size());
+    properties_.insert(
+        properties_.end(), std::make_move_iterator(properties.begin()), std::make_move_iterator(properties.end()));
+    offsets_.push_back(static_cast<std::uint32_t>(properties_.size()));
+    return id;
+  }
+
+  PropertiesId UnknownProperties::Append(UnknownProperties&& other)
+  {
+    const auto offset = static_cast<PropertiesId>(size());
+    const auto base = static_cast<std::uint32_t>(properties_.size());
+    properties_.insert(
+        properties_.end(),
+        std::make_move_iterator(other.properties_.begin()),
+        std::make_move_iterator(other.properties_.end()));
+    for (std::size_t i = 1; i < other.offsets_.size(); ++i)
+      offsets_.push_back(base + other.offsets_[i]);
+    other.clear();
+    return offset;
+  }
+
+  std::span<const UnknownProperty> UnknownProperties::Get(PropertiesId id) const
+  {
+    if (id >= size())
+      return {};
+    return std::span<const UnknownProperty>(properties_).subspan(offsets_[id], offsets_[id + 1] - offsets_[id]);
+  }
+
+  std::optional<std::string_view> UnknownProperties::Find(PropertiesId id, std::string_view key) const
+  {
+    for (const auto& property : Get(id))
+      if (property.key == key)
+        return property.value;
+    return std::nullopt;
+  }
+
+  void UnknownProperties::clear()
+  {
+    properties_.clear();
+    offsets_.assign(1, 0);
+  }
+}  // namespace mechanism_configuration::types
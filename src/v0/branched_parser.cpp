@@ -15,11 +15,11 @@ namespace mechanism_configuration::v0
   {
     Errors errors;
 
-    std::vector<std::string_view> required = {
-      keys::TYPE, keys::REACTANTS, keys::ALKOXY_PRODUCTS, keys::NITRATE_PRODUCTS, keys::X, keys::Y, keys::A0, keys::n
-    };
+    static const Schema schema(
+        { keys::TYPE, keys::REACTANTS, keys::ALKOXY_PRODUCTS, keys::NITRATE_PRODUCTS, keys::X, keys::Y, keys::A0, keys::n },
+        {});
 
-    auto validate = CheckSchema(object, required, {});
+    auto validate = schema.Check(object);
     errors.insert(errors.end(), validate.begin(), validate.end());
     if (validate.empty())
     {
@@ -14,10 +14,10 @@ namespace mechanism_configuration::v0
   {
     Errors errors;
 
-    std::vector<std::string_view> required = { keys::TYPE, keys::SPECIES, keys::MUSICA_NAME };
-    std::vector<std::string_view> optional = { keys::SCALING_FACTOR, keys::PRODUCTS };
+    static const Schema schema(
+        { keys::TYPE, keys::SPECIES, keys::MUSICA_NAME }, { keys::SCALING_FACTOR, keys::PRODUCTS });
 
-    auto validate = CheckSchema(object, required, optional);
+    auto validate = schema.Check(object);
     errors.insert(errors.end(), validate.begin(), validate.end());
     if (validate.empty())
     {
@@ -6,6 +6,9 @@
 
 #include "detail/constants.hpp"
 #include "detail/conversions.hpp"
+#include "detail/error_limit.hpp"
+#include "detail/parallel.hpp"
+#include "detail/parse_stats.hpp"
 #include "detail/schema.hpp"
 #include "detail/v0/keys.hpp"
 #include "detail/v0/parser_types.hpp"
@@ -13,6 +16,8 @@
 #include <yaml-cpp/yaml.h>
 
 #include <functional>
+#include <iterator>
+#include <vector>
 
 namespace mechanism_configuration::v0
 {
@@ -41,10 +46,10 @@ namespace mechanism_configuration::v0
 
   Errors ParseMechanism(const ParserMap& parsers, Mechanism& mechanism, const YAML::Node& object)
   {
-    std::vector<std::string_view> required = { keys::NAME, keys::REACTIONS, keys::TYPE };
+    static const Schema schema({ keys::NAME, keys::REACTIONS, keys::TYPE }, {});
 
     Errors errors;
-    auto validate = CheckSchema(object, required, {});
+    auto validate = schema.Check(object);
     errors.insert(errors.end(), validate.begin(), validate.end());
     if (validate.empty())
     {
@@ -56,6 +61,120 @@ namespace mechanism_configuration::v0
     return errors;
   }
 
+  namespace
+  {
+    // One CAMP file parsed into its own partial mechanism, to be merged in file order. Every
+    // file that sets the mechanism name or relative tolerance overwrites the previous value, so
+    // record which files set them.
+    struct CampFileResult
+    {
+      Mechanism mechanism;
+      bool sets_name{ false };
+      bool sets_relative_tolerance{ false };
+      Errors errors;
+    };
+
+    CampFileResult ParseCampFile(
+        const std::filesystem::path& camp_file,
+        const std::string& camp_data,
+        bool collect_unknown_properties,
+        ParseObserver* observer)
+    {
+      CampFileResult result;
+      ParserMap parsers;
+
+      std::function<Errors(Mechanism&, const YAML::Node&)> ParseMechanismArray =
+          [&](Mechanism& mechanism, const YAML::Node& object)
+      {
+        result.sets_name = true;
+        return ParseMechanism(parsers, mechanism, object);
+      };
+      std::function<Errors(Mechanism&, const YAML::Node&)> ParseFileRelativeTolerance =
+          [&](Mechanism& mechanism, const YAML::Node& object)
+      {
+        result.sets_relative_tolerance = true;
+        return ParseRelativeTolerance(mechanism, object);
+      };
+
+      parsers["CHEM_SPEC"] = [&](Mechanism& mechanism, const YAML::Node& object)
+      { return ParseChemicalSpecies(mechanism, object, collect_unknown_properties); };
+      parsers["RELATIVE_TOLERANCE"] = ParseFileRelativeTolerance;
+      parsers["PHOTOLYSIS"] = PhotolysisParser;
+      parsers["EMISSION"] = EmissionParser;
+      parsers["FIRST_ORDER_LOSS"] = FirstOrderLossParser;
+      parsers["ARRHENIUS"] = ArrheniusParser;
+      parsers["TROE"] = TroeParser;
+      parsers["TERNARY_CHEMICAL_ACTIVATION"] = TernaryChemicalActivationParser;
+      parsers["BRANCHED"] = BranchedParser;
+      parsers["WENNBERG_NO_RO2"] = BranchedParser;
+      parsers["TUNNELING"] = TunnelingParser;
+      parsers["WENNBERG_TUNNELING"] = TunnelingParser;
+      parsers["SURFACE"] = SurfaceParser;
+      parsers["USER_DEFINED"] = UserDefinedParser;
+      parsers["MECHANISM"] = ParseMechanismArray;
+
+      // Parse each file independently so one malformed file does not abort the rest.
+      try
+      {
+        YAML::Node config_subset = LoadFile(camp_file, observer);
+
+        StageTimer timer(observer, ParseStage::Build, camp_file);
+        result.errors = run_parsers(parsers, result.mechanism, config_subset[camp_data]);
+        if (timer)
+        {
+          timer.Stop();
+          timer.nodes = CountNodes(config_subset[camp_data]);
+        }
+        // prepend the file name to the error messages
+        for (auto& error : result.errors)
+        {
+          error.second = camp_file.string() + ":" + error.second;
+        }
+      }
+      catch (const std::exception& e)
+      {
+        result.errors.push_back({ ErrorCode::UnexpectedError, camp_file.string() + ":" + e.what() });
+      }
+      return result;
+    }
+
+    template<typename T>
+    void Append(std::vector<T>& to, std::vector<T>& from)
+    {
+      to.insert(to.end(), std::make_move_iterator(from.begin()), std::make_move_iterator(from.end()));
+    }
+
+    // Adds a file's partial mechanism to `mechanism`, as if the file had been parsed into it.
+    void MergeCampFile(Mechanism& mechanism, CampFileResult& file)
+    {
+      if (file.sets_name)
+        mechanism.name = std::move(file.mechanism.name);
+      if (file.sets_relative_tolerance)
+        mechanism.relative_tolerance = file.mechanism.relative_tolerance;
+      // The file's unknown properties move to the end of the mechanism's, so its ids shift.
+      const types::PropertiesId offset = mechanism.unknown_properties.Append(std::move(file.mechanism.unknown_properties));
+      for (auto& species : file.mechanism.species)
+        if (species.unknown_properties_id != types::NO_PROPERTIES)
+          species.unknown_properties_id += offset;
+      Append(mechanism.species, file.mechanism.species);
+
+      types::Reactions& reactions = mechanism.reactions;
+      types::Reactions& from = file.mechanism.reactions;
+      Append(reactions.arrhenius, from.arrhenius);
+      Append(reactions.branched, from.branched);
+      Append(reactions.emission, from.emission);
+      Append(reactions.first_order_loss, from.first_order_loss);
+      Append(reactions.photolysis, from.photolysis);
+      Append(reactions.surface, from.surface);
+      Append(reactions.taylor_series, from.taylor_series);
+      Append(reactions.troe, from.troe);
+      Append(reactions.ternary_chemical_activation, from.ternary_chemical_activation);
+      Append(reactions.tunneling, from.tunneling);
+      Append(reactions.user_defined, from.user_defined);
+      Append(reactions.lambda_rate_constant, from.lambda_rate_constant);
+    }
+  }  // namespace
+
   Errors Parser::GetCampFiles(const std::filesystem::path& config_path, std::vector<std::filesystem::path>& camp_files)
   {
     Errors errors;
@@ -89,8 +208,19 @@ namespace mechanism_configuration::v0
       config_file = config_path;
     }
 
+    source_files_.assign({ config_file });
+
     // Load the CAMP file list YAML
-    YAML::Node camp_data = YAML::LoadFile(config_file.string());
+    YAML::Node camp_data = LoadFile(config_file, options_.observer);
+    return GetCampFiles(camp_data, config_dir, camp_files);
+  }
+
+  Errors Parser::GetCampFiles(
+      const YAML::Node& camp_data,
+      const std::filesystem::path& config_dir,
+      std::vector<std::filesystem::path>& camp_files)
+  {
+    Errors errors;
     if (!camp_data[CAMP_FILES])
     {
       std::string msg = "Required key not found: " + CAMP_FILES;
@@ -117,71 +247,67 @@ namespace mechanism_configuration::v0
 
   std::expected<Mechanism, Errors> Parser::Parse(const std::filesystem::path& config_path)
   {
-    Errors errors;
-    auto mechanism = Mechanism();
-
     std::vector<std::filesystem::path> camp_files;
     auto file_errors = GetCampFiles(config_path, camp_files);
-    errors.insert(errors.end(), file_errors.begin(), file_errors.end());
-
-    // Only attempt to parse the mechanism if we were able to gather the CAMP files.
-    if (errors.empty())
+    if (!file_errors.empty())
     {
-      ParserMap parsers;
+      return std::unexpected(std::move(file_errors));
+    }
+    source_files_.insert(source_files_.end(), camp_files.begin(), camp_files.end());
+    return ParseCampFiles(camp_files);
+  }
 
-      std::function<Errors(Mechanism&, const YAML::Node&)> ParseMechanismArray =
-          [&](Mechanism& mechanism, const YAML::Node& object) { return ParseMechanism(parsers, mechanism, object); };
+  std::expected<Mechanism, Errors> Parser::Parse(const std::filesystem::path& config_path, const YAML::Node& camp_data)
+  {
+    std::vector<std::filesystem::path> camp_files;
+    auto file_errors = GetCampFiles(camp_data, config_path.parent_path(), camp_files);
+    if (!file_errors.empty())
+    {
+      return std::unexpected(std::move(file_errors));
+    }
+    source_files_.assign({ config_path });
+    source_files_.insert(source_files_.end(), camp_files.begin(), camp_files.end());
+    return ParseCampFiles(camp_files);
+  }
 
-      parsers["CHEM_SPEC"] = ParseChemicalSpecies;
-      parsers["RELATIVE_TOLERANCE"] = ParseRelativeTolerance;
-      parsers["PHOTOLYSIS"] = PhotolysisParser;
-      parsers["EMISSION"] = EmissionParser;
-      parsers["FIRST_ORDER_LOSS"] = FirstOrderLossParser;
-      parsers["ARRHENIUS"] = ArrheniusParser;
-      parsers["TROE"] = TroeParser;
-      parsers["TERNARY_CHEMICAL_ACTIVATION"] = TernaryChemicalActivationParser;
-      parsers["BRANCHED"] = BranchedParser;
-      parsers["WENNBERG_NO_RO2"] = BranchedParser;
-      parsers["TUNNELING"] = TunnelingParser;
-      parsers["WENNBERG_TUNNELING"] = TunnelingParser;
-      parsers["SURFACE"] = SurfaceParser;
-      parsers["USER_DEFINED"] = UserDefinedParser;
-      parsers["MECHANISM"] = ParseMechanismArray;
+  std::expected<Mechanism, Errors> Parser::ParseCampFiles(const std::vector<std::filesystem::path>& camp_files)
+  {
+    Errors errors;
+    auto mechanism = Mechanism();
 
-      for (const auto& camp_file : camp_files)
-      {
-        // Parse each file independently so one malformed file does not abort the rest.
-        try
-        {
-          YAML::Node config_subset = YAML::LoadFile(camp_file.string());
-
-          auto parse_errors = run_parsers(parsers, mechanism, config_subset[CAMP_DATA]);
-          // prepend the file name to the error messages
-          for (auto& error : parse_errors)
-          {
-            error.second = camp_file.string() + ":" + error.second;
-          }
-          errors.insert(errors.end(), parse_errors.begin(), parse_errors.end());
-        }
-        catch (const std::exception& e)
-        {
-          errors.push_back({ ErrorCode::UnexpectedError, camp_file.string() + ":" + e.what() });
-        }
-      }
+    // Each file is parsed into its own partial mechanism, possibly in parallel, and the results
+    // are merged in file order so the mechanism and errors do not depend on how they were parsed.
+    std::vector<CampFileResult> files(camp_files.size());
+    auto parse = [&](std::size_t i)
+    {
+      files[i] = ParseCampFile(camp_files[i], CAMP_DATA, options_.collect_unknown_properties, options_.observer);
+    };
+    if (options_.parallel_file_loading)
+      ParallelFor(camp_files.size(), parse);
+    else
+      for (std::size_t i = 0; i < camp_files.size(); ++i)
+        parse(i);
 
-      // all species in version 0 are in the gas phase
-      types::Phase gas_phase;
-      gas_phase.name = "gas";
-      for (auto& species : mechanism.species)
-      {
-        types::PhaseSpecies phase_species;
-        phase_species.name = species.name;
-        gas_phase.species.push_back(phase_species);
-      }
-      mechanism.phases.push_back(gas_phase);
+    for (auto& file : files)
+    {
+      errors.insert(errors.end(), file.errors.begin(), file.errors.end());
+      MergeCampFile(mechanism, file);
+    }
+    TruncateErrors(errors, options_.validation.ErrorLimit());
 
-      mechanism.version = Version(0, 0, 0);
+    // all species in version 0 are in the gas phase
+    types::Phase gas_phase;
+    gas_phase.name = "gas";
+    for (auto& species : mechanism.species)
+    {
+      types::PhaseSpecies phase_species;
+      phase_species.name = species.name;
+      gas_phase.species.push_back(phase_species);
     }
+    mechanism.phases.push_back(gas_phase);
+
+    mechanism.version = Version(0, 0, 0);
+    AssignIndices(mechanism);
 
     std::expected<Mechanism, Errors> result;
     if (!errors.empty())
@@ -10,15 +10,16 @@
 
 namespace mechanism_configuration::v0
 {
-  Errors ParseChemicalSpecies(Mechanism& mechanism, const YAML::Node& object)
+  Errors ParseChemicalSpecies(Mechanism& mechanism, const YAML::Node& object, bool collect_unknown_properties)
   {
     Errors errors;
-    std::vector<std::string_view> required = { keys::NAME, keys::TYPE };
-    std::vector<std::string_view> optional = {
+    static const std::vector<std::string_view> required = { keys::NAME, keys::TYPE };
+    static const std::vector<std::string_view> optional = {
       keys::TRACER_TYPE, keys::ABS_TOLERANCE, keys::DIFFUSION_COEFF, keys::MOL_WEIGHT
     };
+    static const Schema schema(required, optional);
 
-    auto validate = CheckSchema(object, required, optional);
+    auto validate = schema.Check(object);
     errors.insert(errors.end(), validate.begin(), validate.end());
     if (validate.empty())
     {
@@ -36,7 +37,8 @@ namespace mechanism_configuration::v0
         species.tracer_type = object[keys::TRACER_TYPE].as<std::string>();
 
       // Load remaining keys as unknown properties
-      for (auto it = object.begin(); it != object.end(); ++it)
+      std::vector<types::UnknownProperty> unknown_properties;
+      for (auto it = object.begin(); collect_unknown_properties && it != object.end(); ++it)
       {
         auto key = it->first.as<std::string>();
         auto value = it->second;
@@ -45,9 +47,10 @@ namespace mechanism_configuration::v0
             std::find(optional.begin(), optional.end(), key) == optional.end())
         {
           std::string stringValue = value.as<std::string>();
-          species.unknown_properties[key] = stringValue;
+          unknown_properties.push_back({ std::move(key), std::move(stringValue) });
         }
       }
+      species.unknown_properties_id = mechanism.unknown_properties.Add(std::move(unknown_properties));
       mechanism.species.push_back(species);
     }
 
@@ -57,9 +60,9 @@ namespace mechanism_configuration::v0
   Errors ParseRelativeTolerance(Mechanism& mechanism, const YAML::Node& object)
   {
     Errors errors;
-    std::vector<std::string_view> required = { keys::VALUE, keys::TYPE };
+    static const Schema schema({ keys::VALUE, keys::TYPE }, {});
 
-    auto validate = CheckSchema(object, required, {});
+    auto validate = schema.Check(object);
     errors.insert(errors.end(), validate.begin(), validate.end());
     if (validate.empty())
     {
@@ -71,13 +74,14 @@ namespace mechanism_configuration::v0
 
   Errors ParseReactants(const YAML::Node& object, std::vector<types::ReactionComponent>& reactants)
   {
+    static const Schema schema({}, { keys::QTY });
     Errors errors;
     for (auto it = object.begin(); it != object.end(); ++it)
     {
       auto key = it->first.as<std::string>();
       auto value = it->second;
 
-      auto validate = CheckSchema(value, {}, { keys::QTY });
+      auto validate = schema.Check(value);
       errors.insert(errors.end(), validate.begin(), validate.end());
       if (validate.empty())
       {
@@ -94,13 +98,14 @@ namespace mechanism_configuration::v0
 
   Errors ParseProducts(const YAML::Node& object, std::vector<types::ReactionComponent>& products)
   {
+    static const Schema schema({}, { keys::YIELD });
     Errors errors;
     for (auto it = object.begin(); it != object.end(); ++it)
     {
       auto key = it->first.as<std::string>();
       auto value = it->second;
 
-      auto validate = CheckSchema(value, {}, { keys::YIELD });
+      auto validate = schema.Check(value);
       errors.insert(errors.end(), validate.begin(), validate.end());
       if (validate.empty())
       {
@@ -13,12 +13,10 @@ namespace mechanism_configuration::v0
   Errors SurfaceParser(Mechanism& mechanism, const YAML::Node& object)
   {
     Errors errors;
-    std::vector<std::string_view> required = {
-      keys::TYPE, keys::GAS_PHASE_PRODUCTS, keys::GAS_PHASE_REACTANT, keys::MUSICA_NAME
-    };
-    std::vector<std::string_view> optional = { keys::PROBABILITY };
+    static const Schema schema(
+        { keys::TYPE, keys::GAS_PHASE_PRODUCTS, keys::GAS_PHASE_REACTANT, keys::MUSICA_NAME }, { keys::PROBABILITY });
 
-    auto validate = CheckSchema(object, required, optional);
+    auto validate = schema.Check(object);
     errors.insert(errors.end(), validate.begin(), validate.end());
     if (validate.empty())
     {
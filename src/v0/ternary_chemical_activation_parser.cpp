@@ -15,11 +15,11 @@ namespace mechanism_configuration::v0
   {
     Errors errors;
 
-    std::vector<std::string_view> required = { keys::TYPE, keys::REACTANTS, keys::PRODUCTS };
-    std::vector<std::string_view> optional = { keys::K0_A,   keys::K0_B,   keys::K0_C, keys::KINF_A,
-                                               keys::KINF_B, keys::KINF_C, keys::FC,   keys::N };
+    static const Schema schema(
+        { keys::TYPE, keys::REACTANTS, keys::PRODUCTS },
+        { keys::K0_A, keys::K0_B, keys::K0_C, keys::KINF_A, keys::KINF_B, keys::KINF_C, keys::FC, keys::N });
 
-    auto validate = CheckSchema(object, required, optional);
+    auto validate = schema.Check(object);
     errors.insert(errors.end(), validate.begin(), validate.end());
     if (validate.empty())
     {
@@ -14,10 +14,9 @@ namespace mechanism_configuration::v0
   {
     Errors errors;
 
-    std::vector<std::string_view> required = { keys::TYPE, keys::REACTANTS, keys::PRODUCTS };
-    std::vector<std::string_view> optional = { keys::A, keys::B, keys::C };
+    static const Schema schema({ keys::TYPE, keys::REACTANTS, keys::PRODUCTS }, { keys::A, keys::B, keys::C });
 
-    auto validate = CheckSchema(object, required, optional);
+    auto validate = schema.Check(object);
     errors.insert(errors.end(), validate.begin(), validate.end());
     if (validate.empty())
     {
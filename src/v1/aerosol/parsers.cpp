@@ -15,7 +15,7 @@ namespace mechanism_configuration::v1
   // Rate constants parser
   // ----------------------------------------
 
-  types::Equilibrium ParseEquilibrium(const YAML::Node& object)
+  types::Equilibrium ParseEquilibrium(const MapView& object)
   {
     types::Equilibrium rate_constant;
 
@@ -28,7 +28,7 @@ namespace mechanism_configuration::v1
     return rate_constant;
   }
 
-  types::Arrhenius ParseArrhenius(const YAML::Node& object)
+  types::Arrhenius ParseArrhenius(const MapView& object)
   {
     types::Arrhenius rate_constant;
 
@@ -45,16 +45,18 @@ namespace mechanism_configuration::v1
     return rate_constant;
   }
 
-  types::RateConstant ParseRateConstant(const YAML::Node& object)
+  types::RateConstant ParseRateConstant(const MapView& object)
   {
     if (object[keys::type] && object[keys::type].as<std::string>() == keys::Equilibrium_key)
       return ParseEquilibrium(object);
+    if (object[keys::type] && object[keys::type].as<std::string>() == keys::Expression_key)
+      return types::RateExpression{ object[keys::expression].as<std::string>() };
 
     // ARRHENIUS is the default when no (recognized) type is given.
     return ParseArrhenius(object);
   }
 
-  types::HenrysLawConstant ParseHenrysLawConstant(const YAML::Node& object)
+  types::HenrysLawConstant ParseHenrysLawConstant(const MapView& object)
   {
     types::HenrysLawConstant henrys_law_constant;
 
@@ -73,7 +75,7 @@ namespace mechanism_configuration::v1
 
   namespace
   {
-    std::vector<std::string> ParsePhaseNames(const YAML::Node& object)
+    std::vector<std::string> ParsePhaseNames(const MapView& object)
     {
       std::vector<std::string> phases;
       for (const auto& phase : object[keys::phases])
@@ -82,7 +84,7 @@ namespace mechanism_configuration::v1
     }
   }  // namespace
 
-  types::UniformSection ParseUniformSection(const YAML::Node& object)
+  types::UniformSection ParseUniformSection(const MapView& object)
   {
     types::UniformSection uniform_section;
 
@@ -94,7 +96,7 @@ namespace mechanism_configuration::v1
     return uniform_section;
   }
 
-  types::SingleMomentMode ParseSingleMomentMode(const YAML::Node& object)
+  types::SingleMomentMode ParseSingleMomentMode(const MapView& object)
   {
     types::SingleMomentMode single_moment_mode;
 
@@ -106,7 +108,7 @@ namespace mechanism_configuration::v1
     return single_moment_mode;
   }
 
-  types::TwoMomentMode ParseTwoMomentMode(const YAML::Node& object)
+  types::TwoMomentMode ParseTwoMomentMode(const MapView& object)
   {
     types::TwoMomentMode two_moment_mode;
 
@@ -122,7 +124,7 @@ namespace mechanism_configuration::v1
   // ----------------------------------------
 
   types::HenrysLawPhaseTransfer ParseHenrysLawPhaseTransfer(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Phase>& phases)
   {
     types::HenrysLawPhaseTransfer transfer;
@@ -143,27 +145,29 @@ namespace mechanism_configuration::v1
     return transfer;
   }
 
-  types::DissolvedReaction ParseDissolvedReaction(const YAML::Node& object)
+  types::DissolvedReaction ParseDissolvedReaction(const MapView& object, types::UnknownProperties* unknown_properties)
   {
     types::DissolvedReaction reaction;
 
     reaction.phase = object[keys::condensed_phase].as<std::string>();
     reaction.solvent = object[keys::solvent].as<std::string>();
-    reaction.reactants = ParseReactionComponents(object, keys::reactants);
-    reaction.products = ParseReactionComponents(object, keys::products);
+    reaction.reactants = ParseReactionComponents(object, keys::reactants, unknown_properties);
+    reaction.products = ParseReactionComponents(object, keys::products, unknown_properties);
     reaction.rate_constant = ParseRateConstant(object[keys::rate_constant]);
 
     return reaction;
   }
 
-  types::DissolvedReversibleReaction ParseDissolvedReversibleReaction(const YAML::Node& object)
+  types::DissolvedReversibleReaction ParseDissolvedReversibleReaction(
+      const MapView& object,
+      types::UnknownProperties* unknown_properties)
   {
     types::DissolvedReversibleReaction reaction;
 
     reaction.phase = object[keys::condensed_phase].as<std::string>();
     reaction.solvent = object[keys::solvent].as<std::string>();
-    reaction.reactants = ParseReactionComponents(object, keys::reactants);
-    reaction.products = ParseReactionComponents(object, keys::products);
+    reaction.reactants = ParseReactionComponents(object, keys::reactants, unknown_properties);
+    reaction.products = ParseReactionComponents(object, keys::products, unknown_properties);
 
     // Any two of {forward, reverse, equilibrium} may be supplied; the third is derived
     // downstream, so each is parsed only when present.
@@ -182,7 +186,7 @@ namespace mechanism_configuration::v1
   // ----------------------------------------
 
   types::HenrysLawEquilibrium ParseHenrysLawEquilibrium(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& species,
       const std::vector<types::Phase>& phases)
   {
@@ -206,28 +210,30 @@ namespace mechanism_configuration::v1
     return equilibrium;
   }
 
-  types::DissolvedEquilibrium ParseDissolvedEquilibrium(const YAML::Node& object)
+  types::DissolvedEquilibrium ParseDissolvedEquilibrium(
+      const MapView& object,
+      types::UnknownProperties* unknown_properties)
   {
     types::DissolvedEquilibrium equilibrium;
 
     equilibrium.phase = object[keys::condensed_phase].as<std::string>();
     equilibrium.algebraic_species = object[keys::algebraic_species].as<std::string>();
     equilibrium.solvent = object[keys::solvent].as<std::string>();
-    equilibrium.reactants = ParseReactionComponents(object, keys::reactants);
-    equilibrium.products = ParseReactionComponents(object, keys::products);
+    equilibrium.reactants = ParseReactionComponents(object, keys::reactants, unknown_properties);
+    equilibrium.products = ParseReactionComponents(object, keys::products, unknown_properties);
     equilibrium.equilibrium_constant = ParseEquilibrium(object[keys::equilibrium_constant]);
 
     return equilibrium;
   }
 
-  types::LinearConstraint ParseLinearConstraint(const YAML::Node& object)
+  types::LinearConstraint ParseLinearConstraint(const MapView& object)
   {
     types::LinearConstraint constraint;
 
     constraint.algebraic_phase = object[keys::algebraic_phase].as<std::string>();
     constraint.algebraic_species = object[keys::algebraic_species].as<std::string>();
 
-    for (const auto& term_node : object[keys::terms])
+    for (const MapView term_node : object[keys::terms])
     {
       types::LinearConstraintTerm term;
       term.phase = term_node[keys::phase].as<std::string>();
@@ -253,7 +259,7 @@ namespace mechanism_configuration::v1
   {
     std::vector<types::Representation> representations;
 
-    for (const auto& object : objects)
+    for (const MapView object : objects)
     {
       const auto type = object[keys::type].as<std::string>();
 
@@ -268,8 +274,11 @@ namespace mechanism_configuration::v1
     return representations;
   }
 
-  types::Aerosol
-  ParseAerosol(const YAML::Node& object, const std::vector<types::Species>& species, const std::vector<types::Phase>& phases)
+  types::Aerosol ParseAerosol(
+      const MapView& object,
+      const std::vector<types::Species>& species,
+      const std::vector<types::Phase>& phases,
+      types::UnknownProperties* unknown_properties)
   {
     types::Aerosol aerosol;
 
@@ -279,7 +288,7 @@ namespace mechanism_configuration::v1
     if (object[keys::aerosol_processes])
     {
       // Aerosol processes section mixes process and constraint entries.
-      for (const auto& entry : object[keys::aerosol_processes])
+      for (const MapView entry : object[keys::aerosol_processes])
       {
         const auto type = entry[keys::type].as<std::string>();
 
@@ -287,14 +296,14 @@ namespace mechanism_configuration::v1
         if (type == keys::HenrysLawPhaseTransfer_key)
           aerosol.processes.emplace_back(ParseHenrysLawPhaseTransfer(entry, phases));
         else if (type == keys::DissolvedReaction_key)
-          aerosol.processes.emplace_back(ParseDissolvedReaction(entry));
+          aerosol.processes.emplace_back(ParseDissolvedReaction(entry, unknown_properties));
         else if (type == keys::DissolvedReversibleReaction_key)
-          aerosol.processes.emplace_back(ParseDissolvedReversibleReaction(entry));
+          aerosol.processes.emplace_back(ParseDissolvedReversibleReaction(entry, unknown_properties));
         // Constraints
         else if (type == keys::HenrysLawEquilibrium_key)
           aerosol.constraints.emplace_back(ParseHenrysLawEquilibrium(entry, species, phases));
         else if (type == keys::DissolvedEquilibrium_key)
-          aerosol.constraints.emplace_back(ParseDissolvedEquilibrium(entry));
+          aerosol.constraints.emplace_back(ParseDissolvedEquilibrium(entry, unknown_properties));
         else if (type == keys::LinearConstraint_key)
           aerosol.constraints.emplace_back(ParseLinearConstraint(entry));
       }
@@ -5,6 +5,7 @@
 #include "detail/v1/aerosol/schema.hpp"
 
 #include "detail/error_format.hpp"
+#include "detail/map_view.hpp"
 #include "detail/schema.hpp"
 #include "detail/v1/aerosol/keys.hpp"
 #include "detail/v1/keys.hpp"
@@ -23,41 +24,49 @@ namespace mechanism_configuration::v1
   {
     Errors CheckEquilibriumSchema(const YAML::Node& object)
     {
-      const std::vector<std::string_view> required_keys = { keys::A, keys::henrys_law_C };
-      const std::vector<std::string_view> optional_keys = { keys::type, keys::reference_temperature };
-      return CheckSchema(object, required_keys, optional_keys);
+      static const Schema schema({ keys::A, keys::henrys_law_C }, { keys::type, keys::reference_temperature });
+      return schema.Check(object);
     }
 
     Errors CheckArrheniusSchema(const YAML::Node& object)
     {
-      const std::vector<std::string_view> required_keys = { keys::A, keys::C };
-      const std::vector<std::string_view> optional_keys = { keys::type };
-      return CheckSchema(object, required_keys, optional_keys);
+      static const Schema schema({ keys::A, keys::C }, { keys::type });
+      return schema.Check(object);
     }
 
-    Errors CheckRateConstantSchema(const YAML::Node& object)
+    // The expression must compile and depend on the temperature alone.
+    Errors CheckRateExpressionSchema(const MapView& object)
+    {
+      static const Schema schema({ keys::type, keys::expression }, {});
+      Errors errors = schema.Check(object);
+      if (errors.empty())
+        errors = CheckExpression(object[keys::expression], "rate constant expression", false);
+      return errors;
+    }
+
+    Errors CheckRateConstantSchema(const MapView& object)
     {
       if (object[keys::type] && object[keys::type].as<std::string>() == keys::Equilibrium_key)
         return CheckEquilibriumSchema(object);
+      if (object[keys::type] && object[keys::type].as<std::string>() == keys::Expression_key)
+        return CheckRateExpressionSchema(object);
       return CheckArrheniusSchema(object);
     }
 
     Errors CheckHenrysLawConstantSchema(const YAML::Node& object)
     {
-      const std::vector<std::string_view> required_keys = { keys::HLC_ref, keys::henrys_law_C };
-      const std::vector<std::string_view> optional_keys = { keys::reference_temperature };
-      return CheckSchema(object, required_keys, optional_keys);
+      static const Schema schema({ keys::HLC_ref, keys::henrys_law_C }, { keys::reference_temperature });
+      return schema.Check(object);
     }
 
     // Each linear-constraint term references a species in a phase with a coefficient.
     Errors CheckLinearConstraintTermsSchema(const YAML::Node& object)
     {
       Errors errors;
-      const std::vector<std::string_view> required_keys = { keys::phase, keys::name, keys::coefficient };
-      const std::vector<std::string_view> optional_keys = {};
+      static const Schema schema({ keys::phase, keys::name, keys::coefficient }, {});
       for (const auto& term : object)
       {
-        auto term_errors = CheckSchema(term, required_keys, optional_keys);
+        auto term_errors = schema.Check(term);
         errors.insert(errors.end(), term_errors.begin(), term_errors.end());
       }
       return errors;
@@ -68,47 +77,49 @@ namespace mechanism_configuration::v1
   {
     Errors errors;
 
-    for (const auto& object : AsSequence(representations_list))
+    for (const MapView object : AsSequence(representations_list))
     {
       // Every representation needs a type to dispatch the remaining required keys on.
       if (!object[keys::type])
       {
-        ErrorLocation error_location{ object.Mark().line, object.Mark().column };
+        ErrorLocation error_location = LocationOf(object);
         errors.push_back({ ErrorCode::RequiredKeyNotFound,
                            mc_fmt::format("{} error: Missing 'type' object in aerosol representation.", error_location) });
         continue;
       }
 
-      // Keys shared by every representation type.
-      std::vector<std::string_view> required_keys = { keys::type, keys::name, keys::phases };
-      std::vector<std::string_view> optional_keys = {};
-
+      // Each type has the keys shared by every representation (type, name, phases) and its own.
+      const Schema* schema = nullptr;
       const std::string type = object[keys::type].as<std::string>();
       if (type == keys::UniformSection_key)
       {
-        required_keys.push_back(keys::minimum_radius);
-        required_keys.push_back(keys::maximum_radius);
+        static const Schema uniform_section(
+            { keys::type, keys::name, keys::phases, keys::minimum_radius, keys::maximum_radius }, {});
+        schema = &uniform_section;
       }
       else if (type == keys::SingleMomentMode_key)
       {
-        required_keys.push_back(keys::geometric_mean_radius);
-        required_keys.push_back(keys::geometric_standard_deviation);
+        static const Schema single_moment_mode(
+            { keys::type, keys::name, keys::phases, keys::geometric_mean_radius, keys::geometric_standard_deviation }, {});
+        schema = &single_moment_mode;
       }
       else if (type == keys::TwoMomentMode_key)
       {
-        required_keys.push_back(keys::geometric_standard_deviation);
+        static const Schema two_moment_mode(
+            { keys::type, keys::name, keys::phases, keys::geometric_standard_deviation }, {});
+        schema = &two_moment_mode;
       }
       else
       {
         const auto& node = object[keys::type];
-        ErrorLocation error_location{ node.Mark().line, node.Mark().column };
+        ErrorLocation error_location = LocationOf(node);
         errors.push_back(
             { ErrorCode::UnknownType,
               mc_fmt::format("{} error: Unknown aerosol representation type '{}' found.", error_location, type) });
         continue;
       }
 
-      auto schema_errors = CheckSchema(object, required_keys, optional_keys);
+      auto schema_errors = schema->Check(object);
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
     }
 
@@ -119,19 +130,18 @@ namespace mechanism_configuration::v1
   {
     Errors errors;
 
-    for (const auto& object : AsSequence(processes_list))
+    for (const MapView object : AsSequence(processes_list))
     {
       // Every entry needs a type to dispatch the remaining required keys on.
       if (!object[keys::type])
       {
-        ErrorLocation error_location{ object.Mark().line, object.Mark().column };
+        ErrorLocation error_location = LocationOf(object);
         errors.push_back({ ErrorCode::RequiredKeyNotFound,
                            mc_fmt::format("{} error: Missing 'type' object in aerosol process.", error_location) });
         continue;
       }
 
-      std::vector<std::string_view> required_keys;
-      std::vector<std::string_view> optional_keys;
+      const Schema* schema = nullptr;
       Errors nested_errors;
 
       const std::string type = object[keys::type].as<std::string>();
@@ -139,21 +149,26 @@ namespace mechanism_configuration::v1
       {
         // The diffusion coefficient is not given here. It is sourced from the gas-phase
         // species' definition in the phases section (see ValidateAerosolSemantics).
-        required_keys = { keys::type,
-                          keys::gas_phase,
-                          keys::gas_phase_species,
-                          keys::condensed_phase,
-                          keys::condensed_phase_species,
-                          keys::solvent,
-                          keys::henrys_law_constant,
-                          keys::accommodation_coefficient };
+        static const Schema henrys_law_phase_transfer(
+            { keys::type,
+              keys::gas_phase,
+              keys::gas_phase_species,
+              keys::condensed_phase,
+              keys::condensed_phase_species,
+              keys::solvent,
+              keys::henrys_law_constant,
+              keys::accommodation_coefficient },
+            {});
+        schema = &henrys_law_phase_transfer;
         if (object[keys::henrys_law_constant])
           nested_errors = CheckHenrysLawConstantSchema(object[keys::henrys_law_constant]);
       }
       else if (type == keys::DissolvedReaction_key)
       {
-        required_keys = { keys::type,      keys::condensed_phase, keys::solvent,
-                          keys::reactants, keys::products,        keys::rate_constant };
+        static const Schema dissolved_reaction(
+            { keys::type, keys::condensed_phase, keys::solvent, keys::reactants, keys::products, keys::rate_constant },
+            {});
+        schema = &dissolved_reaction;
         if (object[keys::reactants])
         {
           auto e = CheckReactantsOrProductsSchema(object[keys::reactants]);
@@ -172,8 +187,10 @@ namespace mechanism_configuration::v1
       }
       else if (type == keys::DissolvedReversibleReaction_key)
       {
-        required_keys = { keys::type, keys::condensed_phase, keys::solvent, keys::reactants, keys::products };
-        optional_keys = { keys::forward_rate_constant, keys::reverse_rate_constant, keys::equilibrium_constant };
+        static const Schema dissolved_reversible_reaction(
+            { keys::type, keys::condensed_phase, keys::solvent, keys::reactants, keys::products },
+            { keys::forward_rate_constant, keys::reverse_rate_constant, keys::equilibrium_constant });
+        schema = &dissolved_reversible_reaction;
         if (object[keys::reactants])
         {
           auto e = CheckReactantsOrProductsSchema(object[keys::reactants]);
@@ -204,25 +221,31 @@ namespace mechanism_configuration::v1
       {
         // The solvent's molecular weight and density are not given here; they are sourced from
         // the solvent species' definition (see ValidateAerosolSemantics).
-        required_keys = { keys::type,
-                          keys::gas_phase,
-                          keys::gas_phase_species,
-                          keys::condensed_phase,
-                          keys::condensed_phase_species,
-                          keys::solvent,
-                          keys::henrys_law_constant };
+        static const Schema henrys_law_equilibrium(
+            { keys::type,
+              keys::gas_phase,
+              keys::gas_phase_species,
+              keys::condensed_phase,
+              keys::condensed_phase_species,
+              keys::solvent,
+              keys::henrys_law_constant },
+            {});
+        schema = &henrys_law_equilibrium;
         if (object[keys::henrys_law_constant])
           nested_errors = CheckHenrysLawConstantSchema(object[keys::henrys_law_constant]);
       }
       else if (type == keys::DissolvedEquilibrium_key)
       {
-        required_keys = { keys::type,
-                          keys::condensed_phase,
-                          keys::solvent,
-                          keys::reactants,
-                          keys::products,
-                          keys::algebraic_species,
-                          keys::equilibrium_constant };
+        static const Schema dissolved_equilibrium(
+            { keys::type,
+              keys::condensed_phase,
+              keys::solvent,
+              keys::reactants,
+              keys::products,
+              keys::algebraic_species,
+              keys::equilibrium_constant },
+            {});
+        schema = &dissolved_equilibrium;
         if (object[keys::reactants])
         {
           auto e = CheckReactantsOrProductsSchema(object[keys::reactants]);
@@ -241,8 +264,10 @@ namespace mechanism_configuration::v1
       }
       else if (type == keys::LinearConstraint_key)
       {
-        required_keys = { keys::type, keys::algebraic_phase, keys::algebraic_species, keys::terms };
-        optional_keys = { keys::constant, keys::diagnose_from_state };
+        static const Schema linear_constraint(
+            { keys::type, keys::algebraic_phase, keys::algebraic_species, keys::terms },
+            { keys::constant, keys::diagnose_from_state });
+        schema = &linear_constraint;
         if (object[keys::terms])
         {
           auto e = CheckLinearConstraintTermsSchema(object[keys::terms]);
@@ -252,7 +277,7 @@ namespace mechanism_configuration::v1
         if (object[keys::constant] && object[keys::diagnose_from_state])
         {
           const auto& node = object[keys::diagnose_from_state];
-          ErrorLocation error_location{ node.Mark().line, node.Mark().column };
+          ErrorLocation error_location = LocationOf(node);
           nested_errors.push_back({ ErrorCode::MutuallyExclusiveOption,
                                     mc_fmt::format(
                                         "{} error: Mutually exclusive option of '{}' and '{}' found in '{}'.",
@@ -265,13 +290,13 @@ namespace mechanism_configuration::v1
       else
       {
         const auto& node = object[keys::type];
-        ErrorLocation error_location{ node.Mark().line, node.Mark().column };
+        ErrorLocation error_location = LocationOf(node);
         errors.push_back({ ErrorCode::UnknownType,
                            mc_fmt::format("{} error: Unknown aerosol process type '{}' found.", error_location, type) });
         continue;
       }
 
-      auto schema_errors = CheckSchema(object, required_keys, optional_keys);
+      auto schema_errors = schema->Check(object);
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
       errors.insert(errors.end(), nested_errors.begin(), nested_errors.end());
     }
@@ -30,13 +30,10 @@ namespace mechanism_configuration::v1
         return errors;
       }
 
-      const std::vector<std::string_view> required_keys = {
-        keys::name, keys::directory, keys::file_pattern, keys::convention
-      };
-      const std::vector<std::string_view> optional_keys = {};
+      static const Schema schema({ keys::name, keys::directory, keys::file_pattern, keys::convention }, {});
       for (const auto& item : inventories_node)
       {
-        auto schema_errors = CheckSchema(item, required_keys, optional_keys);
+        auto schema_errors = schema.Check(item);
         errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
       }
       return errors;
@@ -51,11 +48,10 @@ namespace mechanism_configuration::v1
         return errors;
       }
 
-      const std::vector<std::string_view> required_keys = { keys::inventory_species, keys::mechanism_species };
-      const std::vector<std::string_view> optional_keys = { keys::scaling_factor };
+      static const Schema schema({ keys::inventory_species, keys::mechanism_species }, { keys::scaling_factor });
       for (const auto& item : mappings_node)
       {
-        auto schema_errors = CheckSchema(item, required_keys, optional_keys);
+        auto schema_errors = schema.Check(item);
         errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
       }
       return errors;
@@ -70,16 +66,15 @@ namespace mechanism_configuration::v1
         return errors;
       }
 
-      const std::vector<std::string_view> required_keys = { keys::name, keys::mappings };
-      const std::vector<std::string_view> optional_keys = {};
-      for (const auto& item : species_maps_node)
+      static const Schema schema({ keys::name, keys::mappings }, {});
+      for (const MapView item : species_maps_node)
       {
-        auto schema_errors = CheckSchema(item, required_keys, optional_keys);
+        auto schema_errors = schema.Check(item);
         errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
 
-        if (item[std::string(keys::mappings)])
+        if (item[keys::mappings])
         {
-          auto mapping_errors = CheckMappingsSchema(item[std::string(keys::mappings)]);
+          auto mapping_errors = CheckMappingsSchema(item[keys::mappings]);
           errors.insert(errors.end(), mapping_errors.begin(), mapping_errors.end());
         }
       }
@@ -95,41 +90,40 @@ namespace mechanism_configuration::v1
         return errors;
       }
 
-      const std::vector<std::string_view> required_keys = {
-        keys::name, keys::mode, keys::type, keys::inventory, keys::species_map
-      };
-      const std::vector<std::string_view> optional_keys = { keys::temporal_interpolation,
-                                                            keys::vertical_injection,
-                                                            keys::category,
-                                                            keys::hierarchy,
-                                                            keys::scaling_factor,
-                                                            keys::sector };
-
-      for (const auto& item : sources_node)
+      static const Schema schema(
+          { keys::name, keys::mode, keys::type, keys::inventory, keys::species_map },
+          { keys::temporal_interpolation,
+            keys::vertical_injection,
+            keys::category,
+            keys::hierarchy,
+            keys::scaling_factor,
+            keys::sector });
+
+      for (const MapView item : sources_node)
       {
-        auto schema_errors = CheckSchema(item, required_keys, optional_keys);
+        auto schema_errors = schema.Check(item);
         errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
 
         // Fixed-enum-membership checks: the value is validated against a compile-time fixed
         // set, not a cross-reference to another user-supplied name, so this stays structural.
-        if (item[std::string(keys::mode)])
+        if (item[keys::mode])
         {
-          const std::string mode_val = item[std::string(keys::mode)].as<std::string>();
-          if (mode_val == std::string(keys::mode_online))
+          const std::string mode_val = item[keys::mode].as<std::string>();
+          if (mode_val == keys::mode_online)
           {
-            const ErrorLocation loc = LocationOf(item[std::string(keys::mode)]);
+            const ErrorLocation loc = LocationOf(item[keys::mode]);
             errors.push_back({ ErrorCode::OnlineSourcesNotSupported,
                                mc_fmt::format("{} error: 'mode: online' is not supported in v1", loc) });
           }
-          else if (mode_val != std::string(keys::mode_offline))
+          else if (mode_val != keys::mode_offline)
           {
             errors.push_back({ ErrorCode::UnknownType, mc_fmt::format("Unknown mode '{}'; expected 'offline'", mode_val) });
           }
         }
 
-        if (item[std::string(keys::type)])
+        if (item[keys::type])
         {
-          const std::string type_val = item[std::string(keys::type)].as<std::string>();
+          const std::string type_val = item[keys::type].as<std::string>();
           static const std::vector<std::string_view> valid_types = { keys::type_anthropogenic, keys::type_fire,
                                                                      keys::type_biogenic,      keys::type_dust,
                                                                      keys::type_sea_salt,      keys::type_lightning };
@@ -141,16 +135,16 @@ namespace mechanism_configuration::v1
             errors.push_back({ ErrorCode::UnknownType, mc_fmt::format("Unknown source type '{}'", type_val) });
         }
 
-        if (item[std::string(keys::vertical_injection)])
+        if (item[keys::vertical_injection])
         {
-          const std::string vi_val = item[std::string(keys::vertical_injection)].as<std::string>();
-          if (vi_val == std::string(keys::inject_plume))
+          const std::string vi_val = item[keys::vertical_injection].as<std::string>();
+          if (vi_val == keys::inject_plume)
           {
-            const ErrorLocation loc = LocationOf(item[std::string(keys::vertical_injection)]);
+            const ErrorLocation loc = LocationOf(item[keys::vertical_injection]);
             errors.push_back({ ErrorCode::UnsupportedVerticalInjection,
                                mc_fmt::format("{} error: 'vertical injection: plume' is not supported in v1", loc) });
           }
-          else if (vi_val != std::string(keys::inject_surface))
+          else if (vi_val != keys::inject_surface)
           {
             errors.push_back(
                 { ErrorCode::UnknownType, mc_fmt::format("Unknown vertical injection '{}'; expected 'surface'", vi_val) });
@@ -161,31 +155,31 @@ namespace mechanism_configuration::v1
     }
   }  // namespace
 
-  Errors CheckEmissionsSchema(const YAML::Node& emissions_node)
+  Errors CheckEmissionsSchema(const MapView& emissions_node)
   {
     Errors errors;
 
-    if (emissions_node[std::string(keys::inventories)])
+    if (emissions_node[keys::inventories])
     {
-      auto e = CheckInventoriesSchema(emissions_node[std::string(keys::inventories)]);
+      auto e = CheckInventoriesSchema(emissions_node[keys::inventories]);
       errors.insert(errors.end(), e.begin(), e.end());
     }
 
-    if (emissions_node[std::string(keys::species_maps)])
+    if (emissions_node[keys::species_maps])
     {
-      auto e = CheckSpeciesMapsSchema(emissions_node[std::string(keys::species_maps)]);
+      auto e = CheckSpeciesMapsSchema(emissions_node[keys::species_maps]);
       errors.insert(errors.end(), e.begin(), e.end());
     }
 
-    if (emissions_node[std::string(keys::regridding)])
+    if (emissions_node[keys::regridding])
     {
-      const YAML::Node& rg_node = emissions_node[std::string(keys::regridding)];
-      if (rg_node[std::string(keys::type)])
+      const YAML::Node& rg_node = emissions_node[keys::regridding];
+      if (rg_node[keys::type])
       {
-        const std::string rg_type = rg_node[std::string(keys::type)].as<std::string>();
-        if (rg_type != std::string(keys::regridding_none))
+        const std::string rg_type = rg_node[keys::type].as<std::string>();
+        if (rg_type != keys::regridding_none)
         {
-          const ErrorLocation loc = LocationOf(rg_node[std::string(keys::type)]);
+          const ErrorLocation loc = LocationOf(rg_node[keys::type]);
           errors.push_back(
               { ErrorCode::UnsupportedRegriddingType,
                 mc_fmt::format(
@@ -194,9 +188,9 @@ namespace mechanism_configuration::v1
       }
     }
 
-    if (emissions_node[std::string(keys::sources)])
+    if (emissions_node[keys::sources])
     {
-      auto e = CheckSourcesSchema(emissions_node[std::string(keys::sources)]);
+      auto e = CheckSourcesSchema(emissions_node[keys::sources]);
       errors.insert(errors.end(), e.begin(), e.end());
     }
 
@@ -5,7 +5,12 @@
 #include "detail/v1/parser.hpp"
 
 #include "detail/error_format.hpp"
+#include "detail/error_limit.hpp"
+#include "detail/location.hpp"
+#include "detail/parallel.hpp"
+#include "detail/parse_stats.hpp"
 #include "detail/schema.hpp"
+#include "detail/stream.hpp"
 #include "detail/v1/aerosol/keys.hpp"
 #include "detail/v1/aerosol/parsers.hpp"
 #include "detail/v1/aerosol/schema.hpp"
@@ -27,7 +32,13 @@
 #include <yaml-cpp/yaml.h>
 
 #include <filesystem>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace mechanism_configuration::v1
 {
@@ -51,83 +62,193 @@ namespace mechanism_configuration::v1
     }
 
     // Appends each component under `key` (reactant- or product-like) as a located reference.
-    void CollectComponents(const YAML::Node& reaction, std::string_view key, std::vector<semantics::NamedRef>& out)
+    void CollectComponents(const MapView& reaction, std::string_view key, std::vector<semantics::NamedRef>& out)
     {
-      const std::string k(key);
-      if (!reaction[k])
+      if (!reaction[key])
         return;
-      for (const auto& item : AsSequence(reaction[k]))
+      for (const auto& item : AsSequence(reaction[key]))
         out.push_back({ GetComponentName(item), LocationOf(item) });
     }
+
+    // Whether the reactions visited so far have found `visited.max_errors` type errors. Schema
+    // errors alone never stop the visit: a later type error would replace them all (see
+    // VisitedSchemaErrors), so the types of the remaining reactions must still be checked.
+    bool VisitLimitReached(const VisitedReactions& visited)
+    {
+      return ErrorLimitReached(visited.type_errors, visited.max_errors);
+    }
+
+    // Checks, references and builds one reaction in a single visit. Work whose result can no
+    // longer be used is skipped: any type error suppresses the per-type checks, and any schema
+    // error the references and the build. Comments are stored in `unknown_properties` (skipped
+    // when it is null). Once the error limit is reached only the type is checked, and once the
+    // type errors reach it nothing is done.
+    void VisitReaction(const MapView& object, VisitedReactions& visited, types::UnknownProperties* unknown_properties)
+    {
+      if (visited.type_failure || VisitLimitReached(visited))
+        return;
+
+      const IReactionParser* parser = nullptr;
+      try
+      {
+        parser = FindReactionParser(object, visited.type_errors);
+      }
+      catch (const std::exception& e)
+      {
+        visited.type_failure = ExceptionMessage(e);
+        return;
+      }
+      if (parser == nullptr || !visited.type_errors.empty() || visited.schema_failure ||
+          ErrorLimitReached(visited.schema_errors, visited.max_errors))
+        return;
+
+      Errors schema_errors;
+      try
+      {
+        schema_errors = parser->CheckSchema(object, {}, {});
+      }
+      catch (const std::exception& e)
+      {
+        visited.schema_failure = ExceptionMessage(e);
+        return;
+      }
+      visited.schema_errors.insert(visited.schema_errors.end(), schema_errors.begin(), schema_errors.end());
+      if (!visited.schema_errors.empty())
+        return;
+
+      if (!visited.semantic_failure)
+      {
+        try
+        {
+          visited.references.push_back(BuildReactionSemanticRef(object));
+        }
+        catch (const std::exception& e)
+        {
+          visited.semantic_failure = ExceptionMessage(e);
+        }
+      }
+      if (!visited.build_failure)
+      {
+        try
+        {
+          parser->Parse(object, visited.reactions, unknown_properties);
+        }
+        catch (const std::exception& e)
+        {
+          visited.build_failure = ExceptionMessage(e);
+        }
+      }
+    }
+
+    // Streams the reactions of a reaction file's contents into `streamed`. If the contents cannot
+    // be streamed, they are loaded whole and the reactions not yet visited are taken from the
+    // loaded document. Returns the number of reactions visited.
+    std::size_t
+    StreamReactionFile(std::string content, VisitedReactions& streamed, types::UnknownProperties* unknown_properties)
+    {
+      std::size_t visited = 0;
+      auto visit = [&](const YAML::Node& reaction)
+      {
+        VisitReaction(reaction, streamed, unknown_properties);
+        ++visited;
+      };
+      if (StreamSequence(content, "", visit))
+        return visited;
+
+      std::size_t index = 0;
+      for (const auto& item : YAML::Load(content))
+        if (index++ >= visited)
+        {
+          VisitReaction(item, streamed, unknown_properties);
+          ++visited;
+        }
+      return visited;
+    }
+
+    // The reaction schema errors: type errors take precedence, since the per-type checks only
+    // run on reactions of a known type. A stored exception is rethrown instead.
+    Errors VisitedSchemaErrors(const VisitedReactions& visited)
+    {
+      if (visited.type_failure)
+        throw std::runtime_error(*visited.type_failure);
+      if (!visited.type_errors.empty())
+        return visited.type_errors;
+      if (visited.schema_failure)
+        throw std::runtime_error(*visited.schema_failure);
+      return visited.schema_errors;
+    }
   }  // namespace
 
-  semantics::ReactionsInput BuildReactionsSemanticInput(const YAML::Node& object)
+  semantics::ReactionRef BuildReactionSemanticRef(const MapView& reaction)
+  {
+    semantics::ReactionRef rr;
+    if (reaction[keys::type])
+      rr.type = reaction[keys::type].as<std::string>();
+    if (reaction[keys::gas_phase])
+    {
+      rr.phase = reaction[keys::gas_phase].as<std::string>();
+      rr.location = LocationOf(reaction[keys::gas_phase]);
+    }
+    // Reactant-like keys (must be in the reaction's phase).
+    CollectComponents(reaction, keys::reactants, rr.reactants);
+    CollectComponents(reaction, keys::gas_phase_species, rr.reactants);
+    // Product-like keys (may reference any phase).
+    CollectComponents(reaction, keys::products, rr.products);
+    CollectComponents(reaction, keys::alkoxy_products, rr.products);
+    CollectComponents(reaction, keys::nitrate_products, rr.products);
+    CollectComponents(reaction, keys::gas_phase_products, rr.products);
+    return rr;
+  }
+
+  semantics::ReactionsInput BuildReactionsSemanticInput(
+      const MapView& object,
+      std::vector<semantics::ReactionRef> reactions)
   {
     semantics::ReactionsInput input;
 
-    if (object[std::string(keys::species)])
-      for (const auto& s : object[std::string(keys::species)])
+    if (object[keys::species])
+      for (const auto& s : object[keys::species])
         input.species.push_back({ GetComponentName(s), LocationOf(s) });
 
-    if (object[std::string(keys::phases)])
-      for (const auto& phase : object[std::string(keys::phases)])
+    if (object[keys::phases])
+      for (const MapView phase : object[keys::phases])
       {
         semantics::PhaseRef pr;
-        pr.name = phase[std::string(keys::name)].as<std::string>();
+        pr.name = phase[keys::name].as<std::string>();
         pr.location = LocationOf(phase);
-        if (phase[std::string(keys::species)])
-          for (const auto& ps : phase[std::string(keys::species)])
+        if (phase[keys::species])
+          for (const auto& ps : phase[keys::species])
             pr.species.push_back({ GetComponentName(ps), LocationOf(ps) });
         input.phases.push_back(std::move(pr));
       }
 
-    if (object[std::string(keys::reactions)])
-      for (const auto& reaction : object[std::string(keys::reactions)])
-      {
-        semantics::ReactionRef rr;
-        if (reaction[std::string(keys::type)])
-          rr.type = reaction[std::string(keys::type)].as<std::string>();
-        if (reaction[std::string(keys::gas_phase)])
-        {
-          rr.phase = reaction[std::string(keys::gas_phase)].as<std::string>();
-          rr.location = LocationOf(reaction[std::string(keys::gas_phase)]);
-        }
-        // Reactant-like keys (must be in the reaction's phase).
-        CollectComponents(reaction, keys::reactants, rr.reactants);
-        CollectComponents(reaction, keys::gas_phase_species, rr.reactants);
-        // Product-like keys (may reference any phase).
-        CollectComponents(reaction, keys::products, rr.products);
-        CollectComponents(reaction, keys::alkoxy_products, rr.products);
-        CollectComponents(reaction, keys::nitrate_products, rr.products);
-        CollectComponents(reaction, keys::gas_phase_products, rr.products);
-        input.reactions.push_back(std::move(rr));
-      }
+    input.reactions = std::move(reactions);
 
     return input;
   }
 
-  semantics::AerosolInput BuildAerosolSemanticInput(const YAML::Node& object)
+  semantics::AerosolInput BuildAerosolSemanticInput(const MapView& object)
   {
     semantics::AerosolInput input;
 
-    if (object[std::string(keys::species)])
-      for (const auto& s : object[std::string(keys::species)])
-        input.species.push_back({ GetComponentName(s), static_cast<bool>(s[std::string(keys::molecular_weight)]) });
+    if (object[keys::species])
+      for (const MapView s : object[keys::species])
+        input.species.push_back({ GetComponentName(s), static_cast<bool>(s[keys::molecular_weight]) });
 
-    if (object[std::string(keys::phases)])
-      for (const auto& phase : object[std::string(keys::phases)])
+    if (object[keys::phases])
+      for (const MapView phase : object[keys::phases])
       {
         semantics::PhaseDef phase_def;
-        phase_def.name = phase[std::string(keys::name)].as<std::string>();
-        if (phase[std::string(keys::species)])
-          for (const auto& ps : phase[std::string(keys::species)])
+        phase_def.name = phase[keys::name].as<std::string>();
+        if (phase[keys::species])
+          for (const MapView ps : phase[keys::species])
           {
             semantics::PhaseSpeciesDef ps_def;
             ps_def.name = GetComponentName(ps);
-            if (!ps.IsScalar())
+            if (!ps.node().IsScalar())
             {
-              ps_def.has_diffusion_coefficient = static_cast<bool>(ps[std::string(keys::diffusion_coefficient)]);
-              ps_def.has_density = static_cast<bool>(ps[std::string(keys::density)]);
+              ps_def.has_diffusion_coefficient = static_cast<bool>(ps[keys::diffusion_coefficient]);
+              ps_def.has_density = static_cast<bool>(ps[keys::density]);
             }
             phase_def.species.push_back(std::move(ps_def));
           }
@@ -135,45 +256,41 @@ namespace mechanism_configuration::v1
       }
 
     // Sets mechanism.aerosol when both keys are present, avoiding errors for references omitted from the built Mechanism.
-    if (!(object[std::string(keys::aerosol_representations)] && object[std::string(keys::aerosol_processes)]))
+    if (!(object[keys::aerosol_representations] && object[keys::aerosol_processes]))
       return input;
 
-    for (const auto& rep_node : object[std::string(keys::aerosol_representations)])
+    for (const MapView rep_node : object[keys::aerosol_representations])
     {
       semantics::AerosolRepresentationRef ref;
-      ref.name = rep_node[std::string(keys::name)].as<std::string>();
+      ref.name = rep_node[keys::name].as<std::string>();
       ref.location = LocationOf(rep_node);
-      if (rep_node[std::string(keys::phases)])
-        for (const auto& phase_node : rep_node[std::string(keys::phases)])
+      if (rep_node[keys::phases])
+        for (const auto& phase_node : rep_node[keys::phases])
           ref.phases.push_back({ phase_node.as<std::string>(), LocationOf(phase_node) });
       input.representations.push_back(std::move(ref));
     }
 
-    for (const auto& entry : object[std::string(keys::aerosol_processes)])
+    for (const MapView entry : object[keys::aerosol_processes])
     {
-      const auto type = entry[std::string(keys::type)].as<std::string>();
+      const auto type = entry[keys::type].as<std::string>();
 
       if (type == keys::HenrysLawPhaseTransfer_key)
       {
         semantics::HenrysLawPhaseTransferRef ref;
-        ref.gas_phase = { entry[std::string(keys::gas_phase)].as<std::string>(),
-                          LocationOf(entry[std::string(keys::gas_phase)]) };
-        ref.gas_species = { entry[std::string(keys::gas_phase_species)].as<std::string>(),
-                            LocationOf(entry[std::string(keys::gas_phase_species)]) };
-        ref.condensed_phase = { entry[std::string(keys::condensed_phase)].as<std::string>(),
-                                LocationOf(entry[std::string(keys::condensed_phase)]) };
-        ref.condensed_species = { entry[std::string(keys::condensed_phase_species)].as<std::string>(),
-                                  LocationOf(entry[std::string(keys::condensed_phase_species)]) };
-        ref.solvent = { entry[std::string(keys::solvent)].as<std::string>(), LocationOf(entry[std::string(keys::solvent)]) };
+        ref.gas_phase = { entry[keys::gas_phase].as<std::string>(), LocationOf(entry[keys::gas_phase]) };
+        ref.gas_species = { entry[keys::gas_phase_species].as<std::string>(), LocationOf(entry[keys::gas_phase_species]) };
+        ref.condensed_phase = { entry[keys::condensed_phase].as<std::string>(), LocationOf(entry[keys::condensed_phase]) };
+        ref.condensed_species = { entry[keys::condensed_phase_species].as<std::string>(),
+                                  LocationOf(entry[keys::condensed_phase_species]) };
+        ref.solvent = { entry[keys::solvent].as<std::string>(), LocationOf(entry[keys::solvent]) };
         ref.location = LocationOf(entry);
         input.henrys_law_phase_transfers.push_back(std::move(ref));
       }
       else if (type == keys::DissolvedReaction_key)
       {
         semantics::DissolvedReactionRef ref;
-        ref.phase = { entry[std::string(keys::condensed_phase)].as<std::string>(),
-                      LocationOf(entry[std::string(keys::condensed_phase)]) };
-        ref.solvent = { entry[std::string(keys::solvent)].as<std::string>(), LocationOf(entry[std::string(keys::solvent)]) };
+        ref.phase = { entry[keys::condensed_phase].as<std::string>(), LocationOf(entry[keys::condensed_phase]) };
+        ref.solvent = { entry[keys::solvent].as<std::string>(), LocationOf(entry[keys::solvent]) };
         CollectComponents(entry, keys::reactants, ref.reactants);
         CollectComponents(entry, keys::products, ref.products);
         ref.location = LocationOf(entry);
@@ -182,9 +299,8 @@ namespace mechanism_configuration::v1
       else if (type == keys::DissolvedReversibleReaction_key)
       {
         semantics::DissolvedReversibleReactionRef ref;
-        ref.phase = { entry[std::string(keys::condensed_phase)].as<std::string>(),
-                      LocationOf(entry[std::string(keys::condensed_phase)]) };
-        ref.solvent = { entry[std::string(keys::solvent)].as<std::string>(), LocationOf(entry[std::string(keys::solvent)]) };
+        ref.phase = { entry[keys::condensed_phase].as<std::string>(), LocationOf(entry[keys::condensed_phase]) };
+        ref.solvent = { entry[keys::solvent].as<std::string>(), LocationOf(entry[keys::solvent]) };
         CollectComponents(entry, keys::reactants, ref.reactants);
         CollectComponents(entry, keys::products, ref.products);
         ref.location = LocationOf(entry);
@@ -193,26 +309,22 @@ namespace mechanism_configuration::v1
       else if (type == keys::HenrysLawEquilibrium_key)
       {
         semantics::HenrysLawEquilibriumRef ref;
-        ref.gas_phase = { entry[std::string(keys::gas_phase)].as<std::string>(),
-                          LocationOf(entry[std::string(keys::gas_phase)]) };
-        ref.gas_species = { entry[std::string(keys::gas_phase_species)].as<std::string>(),
-                            LocationOf(entry[std::string(keys::gas_phase_species)]) };
-        ref.condensed_phase = { entry[std::string(keys::condensed_phase)].as<std::string>(),
-                                LocationOf(entry[std::string(keys::condensed_phase)]) };
-        ref.condensed_species = { entry[std::string(keys::condensed_phase_species)].as<std::string>(),
-                                  LocationOf(entry[std::string(keys::condensed_phase_species)]) };
-        ref.solvent = { entry[std::string(keys::solvent)].as<std::string>(), LocationOf(entry[std::string(keys::solvent)]) };
+        ref.gas_phase = { entry[keys::gas_phase].as<std::string>(), LocationOf(entry[keys::gas_phase]) };
+        ref.gas_species = { entry[keys::gas_phase_species].as<std::string>(), LocationOf(entry[keys::gas_phase_species]) };
+        ref.condensed_phase = { entry[keys::condensed_phase].as<std::string>(), LocationOf(entry[keys::condensed_phase]) };
+        ref.condensed_species = { entry[keys::condensed_phase_species].as<std::string>(),
+                                  LocationOf(entry[keys::condensed_phase_species]) };
+        ref.solvent = { entry[keys::solvent].as<std::string>(), LocationOf(entry[keys::solvent]) };
         ref.location = LocationOf(entry);
         input.henrys_law_equilibria.push_back(std::move(ref));
       }
       else if (type == keys::DissolvedEquilibrium_key)
       {
         semantics::DissolvedEquilibriumRef ref;
-        ref.phase = { entry[std::string(keys::condensed_phase)].as<std::string>(),
-                      LocationOf(entry[std::string(keys::condensed_phase)]) };
-        ref.algebraic_species = { entry[std::string(keys::algebraic_species)].as<std::string>(),
-                                  LocationOf(entry[std::string(keys::algebraic_species)]) };
-        ref.solvent = { entry[std::string(keys::solvent)].as<std::string>(), LocationOf(entry[std::string(keys::solvent)]) };
+        ref.phase = { entry[keys::condensed_phase].as<std::string>(), LocationOf(entry[keys::condensed_phase]) };
+        ref.algebraic_species = { entry[keys::algebraic_species].as<std::string>(),
+                                  LocationOf(entry[keys::algebraic_species]) };
+        ref.solvent = { entry[keys::solvent].as<std::string>(), LocationOf(entry[keys::solvent]) };
         CollectComponents(entry, keys::reactants, ref.reactants);
         CollectComponents(entry, keys::products, ref.products);
         ref.location = LocationOf(entry);
@@ -221,18 +333,15 @@ namespace mechanism_configuration::v1
       else if (type == keys::LinearConstraint_key)
       {
         semantics::LinearConstraintRef ref;
-        ref.algebraic_phase = { entry[std::string(keys::algebraic_phase)].as<std::string>(),
-                                LocationOf(entry[std::string(keys::algebraic_phase)]) };
-        ref.algebraic_species = { entry[std::string(keys::algebraic_species)].as<std::string>(),
-                                  LocationOf(entry[std::string(keys::algebraic_species)]) };
-        if (entry[std::string(keys::terms)])
-          for (const auto& term_node : entry[std::string(keys::terms)])
+        ref.algebraic_phase = { entry[keys::algebraic_phase].as<std::string>(), LocationOf(entry[keys::algebraic_phase]) };
+        ref.algebraic_species = { entry[keys::algebraic_species].as<std::string>(),
+                                  LocationOf(entry[keys::algebraic_species]) };
+        if (entry[keys::terms])
+          for (const MapView term_node : entry[keys::terms])
           {
             semantics::LinearConstraintTermRef term_ref;
-            term_ref.phase = { term_node[std::string(keys::phase)].as<std::string>(),
-                               LocationOf(term_node[std::string(keys::phase)]) };
-            term_ref.species = { term_node[std::string(keys::name)].as<std::string>(),
-                                 LocationOf(term_node[std::string(keys::name)]) };
+            term_ref.phase = { term_node[keys::phase].as<std::string>(), LocationOf(term_node[keys::phase]) };
+            term_ref.species = { term_node[keys::name].as<std::string>(), LocationOf(term_node[keys::name]) };
             ref.terms.push_back(std::move(term_ref));
           }
         ref.location = LocationOf(entry);
@@ -243,111 +352,165 @@ namespace mechanism_configuration::v1
     return input;
   }
 
-  semantics::EmissionsInput BuildEmissionsSemanticInput(const YAML::Node& object)
+  semantics::EmissionsInput BuildEmissionsSemanticInput(const MapView& object)
   {
     semantics::EmissionsInput input;
 
-    if (!object[std::string(keys::emissions)])
+    if (!object[keys::emissions])
       return input;
 
-    const YAML::Node& emissions_node = object[std::string(keys::emissions)];
+    const MapView emissions_node(object[keys::emissions]);
 
-    if (emissions_node[std::string(keys::inventories)])
-      for (const auto& item : emissions_node[std::string(keys::inventories)])
-        input.inventories.push_back({ item[std::string(keys::name)].as<std::string>(), LocationOf(item) });
+    if (emissions_node[keys::inventories])
+      for (const MapView item : emissions_node[keys::inventories])
+        input.inventories.push_back({ item[keys::name].as<std::string>(), LocationOf(item) });
 
-    if (emissions_node[std::string(keys::species_maps)])
-      for (const auto& item : emissions_node[std::string(keys::species_maps)])
+    if (emissions_node[keys::species_maps])
+      for (const MapView item : emissions_node[keys::species_maps])
       {
         semantics::SpeciesMapRef smap_ref;
-        smap_ref.name = item[std::string(keys::name)].as<std::string>();
+        smap_ref.name = item[keys::name].as<std::string>();
         smap_ref.location = LocationOf(item);
-        if (item[std::string(keys::mappings)])
-          for (const auto& mapping_node : item[std::string(keys::mappings)])
+        if (item[keys::mappings])
+          for (const MapView mapping_node : item[keys::mappings])
           {
             semantics::SpeciesMappingRef mapping_ref;
-            mapping_ref.inventory_species = mapping_node[std::string(keys::inventory_species)].as<std::string>();
-            mapping_ref.mechanism_species = mapping_node[std::string(keys::mechanism_species)].as<std::string>();
-            if (mapping_node[std::string(keys::scaling_factor)])
-              mapping_ref.scaling_factor = mapping_node[std::string(keys::scaling_factor)].as<double>();
+            mapping_ref.inventory_species = mapping_node[keys::inventory_species].as<std::string>();
+            mapping_ref.mechanism_species = mapping_node[keys::mechanism_species].as<std::string>();
+            if (mapping_node[keys::scaling_factor])
+              mapping_ref.scaling_factor = mapping_node[keys::scaling_factor].as<double>();
             smap_ref.mappings.push_back(std::move(mapping_ref));
           }
         input.species_maps.push_back(std::move(smap_ref));
       }
 
-    if (emissions_node[std::string(keys::sources)])
-      for (const auto& item : emissions_node[std::string(keys::sources)])
+    if (emissions_node[keys::sources])
+      for (const MapView item : emissions_node[keys::sources])
       {
         semantics::SourceRef source_ref;
-        source_ref.name = item[std::string(keys::name)].as<std::string>();
+        source_ref.name = item[keys::name].as<std::string>();
         source_ref.location = LocationOf(item);
-        source_ref.inventory = { item[std::string(keys::inventory)].as<std::string>(),
-                                 LocationOf(item[std::string(keys::inventory)]) };
-        source_ref.species_map = { item[std::string(keys::species_map)].as<std::string>(),
-                                   LocationOf(item[std::string(keys::species_map)]) };
-        if (item[std::string(keys::category)])
-          source_ref.category = item[std::string(keys::category)].as<int>();
-        if (item[std::string(keys::hierarchy)])
-          source_ref.hierarchy = item[std::string(keys::hierarchy)].as<int>();
+        source_ref.inventory = { item[keys::inventory].as<std::string>(), LocationOf(item[keys::inventory]) };
+        source_ref.species_map = { item[keys::species_map].as<std::string>(), LocationOf(item[keys::species_map]) };
+        if (item[keys::category])
+          source_ref.category = item[keys::category].as<int>();
+        if (item[keys::hierarchy])
+          source_ref.hierarchy = item[keys::hierarchy].as<int>();
         input.sources.push_back(std::move(source_ref));
       }
 
     return input;
   }
 
-  std::expected<YAML::Node, Errors> Parser::ResolveFileConfig(const std::filesystem::path& config_path)
+  std::expected<YAML::Node, Errors> Parser::ResolveFileConfig(
+      State& state,
+      const YAML::Node& object,
+      const std::filesystem::path& config_path,
+      VisitedReactions* streamed) const
   {
-    if (!std::filesystem::exists(config_path) || !std::filesystem::is_regular_file(config_path))
-    {
-      return std::unexpected(Errors{
-          { ErrorCode::FileNotFound,
-            mc_fmt::format("Configuration file '{}' does not exist or is not a regular file.", config_path.string()) } });
-    }
-
-    SetConfigPath(config_path.string());
-
-    YAML::Node object;
-    try
-    {
-      object = YAML::LoadFile(config_path.string());
-    }
-    catch (const std::exception& e)
-    {
-      return std::unexpected(Errors{
-          { ErrorCode::UnexpectedError, mc_fmt::format("Failed to parse '{}': {}", config_path.string(), e.what()) } });
-    }
+    StageTimer timer(options_.observer, ParseStage::ResolveFiles, config_path);
+    state.config_path = config_path.string();
+    state.source_files.assign({ config_path });
 
     Errors errors;
     const std::filesystem::path base_dir = config_path.parent_path();
-    const Version version = object[keys::version] ? Version(object[keys::version].as<std::string>()) : Version();
+    const MapView sections(object);
+    const Version version = sections[keys::version] ? Version(sections[keys::version].as<std::string>()) : Version();
 
     YAML::Node combined;
-    if (object[keys::version])
-      combined[std::string(keys::version)] = object[keys::version];
-    if (object[keys::name])
-      combined[std::string(keys::name)] = object[keys::name];
-
-    // Loads and concatenates every file referenced under `<entity>.files`.
+    if (sections[keys::version])
+      combined[keys::version] = sections[keys::version];
+    if (sections[keys::name])
+      combined[keys::name] = sections[keys::name];
+
+    // Loads and concatenates every file referenced under `<entity>.files`. Streamed reaction
+    // files go to `streamed` instead, leaving the merged sequence empty.
+    //
+    // Each file is read (and, unless streamed, loaded) on its own, then merged in list order.
+    // Only the reading may run concurrently, so the merged sequence and the errors come out in
+    // the same order whether or not the files are loaded in parallel.
     auto load_files = [&](std::string_view entity) -> YAML::Node
     {
+      struct SectionFile
+      {
+        std::filesystem::path path;
+        std::optional<std::pair<ErrorCode, std::string>> error;
+        YAML::Node document;
+        std::string content;  // the unparsed text, for a streamed reaction file
+      };
+
       YAML::Node merged(YAML::NodeType::Sequence);
-      for (const auto& file_node : object[std::string(entity)]["files"])
+      const bool stream = streamed != nullptr && entity == keys::reactions;
+
+      auto load = [stream, observer = options_.observer](SectionFile& file)
       {
-        const std::filesystem::path file_path = base_dir / file_node.as<std::string>();
-        if (!std::filesystem::exists(file_path))
+        if (!std::filesystem::exists(file.path))
         {
-          errors.push_back({ ErrorCode::FileNotFound, "File not found: " + file_path.string() });
-          continue;
+          file.error = { ErrorCode::FileNotFound, "File not found: " + file.path.string() };
+          return;
         }
         try
         {
-          YAML::Node loaded = YAML::LoadFile(file_path.string());
-          for (const auto& item : loaded)
+          if (!stream)
+          {
+            file.document = LoadFile(file.path, observer);
+            return;
+          }
+          std::optional<std::string> content = ReadFileContents(file.path, observer);
+          if (!content)
+            throw YAML::BadFile(file.path.string());
+          file.content = std::move(*content);
+        }
+        catch (const std::exception& e)
+        {
+          file.error = { ErrorCode::UnexpectedError, "Failed to parse file: " + file.path.string() + ": " + e.what() };
+        }
+      };
+      auto merge = [&](SectionFile& file)
+      {
+        if (file.error)
+        {
+          errors.push_back(std::move(*file.error));
+          return;
+        }
+        try
+        {
+          if (stream)
+          {
+            StageTimer stream_timer(options_.observer, ParseStage::StreamReactions, file.path);
+            stream_timer.bytes = file.content.size();
+            stream_timer.nodes = StreamReactionFile(std::move(file.content), *streamed, CollectedProperties(state));
+            return;
+          }
+          for (const auto& item : file.document)
             merged.push_back(item);
         }
         catch (const std::exception& e)
         {
-          errors.push_back({ ErrorCode::UnexpectedError, "Failed to parse file: " + file_path.string() + ": " + e.what() });
+          errors.push_back({ ErrorCode::UnexpectedError, "Failed to parse file: " + file.path.string() + ": " + e.what() });
+        }
+      };
+
+      std::vector<SectionFile> files;
+      for (const auto& file_node : MapView(sections[entity])["files"])
+        files.push_back({ base_dir / file_node.as<std::string>() });
+      for (const auto& file : files)
+        state.source_files.push_back(file.path);
+
+      if (options_.parallel_file_loading)
+      {
+        ParallelFor(files.size(), [&](std::size_t i) { load(files[i]); });
+        for (auto& file : files)
+          merge(file);
+      }
+      else
+      {
+        // One file at a time, so a streamed file's text is released before the next is read.
+        for (auto& file : files)
+        {
+          load(file);
+          merge(file);
+          file = SectionFile{};
         }
       }
       return merged;
@@ -357,16 +520,18 @@ namespace mechanism_configuration::v1
     // normal schema validation reports them; malformed sections are flagged here.
     auto resolve_section = [&](std::string_view entity)
     {
-      const std::string key(entity);
-      if (!object[key])
+      const YAML::Node& section = sections[entity];
+      if (!section)
         return;
 
-      switch (GetEntityFormat(object[key]))
+      // The combined node is built with yaml-cpp, whose keys are strings
+      const std::string key(entity);
+      switch (GetEntityFormat(section))
       {
-        case EntityFormat::Inline: combined[key] = object[key]; break;
+        case EntityFormat::Inline: combined[key] = section; break;
         case EntityFormat::FileList: combined[key] = load_files(entity); break;
         case EntityFormat::Invalid:
-          if (object[key].IsMap())
+          if (section.IsMap())
             errors.push_back({ ErrorCode::RequiredKeyNotFound, "Missing 'files' key in '" + key + "' section." });
           else
             errors.push_back({ ErrorCode::InvalidType, "'" + key + "' must be a file-list object or an inline array." });
@@ -374,17 +539,17 @@ namespace mechanism_configuration::v1
       }
     };
     // A file-list layout requires minor version >= 1; check before loading any files.
-    const bool uses_filelist = (object[std::string(keys::species)] &&
-                                GetEntityFormat(object[std::string(keys::species)]) == EntityFormat::FileList) ||
-                               (object[std::string(keys::phases)] &&
-                                GetEntityFormat(object[std::string(keys::phases)]) == EntityFormat::FileList) ||
-                               (object[std::string(keys::reactions)] &&
-                                GetEntityFormat(object[std::string(keys::reactions)]) == EntityFormat::FileList);
+    const bool uses_filelist = (sections[keys::species] &&
+                                GetEntityFormat(sections[keys::species]) == EntityFormat::FileList) ||
+                               (sections[keys::phases] &&
+                                GetEntityFormat(sections[keys::phases]) == EntityFormat::FileList) ||
+                               (sections[keys::reactions] &&
+                                GetEntityFormat(sections[keys::reactions]) == EntityFormat::FileList);
     if (uses_filelist && version.minor < 1)
     {
       errors.push_back({ ErrorCode::InvalidVersion,
                          "File-list format requires minor version >= 1, got " + std::to_string(version.minor) + "." });
-      AppendFilePath(config_path_, errors);
+      AppendFilePath(state.config_path, errors);
       return std::unexpected(std::move(errors));
     }
 
@@ -394,32 +559,33 @@ namespace mechanism_configuration::v1
     resolve_section(keys::aerosol_representations);
     resolve_section(keys::aerosol_processes);
 
-    if (object[std::string(keys::emissions)])
-      combined[std::string(keys::emissions)] = object[std::string(keys::emissions)];
+    if (sections[keys::emissions])
+      combined[keys::emissions] = sections[keys::emissions];
 
     if (!errors.empty())
     {
-      AppendFilePath(config_path_, errors);
+      TruncateErrors(errors, options_.validation.ErrorLimit());
+      AppendFilePath(state.config_path, errors);
       return std::unexpected(std::move(errors));
     }
 
     return combined;
   }
 
-  Errors Parser::CheckSchema(const YAML::Node& object)
+  Errors Parser::CheckSchema(State& state, const YAML::Node& object, ParsedSections& parsed) const
   {
     Errors errors;
+    const std::size_t max_errors = options_.validation.ErrorLimit();
 
-    std::vector<std::string_view> required_keys = { keys::version, keys::species, keys::phases };
-    std::vector<std::string_view> optional_keys = {
-      keys::name, keys::reactions, keys::aerosol_representations, keys::aerosol_processes, keys::emissions
-    };
+    static const Schema schema(
+        { keys::version, keys::species, keys::phases },
+        { keys::name, keys::reactions, keys::aerosol_representations, keys::aerosol_processes, keys::emissions });
 
     // Return early if the required keys are not found
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
-      AppendFilePath(config_path_, schema_errors);
+      AppendFilePath(state.config_path, schema_errors);
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
       return errors;
     }
@@ -431,7 +597,7 @@ namespace mechanism_configuration::v1
     const bool has_aerosol_processes = static_cast<bool>(object[keys::aerosol_processes]);
     if (has_aerosol_representations != has_aerosol_processes)
     {
-      ErrorLocation error_location{ object.Mark().line, object.Mark().column };
+      ErrorLocation error_location = LocationOf(object);
       errors.push_back({ ErrorCode::RequiredKeyNotFound,
                          mc_fmt::format(
                              "{} error: '{}' and '{}' must be provided together.",
@@ -441,7 +607,7 @@ namespace mechanism_configuration::v1
     }
     if (!has_reactions && !(has_aerosol_representations && has_aerosol_processes))
     {
-      ErrorLocation error_location{ object.Mark().line, object.Mark().column };
+      ErrorLocation error_location = LocationOf(object);
       errors.push_back({ ErrorCode::RequiredKeyNotFound,
                          mc_fmt::format(
                              "{} error: A configuration must contain either '{}' or both '{}' and '{}'.",
@@ -452,7 +618,7 @@ namespace mechanism_configuration::v1
     }
     if (!errors.empty())
     {
-      AppendFilePath(config_path_, errors);
+      AppendFilePath(state.config_path, errors);
       return errors;
     }
 
@@ -460,14 +626,14 @@ namespace mechanism_configuration::v1
     Version version = Version(object[keys::version].as<std::string>());
     if (version.major != MAJOR_VERSION)
     {
-      ErrorLocation error_location{ object[keys::version].Mark().line, object[keys::version].Mark().column };
+      ErrorLocation error_location = LocationOf(object[keys::version]);
 
       std::string message = mc_fmt::format(
           "{} error: The version must be '{}' but the invalid version number '{}' found.",
           error_location,
           MAJOR_VERSION,
           version.major);
-      errors.push_back({ ErrorCode::InvalidVersion, config_path_ + ":" + message });
+      errors.push_back({ ErrorCode::InvalidVersion, state.config_path + ":" + message });
     }
 
     // Species and phases are foundational. If either is invalid, fail fast since all downstream
@@ -475,33 +641,47 @@ namespace mechanism_configuration::v1
     schema_errors = CheckSpeciesSchema(object[keys::species]);
     if (!schema_errors.empty())
     {
-      AppendFilePath(config_path_, schema_errors);
+      AppendFilePath(state.config_path, schema_errors);
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
       return errors;
     }
 
-    auto parsed_species = ParseSpecies(object[keys::species]);
+    parsed.species = ParseSpecies(object[keys::species], CollectedProperties(state));
 
-    schema_errors = CheckPhasesSchema(object[keys::phases], parsed_species);
+    schema_errors = CheckPhasesSchema(object[keys::phases], parsed.species);
     if (!schema_errors.empty())
     {
-      AppendFilePath(config_path_, schema_errors);
+      AppendFilePath(state.config_path, schema_errors);
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
       return errors;
     }
 
-    auto parsed_phases = ParsePhases(object[keys::phases]);
+    parsed.phases = ParsePhases(object[keys::phases], CollectedProperties(state));
 
-    // Gas-phase reactions are optional (an aerosol-only config may omit them).
+    // Gas-phase reactions are optional (an aerosol-only config may omit them). Each reaction is
+    // checked, referenced and built in the same visit.
     if (has_reactions)
     {
-      schema_errors = CheckReactionsSchema(object[keys::reactions], parsed_species, parsed_phases);
+      if (!parsed.reactions_visited)
+      {
+        parsed.reactions.max_errors = max_errors;
+        for (const auto& reaction : object[keys::reactions])
+        {
+          VisitReaction(reaction, parsed.reactions, CollectedProperties(state));
+          if (VisitLimitReached(parsed.reactions))
+            break;
+        }
+        parsed.reactions_visited = true;
+      }
+      schema_errors = VisitedSchemaErrors(parsed.reactions);
       if (!schema_errors.empty())
       {
-        AppendFilePath(config_path_, schema_errors);
+        AppendFilePath(state.config_path, schema_errors);
         errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
       }
     }
+    if (ErrorLimitReached(errors, max_errors))
+      return errors;
 
     // Aerosol sections are optional.
     if (has_aerosol_representations && has_aerosol_processes)
@@ -509,24 +689,26 @@ namespace mechanism_configuration::v1
       schema_errors = CheckAerosolRepresentationsSchema(object[keys::aerosol_representations]);
       if (!schema_errors.empty())
       {
-        AppendFilePath(config_path_, schema_errors);
+        AppendFilePath(state.config_path, schema_errors);
         errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
       }
 
       schema_errors = CheckAerosolProcessesSchema(object[keys::aerosol_processes]);
       if (!schema_errors.empty())
       {
-        AppendFilePath(config_path_, schema_errors);
+        AppendFilePath(state.config_path, schema_errors);
         errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
       }
     }
+    if (ErrorLimitReached(errors, max_errors))
+      return errors;
 
-    if (object[std::string(keys::emissions)])
+    if (object[keys::emissions])
     {
-      schema_errors = CheckEmissionsSchema(object[std::string(keys::emissions)]);
+      schema_errors = CheckEmissionsSchema(object[keys::emissions]);
       if (!schema_errors.empty())
       {
-        AppendFilePath(config_path_, schema_errors);
+        AppendFilePath(state.config_path, schema_errors);
         errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
         return errors;
       }
@@ -535,81 +717,236 @@ namespace mechanism_configuration::v1
     return errors;
   }
 
-  std::expected<Mechanism, Errors> Parser::Parse(const std::filesystem::path& config_path)
+  std::expected<Mechanism, Errors>
+  Parser::Parse(const std::filesystem::path& config_path, std::vector<std::filesystem::path>* source_files) const
+  {
+    if (!std::filesystem::exists(config_path) || !std::filesystem::is_regular_file(config_path))
+    {
+      return std::unexpected(Errors{
+          { ErrorCode::FileNotFound,
+            mc_fmt::format("Configuration file '{}' does not exist or is not a regular file.", config_path.string()) } });
+    }
+
+    std::string content;
+    YAML::Node object;
+    try
+    {
+      object = LoadFile(config_path, options_.observer, content);
+    }
+    catch (const std::exception& e)
+    {
+      return std::unexpected(Errors{
+          { ErrorCode::UnexpectedError, mc_fmt::format("Failed to parse '{}': {}", config_path.string(), e.what()) } });
+    }
+
+    const ScopedSource source(content);
+    return Parse(object, config_path, source_files);
+  }
+
+  std::expected<Mechanism, Errors> Parser::Parse(
+      const YAML::Node& object,
+      const std::filesystem::path& config_path,
+      std::vector<std::filesystem::path>* source_files) const
+  {
+    State state;
+    // ResolveFileConfig sets state.config_path so errors carry the file path.
+    auto resolved = ResolveFileConfig(state, object, config_path);
+    if (source_files)
+      *source_files = state.source_files;
+    if (!resolved)
+    {
+      return std::unexpected(std::move(resolved.error()));
+    }
+    return ValidateAndBuild(state, *resolved);
+  }
+
+  std::expected<Mechanism, Errors> Parser::ParseStreaming(
+      std::string content,
+      const std::filesystem::path& config_path,
+      std::vector<std::filesystem::path>* source_files) const
   {
-    // ResolveFileConfig sets config_path_ so errors carry the file path.
-    auto object = ResolveFileConfig(config_path);
-    if (!object)
+    State state;
+    VisitedReactions streamed{ .max_errors = options_.validation.ErrorLimit() };
+    std::size_t visited = 0;
+    auto visit = [&](const YAML::Node& reaction)
+    {
+      VisitReaction(reaction, streamed, CollectedProperties(state));
+      ++visited;
+    };
+    YAML::Node object;
+    try
+    {
+      bool streamable = false;
+      {
+        StageTimer timer(options_.observer, ParseStage::StreamReactions, config_path);
+        timer.bytes = content.size();
+        streamable = StreamSequence(content, keys::reactions, visit);
+        timer.nodes = visited;
+      }
+      if (!streamable)
+      {
+        const ScopedSource source(content);
+        return Parse(LoadDocument(content, options_.observer, config_path), config_path, source_files);
+      }
+      object = LoadDocument(content, options_.observer, config_path);
+    }
+    catch (const std::exception& e)
     {
-      return std::unexpected(std::move(object.error()));
+      return std::unexpected(Errors{
+          { ErrorCode::UnexpectedError, mc_fmt::format("Failed to parse '{}': {}", config_path.string(), e.what()) } });
     }
-    return ValidateAndBuild(*object);
+
+    // ResolveFileConfig sets state.config_path so errors carry the file path.
+    const ScopedSource source(content);
+    auto resolved = ResolveFileConfig(state, object, config_path, &streamed);
+    if (source_files)
+      *source_files = state.source_files;
+    if (!resolved)
+    {
+      return std::unexpected(std::move(resolved.error()));
+    }
+    return ValidateAndBuild(state, *resolved, &streamed);
   }
 
-  std::expected<Mechanism, Errors> Parser::Parse(const std::string& content)
+  std::expected<Mechanism, Errors> Parser::ParseStreaming(std::string content) const
   {
-    SetDefaultConfigPath();  // no file backing this document
+    State state;  // no file backs this document
+    VisitedReactions streamed{ .max_errors = options_.validation.ErrorLimit() };
+    std::size_t visited = 0;
+    auto visit = [&](const YAML::Node& reaction)
+    {
+      VisitReaction(reaction, streamed, CollectedProperties(state));
+      ++visited;
+    };
     YAML::Node object;
     try
     {
-      object = YAML::Load(content);
+      bool streamable = false;
+      {
+        StageTimer timer(options_.observer, ParseStage::StreamReactions);
+        timer.bytes = content.size();
+        streamable = StreamSequence(content, keys::reactions, visit);
+        timer.nodes = visited;
+      }
+      if (!streamable)
+        return Parse(content);
+      object = LoadDocument(content, options_.observer);
     }
     catch (const std::exception& e)
     {
       return std::unexpected(
           Errors{ { ErrorCode::UnexpectedError, mc_fmt::format("Failed to parse document: {}", e.what()) } });
     }
-    return ValidateAndBuild(object);
+    const ScopedSource source(content);
+    return ValidateAndBuild(state, object, &streamed);
   }
 
-  std::expected<Mechanism, Errors> Parser::Parse(const YAML::Node& object)
+  std::expected<Mechanism, Errors> Parser::Parse(const std::string& content) const
   {
-    SetDefaultConfigPath();  // no file backing this node
-    return ValidateAndBuild(object);
+    YAML::Node object;
+    try
+    {
+      object = LoadDocument(content, options_.observer);
+    }
+    catch (const std::exception& e)
+    {
+      return std::unexpected(
+          Errors{ { ErrorCode::UnexpectedError, mc_fmt::format("Failed to parse document: {}", e.what()) } });
+    }
+    const ScopedSource source(content);
+    return Parse(object);
   }
 
-  std::expected<Mechanism, Errors> Parser::ValidateAndBuild(const YAML::Node& object)
+  std::expected<Mechanism, Errors> Parser::Parse(const YAML::Node& object) const
+  {
+    State state;  // no file backs this node
+    return ValidateAndBuild(state, object);
+  }
+
+  std::expected<Mechanism, Errors>
+  Parser::ValidateAndBuild(State& state, const YAML::Node& object, VisitedReactions* streamed) const
   {
     try
     {
+      ParsedSections parsed;
+      if (streamed)
+      {
+        parsed.reactions = std::move(*streamed);
+        parsed.reactions_visited = true;
+      }
+      const std::size_t max_errors = options_.validation.ErrorLimit();
+      // Each stage below works on the whole document; only count it when someone is watching.
+      const std::size_t nodes = options_.observer ? CountNodes(object) : 0;
+
       // Structural (schema) validation.
-      Errors errors = CheckSchema(object);
+      Errors errors;
+      {
+        StageTimer timer(options_.observer, ParseStage::CheckSchema, state.config_path);
+        timer.nodes = nodes;
+        errors = CheckSchema(state, object, parsed);
+      }
 
       // Semantic validation — needs a structurally-valid document, so only run it when
       // the structure is clean.
       if (errors.empty())
       {
-        auto semantic_errors = ValidateReactionsSemantics(BuildReactionsSemanticInput(object));
-        auto aerosol_errors = ValidateAerosolSemantics(BuildAerosolSemanticInput(object));
-        auto emissions_errors = ValidateEmissionsSemantics(BuildEmissionsSemanticInput(object));
-        semantic_errors.insert(semantic_errors.end(), aerosol_errors.begin(), aerosol_errors.end());
-        semantic_errors.insert(semantic_errors.end(), emissions_errors.begin(), emissions_errors.end());
-        AppendFilePath(config_path_, semantic_errors);
-        errors.insert(errors.end(), semantic_errors.begin(), semantic_errors.end());
+        StageTimer timer(options_.observer, ParseStage::ValidateSemantics, state.config_path);
+        timer.nodes = nodes;
+        if (parsed.reactions.semantic_failure)
+          throw std::runtime_error(*parsed.reactions.semantic_failure);
+        Diagnostics semantic{ .files = { state.config_path } };
+        auto& semantic_errors = semantic.entries;
+        semantic_errors = ValidateReactionsSemantics(
+            BuildReactionsSemanticInput(object, std::move(parsed.reactions.references)), max_errors);
+        if (!ErrorLimitReached(semantic_errors, max_errors))
+        {
+          auto aerosol_errors = ValidateAerosolSemantics(BuildAerosolSemanticInput(object), max_errors);
+          semantic_errors.insert(
+              semantic_errors.end(),
+              std::make_move_iterator(aerosol_errors.begin()),
+              std::make_move_iterator(aerosol_errors.end()));
+        }
+        if (!ErrorLimitReached(semantic_errors, max_errors))
+        {
+          auto emissions_errors = ValidateEmissionsSemantics(BuildEmissionsSemanticInput(object), max_errors);
+          semantic_errors.insert(
+              semantic_errors.end(),
+              std::make_move_iterator(emissions_errors.begin()),
+              std::make_move_iterator(emissions_errors.end()));
+        }
+        TruncateErrors(semantic_errors, max_errors);
+        // Every semantic error is in the configuration file
+        for (auto& diagnostic : semantic_errors)
+          diagnostic.file = 0;
+        Errors formatted = semantic.ToErrors();
+        errors.insert(errors.end(), std::make_move_iterator(formatted.begin()), std::make_move_iterator(formatted.end()));
       }
 
       if (!errors.empty())
       {
+        TruncateErrors(errors, max_errors);
         return std::unexpected(std::move(errors));
       }
 
-      return Build(object);
+      StageTimer timer(options_.observer, ParseStage::Build, state.config_path);
+      timer.nodes = nodes;
+      return Build(state, object, parsed);
     }
     catch (const std::exception& e)
     {
-      const std::string where = config_path_.empty() ? "document" : "'" + config_path_ + "'";
+      const std::string where = state.config_path.empty() ? "document" : "'" + state.config_path + "'";
       return std::unexpected(
           Errors{ { ErrorCode::UnexpectedError, mc_fmt::format("Failed to parse {}: {}", where, e.what()) } });
     }
   }
 
-  Mechanism Parser::Build(const YAML::Node& object)
+  Mechanism Parser::Build(State& state, const YAML::Node& object, ParsedSections& parsed) const
   {
     Mechanism mechanism;
 
     mechanism.version = Version(object[keys::version].as<std::string>());
-    mechanism.species = ParseSpecies(object[keys::species]);
-    mechanism.phases = ParsePhases(object[keys::phases]);
+    mechanism.species = std::move(parsed.species);
+    mechanism.phases = std::move(parsed.phases);
 
     if (object[keys::name])
     {
@@ -617,17 +954,21 @@ namespace mechanism_configuration::v1
     }
     if (object[keys::reactions])
     {
-      mechanism.reactions = ParseReactions(object[keys::reactions]);
+      if (parsed.reactions.build_failure)
+        throw std::runtime_error(*parsed.reactions.build_failure);
+      mechanism.reactions = std::move(parsed.reactions.reactions);
     }
     if (object[keys::aerosol_representations] && object[keys::aerosol_processes])
     {
-      mechanism.aerosol = ParseAerosol(object, mechanism.species, mechanism.phases);
+      mechanism.aerosol = ParseAerosol(object, mechanism.species, mechanism.phases, CollectedProperties(state));
     }
-    if (object[std::string(keys::emissions)])
+    if (object[keys::emissions])
     {
-      mechanism.emissions = ParseEmissions(object[std::string(keys::emissions)]);
+      mechanism.emissions = ParseEmissions(object[keys::emissions], CollectedProperties(state));
     }
+    mechanism.unknown_properties = std::move(state.unknown_properties);
 
+    AssignIndices(mechanism);
     return mechanism;
   }
 
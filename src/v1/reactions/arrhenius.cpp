@@ -24,15 +24,16 @@ namespace mechanism_configuration::v1
   /// @param existing_phases Unused; semantic checks live in ValidateReactionsSemantics
   /// @return A list of validation errors, if any
   Errors ArrheniusParser::CheckSchema(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+      const std::vector<types::Phase>& existing_phases) const
   {
-    std::vector<std::string_view> required_keys = { keys::reactants, keys::products, keys::type, keys::gas_phase };
-    std::vector<std::string_view> optional_keys = { keys::A, keys::B, keys::C, keys::D, keys::E, keys::Ea, keys::name };
+    static const Schema schema(
+        { keys::reactants, keys::products, keys::type, keys::gas_phase },
+        { keys::A, keys::B, keys::C, keys::D, keys::E, keys::Ea, keys::name });
     Errors errors;
 
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -56,7 +57,7 @@ namespace mechanism_configuration::v1
     if (object[keys::Ea] && object[keys::C])
     {
       const auto& node = object[keys::Ea];
-      ErrorLocation error_location{ node.Mark().line, node.Mark().column };
+      ErrorLocation error_location = LocationOf(node);
 
       std::string message = mc_fmt::format(
           "{} error: Mutually exclusive option of 'Ea' and 'C' found in '{}' reaction.",
@@ -76,14 +77,18 @@ namespace mechanism_configuration::v1
   ///        optional metadata (name, comments), and constructs a `types::Arrhenius` object.
   /// @param object The YAML node representing the reaction
   /// @param reactions The reactions container to append the parsed reaction to
-  void ArrheniusParser::Parse(const YAML::Node& object, types::Reactions& reactions)
+  /// @param unknown_properties Table to store the reaction's comments in, or nullptr to skip them
+  void ArrheniusParser::Parse(
+      const MapView& object,
+      types::Reactions& reactions,
+      types::UnknownProperties* unknown_properties) const
   {
     types::Arrhenius arrhenius;
 
     arrhenius.gas_phase = object[keys::gas_phase].as<std::string>();
-    arrhenius.reactants = ParseReactionComponents(object, keys::reactants);
-    arrhenius.products = ParseReactionComponents(object, keys::products);
-    arrhenius.unknown_properties = GetComments(object);
+    arrhenius.reactants = ParseReactionComponents(object, keys::reactants, unknown_properties);
+    arrhenius.products = ParseReactionComponents(object, keys::products, unknown_properties);
+    arrhenius.unknown_properties_id = GetComments(object, unknown_properties);
 
     if (object[keys::A])
     {
@@ -23,18 +23,17 @@ namespace mechanism_configuration::v1
   /// @param existing_phases Unused; semantic checks live in ValidateReactionsSemantics
   /// @return A list of validation errors, if any
   Errors BranchedParser::CheckSchema(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+      const std::vector<types::Phase>& existing_phases) const
   {
-    std::vector<std::string_view> required_keys = {
-      keys::type, keys::gas_phase, keys::reactants, keys::alkoxy_products, keys::nitrate_products
-    };
-    std::vector<std::string_view> optional_keys = { keys::name, keys::X, keys::Y, keys::a0, keys::n };
+    static const Schema schema(
+        { keys::type, keys::gas_phase, keys::reactants, keys::alkoxy_products, keys::nitrate_products },
+        { keys::name, keys::X, keys::Y, keys::a0, keys::n });
 
     Errors errors;
 
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -67,15 +66,18 @@ namespace mechanism_configuration::v1
     return errors;
   }
 
-  void BranchedParser::Parse(const YAML::Node& object, types::Reactions& reactions)
+  void BranchedParser::Parse(
+      const MapView& object,
+      types::Reactions& reactions,
+      types::UnknownProperties* unknown_properties) const
   {
     types::Branched branched;
 
     branched.gas_phase = object[keys::gas_phase].as<std::string>();
-    branched.reactants = ParseReactionComponents(object, keys::reactants);
-    branched.alkoxy_products = ParseReactionComponents(object, keys::alkoxy_products);
-    branched.nitrate_products = ParseReactionComponents(object, keys::nitrate_products);
-    branched.unknown_properties = GetComments(object);
+    branched.reactants = ParseReactionComponents(object, keys::reactants, unknown_properties);
+    branched.alkoxy_products = ParseReactionComponents(object, keys::alkoxy_products, unknown_properties);
+    branched.nitrate_products = ParseReactionComponents(object, keys::nitrate_products, unknown_properties);
+    branched.unknown_properties_id = GetComments(object, unknown_properties);
 
     if (object[keys::X])
     {
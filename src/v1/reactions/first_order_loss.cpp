@@ -23,16 +23,17 @@ namespace mechanism_configuration::v1
   /// @param existing_phases Unused; semantic checks live in ValidateReactionsSemantics
   /// @return A list of validation errors, if any
   Errors FirstOrderLossParser::CheckSchema(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+      const std::vector<types::Phase>& existing_phases) const
   {
-    std::vector<std::string_view> required_keys = { keys::reactants, keys::type, keys::gas_phase };
-    std::vector<std::string_view> optional_keys = { keys::name, keys::scaling_factor, keys::products };
+    static const Schema schema(
+        { keys::reactants, keys::type, keys::gas_phase },
+        { keys::name, keys::scaling_factor, keys::products });
 
     Errors errors;
 
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -61,7 +62,7 @@ namespace mechanism_configuration::v1
     if (species_node_pairs.size() > 1)
     {
       const auto& node = object[keys::reactants];
-      ErrorLocation error_location{ node.Mark().line, node.Mark().column };
+      ErrorLocation error_location = LocationOf(node);
 
       std::string message = mc_fmt::format(
           "{} error: '{}' reaction requires one reactant, but {} were provided.",
@@ -77,17 +78,20 @@ namespace mechanism_configuration::v1
     return errors;
   }
 
-  void FirstOrderLossParser::Parse(const YAML::Node& object, types::Reactions& reactions)
+  void FirstOrderLossParser::Parse(
+      const MapView& object,
+      types::Reactions& reactions,
+      types::UnknownProperties* unknown_properties) const
   {
     types::FirstOrderLoss first_order_loss;
 
     first_order_loss.gas_phase = object[keys::gas_phase].as<std::string>();
-    first_order_loss.reactants = ParseReactionComponent(object, keys::reactants);
+    first_order_loss.reactants = ParseReactionComponent(object, keys::reactants, unknown_properties);
     if (object[keys::products])
     {
-      first_order_loss.products = ParseReactionComponents(object, keys::products);
+      first_order_loss.products = ParseReactionComponents(object, keys::products, unknown_properties);
     }
-    first_order_loss.unknown_properties = GetComments(object);
+    first_order_loss.unknown_properties_id = GetComments(object, unknown_properties);
 
     if (object[keys::scaling_factor])
     {
@@ -23,17 +23,16 @@ namespace mechanism_configuration::v1
   /// @param existing_phases Unused; semantic checks live in ValidateReactionsSemantics
   /// @return A list of validation errors, if any
   Errors LambdaRateConstantParser::CheckSchema(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+      const std::vector<types::Phase>& existing_phases) const
   {
-    std::vector<std::string_view> required_keys = {
-      keys::reactants, keys::products, keys::type, keys::gas_phase, keys::lambda_function
-    };
-    std::vector<std::string_view> optional_keys = { keys::name };
+    static const Schema schema(
+        { keys::reactants, keys::products, keys::type, keys::gas_phase, keys::lambda_function },
+        { keys::name });
     Errors errors;
 
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -54,20 +53,27 @@ namespace mechanism_configuration::v1
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
     }
 
+    // Lambda function: must compile, so errors surface here rather than when rates are evaluated
+    schema_errors = CheckExpression(object[keys::lambda_function], "lambda function");
+    errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
+
     // Semantic checks are performed by the version-neutral ValidateReactionsSemantics.
 
     return errors;
   }
 
-  void LambdaRateConstantParser::Parse(const YAML::Node& object, types::Reactions& reactions)
+  void LambdaRateConstantParser::Parse(
+      const MapView& object,
+      types::Reactions& reactions,
+      types::UnknownProperties* unknown_properties) const
   {
     types::LambdaRateConstant lambda_rate_constant;
 
-    lambda_rate_constant.reactants = ParseReactionComponents(object, keys::reactants);
-    lambda_rate_constant.products = ParseReactionComponents(object, keys::products);
+    lambda_rate_constant.reactants = ParseReactionComponents(object, keys::reactants, unknown_properties);
+    lambda_rate_constant.products = ParseReactionComponents(object, keys::products, unknown_properties);
     lambda_rate_constant.gas_phase = object[keys::gas_phase].as<std::string>();
     lambda_rate_constant.lambda_function = object[keys::lambda_function].as<std::string>();
-    lambda_rate_constant.unknown_properties = GetComments(object);
+    lambda_rate_constant.unknown_properties_id = GetComments(object, unknown_properties);
 
     if (object[keys::name])
     {
@@ -11,19 +11,22 @@
 
 namespace mechanism_configuration::v1
 {
-  std::vector<types::ReactionComponent> ParseReactionComponents(const YAML::Node& object, std::string_view key)
+  std::vector<types::ReactionComponent> ParseReactionComponents(
+      const MapView& object,
+      std::string_view key,
+      types::UnknownProperties* unknown_properties)
   {
     std::vector<types::ReactionComponent> component_list;
-    for (const auto& elem : AsSequence(object[key]))
+    for (const MapView elem : AsSequence(object[key]))
     {
       types::ReactionComponent component;
       component.name = GetComponentName(elem);
 
       // A bare-string component carries only its name; coefficients/comments
       // are only present on the object form.
-      if (!elem.IsScalar())
+      if (!elem.node().IsScalar())
       {
-        component.unknown_properties = GetComments(elem);
+        component.unknown_properties_id = GetComments(elem, unknown_properties);
         if (elem[keys::coefficient])
         {
           component.coefficient = elem[keys::coefficient].as<double>();
@@ -36,9 +39,10 @@ namespace mechanism_configuration::v1
     return component_list;
   };
 
-  types::ReactionComponent ParseReactionComponent(const YAML::Node& object, std::string_view key)
+  types::ReactionComponent
+  ParseReactionComponent(const MapView& object, std::string_view key, types::UnknownProperties* unknown_properties)
   {
-    auto reaction_components = ParseReactionComponents(object, key);
+    auto reaction_components = ParseReactionComponents(object, key, unknown_properties);
 
     if (reaction_components.empty())
     {
@@ -48,17 +52,17 @@ namespace mechanism_configuration::v1
     return std::move(reaction_components.front());
   };
 
-  types::Reactions ParseReactions(const YAML::Node& objects)
+  types::Reactions ParseReactions(const YAML::Node& objects, types::UnknownProperties* unknown_properties)
   {
-    auto& parsers = GetReactionParserMap();
+    const auto& parsers = GetReactionParserMap();
     types::Reactions reactions;
 
-    for (const auto& object : objects)
+    for (const MapView object : objects)
     {
       auto it = parsers.find(object[keys::type].as<std::string>());
       if (it != parsers.end())
       {
-        it->second->Parse(object, reactions);
+        it->second->Parse(object, reactions, unknown_properties);
       }
     }
 
@@ -23,16 +23,17 @@ namespace mechanism_configuration::v1
   /// @param existing_phases Unused; semantic checks live in ValidateReactionsSemantics
   /// @return A list of validation errors, if any
   Errors PhotolysisParser::CheckSchema(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+      const std::vector<types::Phase>& existing_phases) const
   {
-    std::vector<std::string_view> required_keys = { keys::reactants, keys::products, keys::type, keys::gas_phase };
-    std::vector<std::string_view> optional_keys = { keys::name, keys::scaling_factor };
+    static const Schema schema(
+        { keys::reactants, keys::products, keys::type, keys::gas_phase },
+        { keys::name, keys::scaling_factor });
 
     Errors errors;
 
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -71,7 +72,7 @@ namespace mechanism_configuration::v1
     if (species_node_pairs.size() > 1)
     {
       const auto& node = object[keys::reactants];
-      ErrorLocation error_location{ node.Mark().line, node.Mark().column };
+      ErrorLocation error_location = LocationOf(node);
 
       std::string message = mc_fmt::format(
           "{} error: '{}' reaction requires one reactant, but {} were provided.",
@@ -87,14 +88,17 @@ namespace mechanism_configuration::v1
     return errors;
   }
 
-  void PhotolysisParser::Parse(const YAML::Node& object, types::Reactions& reactions)
+  void PhotolysisParser::Parse(
+      const MapView& object,
+      types::Reactions& reactions,
+      types::UnknownProperties* unknown_properties) const
   {
     types::Photolysis photolysis;
 
     photolysis.gas_phase = object[keys::gas_phase].as<std::string>();
-    photolysis.reactants = ParseReactionComponent(object, keys::reactants);
-    photolysis.products = ParseReactionComponents(object, keys::products);
-    photolysis.unknown_properties = GetComments(object);
+    photolysis.reactants = ParseReactionComponent(object, keys::reactants, unknown_properties);
+    photolysis.products = ParseReactionComponents(object, keys::products, unknown_properties);
+    photolysis.unknown_properties_id = GetComments(object, unknown_properties);
 
     if (object[keys::scaling_factor])
     {
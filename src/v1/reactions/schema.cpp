@@ -19,17 +19,15 @@ namespace mechanism_configuration::v1
 {
   Errors CheckReactantsOrProductsSchema(const YAML::Node& list)
   {
-    const std::vector<std::string_view> required_keys = {};
-    const std::vector<std::string_view> optional_keys = { keys::coefficient };
     // A component's species reference may use the canonical `name` or the legacy
     // `species name` alias, but exactly one of them.
-    const std::vector<std::vector<std::string_view>> exactly_one_of = { { keys::name, keys::species_name } };
+    static const Schema schema({}, { keys::coefficient }, { { keys::name, keys::species_name } });
 
     Errors errors;
 
     for (const auto& object : list)
     {
-      auto schema_errors = CheckSchema(object, required_keys, optional_keys, exactly_one_of);
+      auto schema_errors = schema.Check(object);
       if (!schema_errors.empty())
       {
         errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -39,42 +37,47 @@ namespace mechanism_configuration::v1
     return errors;
   }
 
-  Errors CheckReactionsSchema(
-      const YAML::Node& reactions_list,
-      const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+  const IReactionParser* FindReactionParser(const MapView& object, Errors& errors)
   {
-    Errors errors;
-
-    auto& parsers = GetReactionParserMap();
+    if (!object[keys::type])
+    {
+      ErrorLocation error_location = LocationOf(object);
+      std::string message = mc_fmt::format("{} error: Missing 'type' object in reaction.", error_location);
+      errors.push_back({ ErrorCode::RequiredKeyNotFound, message });
+      return nullptr;
+    }
 
-    std::vector<std::pair<YAML::Node, IReactionParser*>> valid_reactions;
+    std::string type = object[keys::type].as<std::string>();
 
-    for (const auto& object : reactions_list)
+    const auto& parsers = GetReactionParserMap();
+    auto it = parsers.find(type);
+    if (it == parsers.end())
     {
-      if (!object[keys::type])
-      {
-        ErrorLocation error_location{ object.Mark().line, object.Mark().column };
-        std::string message = mc_fmt::format("{} error: Missing 'type' object in reaction.", error_location);
-        errors.push_back({ ErrorCode::RequiredKeyNotFound, message });
-        continue;
-      }
+      const auto& node = object[keys::type];
+      ErrorLocation error_location = LocationOf(node);
 
-      std::string type = object[keys::type].as<std::string>();
+      std::string message = mc_fmt::format("{} error: Unknown reaction type '{}' found.", error_location, type);
 
-      auto it = parsers.find(type);
-      if (it == parsers.end())
-      {
-        const auto& node = object[keys::type];
-        ErrorLocation error_location{ node.Mark().line, node.Mark().column };
+      errors.push_back({ ErrorCode::UnknownType, message });
 
-        std::string message = mc_fmt::format("{} error: Unknown reaction type '{}' found.", error_location, type);
+      return nullptr;
+    }
+    return it->second.get();
+  }
 
-        errors.push_back({ ErrorCode::UnknownType, message });
+  Errors CheckReactionsSchema(
+      const YAML::Node& reactions_list,
+      const std::vector<types::Species>& existing_species,
+      const std::vector<types::Phase>& existing_phases)
+  {
+    Errors errors;
 
-        continue;
-      }
-      valid_reactions.emplace_back(object, it->second.get());
+    std::vector<std::pair<MapView, const IReactionParser*>> valid_reactions;
+
+    for (const MapView object : reactions_list)
+    {
+      if (const IReactionParser* parser = FindReactionParser(object, errors))
+        valid_reactions.emplace_back(object, parser);
     }
 
     if (!errors.empty())
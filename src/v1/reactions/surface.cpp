@@ -23,18 +23,17 @@ namespace mechanism_configuration::v1
   /// @param existing_phases Unused; semantic checks live in ValidateReactionsSemantics
   /// @return A list of validation errors, if any
   Errors SurfaceParser::CheckSchema(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+      const std::vector<types::Phase>& existing_phases) const
   {
-    std::vector<std::string_view> required_keys = {
-      keys::gas_phase_products, keys::gas_phase_species, keys::type, keys::gas_phase
-    };
-    std::vector<std::string_view> optional_keys = { keys::name, keys::reaction_probability, keys::condensed_phase };
+    static const Schema schema(
+        { keys::gas_phase_products, keys::gas_phase_species, keys::type, keys::gas_phase },
+        { keys::name, keys::reaction_probability, keys::condensed_phase });
 
     Errors errors;
 
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -73,7 +72,7 @@ namespace mechanism_configuration::v1
     if (reactant_node_pairs.size() > 1)
     {
       const auto& node = object[keys::gas_phase_species];
-      ErrorLocation error_location{ node.Mark().line, node.Mark().column };
+      ErrorLocation error_location = LocationOf(node);
 
       std::string message = mc_fmt::format(
           "{} error: '{}' reaction requires one reactant, but {} were provided.",
@@ -88,7 +87,10 @@ namespace mechanism_configuration::v1
     // version-neutral ValidateReactionsSemantics over the canonical Mechanism.
     return errors;
   }
-  void SurfaceParser::Parse(const YAML::Node& object, types::Reactions& reactions)
+  void SurfaceParser::Parse(
+      const MapView& object,
+      types::Reactions& reactions,
+      types::UnknownProperties* unknown_properties) const
   {
     types::Surface surface;
 
@@ -97,9 +99,9 @@ namespace mechanism_configuration::v1
     {
       surface.condensed_phase = object[keys::condensed_phase].as<std::string>();
     }
-    surface.gas_phase_species = ParseReactionComponent(object, keys::gas_phase_species);
-    surface.gas_phase_products = ParseReactionComponents(object, keys::gas_phase_products);
-    surface.unknown_properties = GetComments(object);
+    surface.gas_phase_species = ParseReactionComponent(object, keys::gas_phase_species, unknown_properties);
+    surface.gas_phase_products = ParseReactionComponents(object, keys::gas_phase_products, unknown_properties);
+    surface.unknown_properties_id = GetComments(object, unknown_properties);
 
     if (object[keys::reaction_probability])
     {
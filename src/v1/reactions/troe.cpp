@@ -22,16 +22,16 @@ namespace mechanism_configuration::v1
   /// @param existing_phases Unused; semantic checks live in ValidateReactionsSemantics
   /// @return A list of validation errors, if any
   Errors TroeParser::CheckSchema(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+      const std::vector<types::Phase>& existing_phases) const
   {
-    std::vector<std::string_view> required_keys = { keys::reactants, keys::products, keys::type, keys::gas_phase };
-    std::vector<std::string_view> optional_keys = { keys::name,   keys::k0_A,   keys::k0_B, keys::k0_C, keys::kinf_A,
-                                                    keys::kinf_B, keys::kinf_C, keys::Fc,   keys::N };
+    static const Schema schema(
+        { keys::reactants, keys::products, keys::type, keys::gas_phase },
+        { keys::name, keys::k0_A, keys::k0_B, keys::k0_C, keys::kinf_A, keys::kinf_B, keys::kinf_C, keys::Fc, keys::N });
     Errors errors;
 
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -57,14 +57,17 @@ namespace mechanism_configuration::v1
     return errors;
   }
 
-  void TroeParser::Parse(const YAML::Node& object, types::Reactions& reactions)
+  void TroeParser::Parse(
+      const MapView& object,
+      types::Reactions& reactions,
+      types::UnknownProperties* unknown_properties) const
   {
     types::Troe troe;
 
     troe.gas_phase = object[keys::gas_phase].as<std::string>();
-    troe.reactants = ParseReactionComponents(object, keys::reactants);
-    troe.products = ParseReactionComponents(object, keys::products);
-    troe.unknown_properties = GetComments(object);
+    troe.reactants = ParseReactionComponents(object, keys::reactants, unknown_properties);
+    troe.products = ParseReactionComponents(object, keys::products, unknown_properties);
+    troe.unknown_properties_id = GetComments(object, unknown_properties);
 
     if (object[keys::k0_A])
     {
@@ -22,16 +22,17 @@ namespace mechanism_configuration::v1
   /// @param existing_phases Unused; semantic checks live in ValidateReactionsSemantics
   /// @return A list of validation errors, if any
   Errors TunnelingParser::CheckSchema(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+      const std::vector<types::Phase>& existing_phases) const
   {
-    std::vector<std::string_view> required_keys = { keys::reactants, keys::products, keys::type, keys::gas_phase };
-    std::vector<std::string_view> optional_keys = { keys::name, keys::A, keys::B, keys::C };
+    static const Schema schema(
+        { keys::reactants, keys::products, keys::type, keys::gas_phase },
+        { keys::name, keys::A, keys::B, keys::C });
 
     Errors errors;
 
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -57,14 +58,17 @@ namespace mechanism_configuration::v1
     return errors;
   }
 
-  void TunnelingParser::Parse(const YAML::Node& object, types::Reactions& reactions)
+  void TunnelingParser::Parse(
+      const MapView& object,
+      types::Reactions& reactions,
+      types::UnknownProperties* unknown_properties) const
   {
     types::Tunneling tunneling;
 
     tunneling.gas_phase = object[keys::gas_phase].as<std::string>();
-    tunneling.reactants = ParseReactionComponents(object, keys::reactants);
-    tunneling.products = ParseReactionComponents(object, keys::products);
-    tunneling.unknown_properties = GetComments(object);
+    tunneling.reactants = ParseReactionComponents(object, keys::reactants, unknown_properties);
+    tunneling.products = ParseReactionComponents(object, keys::products, unknown_properties);
+    tunneling.unknown_properties_id = GetComments(object, unknown_properties);
 
     if (object[keys::A])
     {
@@ -23,16 +23,17 @@ namespace mechanism_configuration::v1
   /// @param existing_phases Unused; semantic checks live in ValidateReactionsSemantics
   /// @return A list of validation errors, if any
   Errors UserDefinedParser::CheckSchema(
-      const YAML::Node& object,
+      const MapView& object,
       const std::vector<types::Species>& existing_species,
-      const std::vector<types::Phase>& existing_phases)
+      const std::vector<types::Phase>& existing_phases) const
   {
-    std::vector<std::string_view> required_keys = { keys::reactants, keys::products, keys::type, keys::gas_phase };
-    std::vector<std::string_view> optional_keys = { keys::name, keys::scaling_factor };
+    static const Schema schema(
+        { keys::reactants, keys::products, keys::type, keys::gas_phase },
+        { keys::name, keys::scaling_factor });
 
     Errors errors;
 
-    auto schema_errors = mechanism_configuration::CheckSchema(object, required_keys, optional_keys);
+    auto schema_errors = schema.Check(object);
     if (!schema_errors.empty())
     {
       errors.insert(errors.end(), schema_errors.begin(), schema_errors.end());
@@ -58,14 +59,17 @@ namespace mechanism_configuration::v1
     return errors;
   }
 
-  void UserDefinedParser::Parse(const YAML::Node& object, types::Reactions& reactions)
+  void UserDefinedParser::Parse(
+      const MapView& object,
+      types::Reactions& reactions,
+      types::UnknownProperties* unknown_properties) const
   {
     types::UserDefined user_defined;
 
-    user_defined.reactants = ParseReactionComponents(object, keys::reactants);
-    user_defined.products = ParseReactionComponents(object, keys::products);
+    user_defined.reactants = ParseReactionComponents(object, keys::reactants, unknown_properties);
+    user_defined.products = ParseReactionComponents(object, keys::products, unknown_properties);
     user_defined.gas_phase = object[keys::gas_phase].as<std::string>();
-    user_defined.unknown_properties = GetComments(object);
+    user_defined.unknown_properties_id = GetComments(object, unknown_properties);
 
     if (object[keys::scaling_factor])
     {
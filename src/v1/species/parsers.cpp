@@ -4,6 +4,7 @@
 
 #include "detail/v1/species/parsers.hpp"
 
+#include "detail/map_view.hpp"
 #include "detail/v1/keys.hpp"
 #include "detail/v1/species/keys.hpp"
 #include "detail/v1/utils.hpp"
@@ -12,10 +13,10 @@
 
 namespace mechanism_configuration::v1
 {
-  std::vector<types::Species> ParseSpecies(const YAML::Node& objects)
+  std::vector<types::Species> ParseSpecies(const YAML::Node& objects, types::UnknownProperties* unknown_properties)
   {
     std::vector<types::Species> all_species;
-    for (const auto& object : objects)
+    for (const MapView object : objects)
     {
       types::Species species;
 
@@ -44,31 +45,31 @@ namespace mechanism_configuration::v1
       if (object[keys::is_third_body])
         species.is_third_body = object[keys::is_third_body].as<bool>();
 
-      species.unknown_properties = GetComments(object);
+      species.unknown_properties_id = GetComments(object, unknown_properties);
 
       all_species.push_back(species);
     }
     return all_species;
   }
 
-  std::vector<types::Phase> ParsePhases(const YAML::Node& objects)
+  std::vector<types::Phase> ParsePhases(const YAML::Node& objects, types::UnknownProperties* unknown_properties)
   {
     std::vector<types::Phase> all_phases;
-    for (const auto& object : objects)
+    for (const MapView object : objects)
     {
       types::Phase phase;
       phase.name = object[keys::name].as<std::string>();
 
       std::vector<types::PhaseSpecies> species;
 
-      for (const auto& spec : object[keys::species])
+      for (const MapView spec : object[keys::species])
       {
         types::PhaseSpecies phase_species;
 
-        if (spec.IsScalar())
+        if (spec.node().IsScalar())
         {
           // Shorthand: a bare string is the species name.
-          phase_species.name = spec.as<std::string>();
+          phase_species.name = spec.node().as<std::string>();
         }
         else
         {
@@ -82,14 +83,14 @@ namespace mechanism_configuration::v1
           {
             phase_species.density = spec[keys::density].as<double>();
           }
-          phase_species.unknown_properties = GetComments(spec);
+          phase_species.unknown_properties_id = GetComments(spec, unknown_properties);
         }
 
         species.emplace_back(phase_species);
       }
 
       phase.species = species;
-      phase.unknown_properties = GetComments(object);
+      phase.unknown_properties_id = GetComments(object, unknown_properties);
       all_phases.emplace_back(phase);
     }
 
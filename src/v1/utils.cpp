@@ -15,22 +15,19 @@
 
 namespace mechanism_configuration::v1
 {
-  YAML::Node AsSequence(const YAML::Node& node)
+  std::vector<YAML::Node> AsSequence(const YAML::Node& node)
   {
-    if (node.IsSequence())
-      return node;
+    if (!node.IsSequence())
+      return { node };
 
-    YAML::Node sequence;
-    sequence.push_back(node);
+    std::vector<YAML::Node> sequence;
+    sequence.reserve(node.size());
+    for (const auto& element : node)
+      sequence.push_back(element);
 
     return sequence;
   }
 
-  ErrorLocation LocationOf(const YAML::Node& node)
-  {
-    return ErrorLocation{ node.Mark().line, node.Mark().column };
-  }
-
   std::string GetComponentName(const YAML::Node& component)
   {
     // A component may be given as a bare string (shorthand for its name),
@@ -50,34 +47,40 @@ namespace mechanism_configuration::v1
     }
   }
 
-  std::unordered_map<std::string, std::string> GetComments(const YAML::Node& object)
+  types::PropertiesId GetComments(const YAML::Node& object, types::UnknownProperties* unknown_properties)
   {
-    std::unordered_map<std::string, std::string> unknown_properties;
-    const std::string comment_start = "__";
+    if (!unknown_properties)
+    {
+      return types::NO_PROPERTIES;
+    }
+
+    std::vector<types::UnknownProperty> comments;
+    constexpr std::string_view comment_start = "__";
 
     for (const auto& key : object)
     {
-      std::string key_str = key.first.as<std::string>();
+      // Only the comments are copied out of the document
+      const std::string& key_str = key.first.Scalar();
 
       // Check if the key starts with the comment prefix
-      if (key_str.compare(0, comment_start.size(), comment_start) == 0)
+      if (key_str.starts_with(comment_start))
       {
         // Check if the value is a YAML node
         if (key.second.IsScalar())
         {
-          unknown_properties[key_str] = key.second.as<std::string>();
+          comments.push_back({ key_str, key.second.as<std::string>() });
         }
         else
         {
           std::stringstream ss;
           ss << key.second;
-          unknown_properties[key_str] = ss.str();
+          comments.push_back({ key_str, ss.str() });
         }
       }
     }
 
-    // Return the map of extracted comments
-    return unknown_properties;
+    // Store the extracted comments in the mechanism's side table
+    return unknown_properties->Add(std::move(comments));
   }
 
 }  // namespace mechanism_configuration::v1
@@ -0,0 +1,131 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/v1/parser.hpp"
+#include "utils/files.hpp"
+
+#include <mechanism_configuration/compiled.hpp>
+#include <mechanism_configuration/parse.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  // Valid v0 and v1 configurations (including v1 split across files) and ones that fail to parse,
+  // so that both mechanisms and errors are compared.
+  const std::vector<std::filesystem::path> CONFIGS = {
+    "examples/v0/config.yaml",
+    "examples/v0/config.json",
+    "examples/v1/full_configuration.yaml",
+    "examples/v1/full_configuration.json",
+    "examples/v1/config/yaml/main.yaml",
+    "examples/v1/config/json/main.json",
+    "integration_configs/invalid_version.yaml",
+    "examples/_missing_configuration.yaml",
+  };
+
+  // More threads than most machines have cores, so that parses overlap even on small ones
+  constexpr std::size_t THREADS = 8;
+  constexpr std::size_t PARSES_PER_THREAD = 12;
+
+  // The whole of a parse result as text: the compiled image of a mechanism, or its errors.
+  std::string Describe(const std::expected<Mechanism, Errors>& parsed)
+  {
+    std::string description;
+    if (!parsed)
+    {
+      for (const auto& [code, message] : parsed.error())
+        description += ErrorCodeToString(code) + std::string(": ") + message + "\n";
+      return description;
+    }
+    const auto image = std::filesystem::temp_directory_path() / "mc_concurrent_parse.mcc";
+    EXPECT_TRUE(SaveCompiled(*parsed, image).empty());
+    return ReadBytes(image);
+  }
+
+  // Runs `body(thread, parse)` for PARSES_PER_THREAD parses on each of THREADS threads, released
+  // together so that their parses overlap.
+  template<typename Body>
+  void RunConcurrently(Body body)
+  {
+    std::atomic<bool> start{ false };
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < THREADS; ++t)
+      threads.emplace_back(
+          [&, t]
+          {
+            while (!start.load())
+              std::this_thread::yield();
+            for (std::size_t p = 0; p < PARSES_PER_THREAD; ++p)
+              body(t, p);
+          });
+    start = true;
+    for (auto& thread : threads)
+      thread.join();
+  }
+}  // namespace
+
+TEST(ConcurrentParse, ParseMatchesSequentialParse)
+{
+  const ParseOptions streamed{ .stream_reactions = true, .parallel_file_loading = true };
+  for (const ParseOptions& options : { ParseOptions{}, streamed })
+  {
+    std::vector<std::string> expected;
+    for (const auto& config : CONFIGS)
+      expected.push_back(Describe(Parse(config, options)));
+
+    std::vector<std::expected<Mechanism, Errors>> results(THREADS * PARSES_PER_THREAD);
+    RunConcurrently([&](std::size_t t, std::size_t p)
+                    { results[t * PARSES_PER_THREAD + p] = Parse(CONFIGS[(t + p) % CONFIGS.size()], options); });
+
+    for (std::size_t t = 0; t < THREADS; ++t)
+      for (std::size_t p = 0; p < PARSES_PER_THREAD; ++p)
+        EXPECT_EQ(Describe(results[t * PARSES_PER_THREAD + p]), expected[(t + p) % CONFIGS.size()])
+            << CONFIGS[(t + p) % CONFIGS.size()];
+  }
+}
+
+TEST(ConcurrentParse, SharedParserIsReentrant)
+{
+  // Unknown properties are collected per parse, so a parse must not see another's.
+  const std::string content = ReadBytes("examples/v1/full_configuration.yaml");
+  const v1::Parser parser;
+  const std::string expected = Describe(parser.Parse(content));
+  ASSERT_FALSE(expected.empty());
+
+  std::vector<std::expected<Mechanism, Errors>> results(THREADS * PARSES_PER_THREAD);
+  RunConcurrently(
+      [&](std::size_t t, std::size_t p)
+      {
+        auto& result = results[t * PARSES_PER_THREAD + p];
+        result = p % 2 == 0 ? parser.Parse(content) : parser.ParseStreaming(content);
+      });
+
+  for (const auto& result : results)
+    EXPECT_EQ(Describe(result), expected);
+}
+
+TEST(ConcurrentParse, ParseManyReturnsResultsInOrder)
+{
+  std::vector<std::filesystem::path> paths;
+  for (std::size_t copy = 0; copy < 4; ++copy)
+    paths.insert(paths.end(), CONFIGS.begin(), CONFIGS.end());
+
+  const auto results = ParseMany(paths);
+  ASSERT_EQ(results.size(), paths.size());
+  for (std::size_t i = 0; i < paths.size(); ++i)
+    EXPECT_EQ(Describe(results[i]), Describe(Parse(paths[i]))) << paths[i];
+
+  EXPECT_TRUE(ParseMany({}).empty());
+}
@@ -7,7 +7,10 @@
 
 #include <gtest/gtest.h>
 
+#include <mechanism_configuration/parse.hpp>
+
 #include <filesystem>
+#include <fstream>
 #include <string>
 
 using namespace mechanism_configuration;
@@ -67,3 +70,107 @@ TEST(V0Parser, ReportsMissingFile)
     EXPECT_EQ(parsed.error()[0].first, ErrorCode::FileNotFound);
   }
 }
+
+namespace
+{
+  // Parsing the CAMP files in parallel must give the same mechanism, and the same errors in the
+  // same order, as parsing them one after another.
+  void ExpectParallelParsingMatchesSerial(const std::filesystem::path& path)
+  {
+    SCOPED_TRACE(path.string());
+    auto serial = v0::Parser{}.Parse(path);
+    auto parallel = v0::Parser{ ParseOptions{ .parallel_file_loading = true } }.Parse(path);
+
+    ASSERT_EQ(serial.has_value(), parallel.has_value());
+    if (!serial)
+    {
+      EXPECT_EQ(parallel.error(), serial.error());
+      return;
+    }
+    EXPECT_EQ(parallel->name, serial->name);
+    EXPECT_EQ(parallel->relative_tolerance, serial->relative_tolerance);
+    ASSERT_EQ(parallel->species.size(), serial->species.size());
+    for (std::size_t i = 0; i < serial->species.size(); ++i)
+      EXPECT_EQ(parallel->species[i].name, serial->species[i].name);
+    ASSERT_EQ(parallel->phases.size(), serial->phases.size());
+    EXPECT_EQ(parallel->phases[0].species.size(), serial->phases[0].species.size());
+    ASSERT_EQ(parallel->reactions.arrhenius.size(), serial->reactions.arrhenius.size());
+    for (std::size_t i = 0; i < serial->reactions.arrhenius.size(); ++i)
+      EXPECT_EQ(parallel->reactions.arrhenius[i].A, serial->reactions.arrhenius[i].A);
+    EXPECT_EQ(parallel->reactions.troe.size(), serial->reactions.troe.size());
+    EXPECT_EQ(parallel->reactions.branched.size(), serial->reactions.branched.size());
+    EXPECT_EQ(parallel->reactions.tunneling.size(), serial->reactions.tunneling.size());
+    EXPECT_EQ(parallel->reactions.surface.size(), serial->reactions.surface.size());
+  }
+
+  // A CAMP configuration of `n_files` files, each adding a species, an ARRHENIUS reaction and
+  // a mechanism name; every fourth file also sets the relative tolerance.
+  std::filesystem::path WriteCampFiles(const std::filesystem::path& dir, int n_files, bool with_bad_files)
+  {
+    std::filesystem::create_directories(dir);
+    std::string files;
+    for (int i = 0; i < n_files; ++i)
+    {
+      const std::string name = "camp_" + std::to_string(i) + ".json";
+      files += std::string(i ? ", " : "") + "\"" + name + "\"";
+      if (with_bad_files && i % 11 == 3)
+        continue;  // missing
+      std::ofstream file(dir / name);
+      if (with_bad_files && i % 7 == 5)
+      {
+        file << "{ \"camp-data\": [ { \"type\": \"NOT_A_TYPE\" } ] }";
+        continue;
+      }
+      if (with_bad_files && i % 9 == 8)
+      {
+        file << "{ \"camp-data\": [ { \"name\": \"X\" ";  // malformed
+        continue;
+      }
+      const std::string species = "S" + std::to_string(i);
+      file << "{ \"camp-data\": [ { \"name\": \"" << species << "\", \"type\": \"CHEM_SPEC\" }";
+      if (i % 4 == 0)
+        file << ", { \"type\": \"RELATIVE_TOLERANCE\", \"value\": 1.0e-" << (i % 10 + 1) << " }";
+      file << ", { \"name\": \"mechanism " << i << "\", \"type\": \"MECHANISM\", \"reactions\": [ "
+           << "{ \"type\": \"ARRHENIUS\", \"A\": " << i + 1 << ", \"reactants\": { \"" << species
+           << "\": {} }, \"products\": { \"" << species << "\": {} } } ] } ] }";
+    }
+    std::ofstream(dir / "config.json") << "{ \"camp-files\": [ " << files << " ] }";
+    return dir / "config.json";
+  }
+}  // namespace
+
+TEST(V0Parser, ParallelParsingMatchesSerial)
+{
+  ExpectParallelParsingMatchesSerial("examples/v0/config.json");
+  ExpectParallelParsingMatchesSerial("examples/v0/config.yaml");
+
+  const std::filesystem::path dir = std::filesystem::temp_directory_path() / "mc_v0_parallel_parsing";
+  std::filesystem::remove_all(dir);
+  auto valid = WriteCampFiles(dir / "valid", 40, false);
+  ExpectParallelParsingMatchesSerial(valid);
+
+  auto parsed = v0::Parser{ ParseOptions{ .parallel_file_loading = true } }.Parse(valid);
+  ASSERT_TRUE(parsed);
+  EXPECT_EQ(parsed->name, "mechanism 39");
+  EXPECT_EQ(parsed->relative_tolerance, 1.0e-7);  // set last by camp_36.json
+  ASSERT_EQ(parsed->reactions.arrhenius.size(), 40);
+  for (std::size_t i = 0; i < 40; ++i)
+    EXPECT_EQ(parsed->reactions.arrhenius[i].A, static_cast<double>(i + 1));
+
+  // Missing files are reported before any file is parsed; with the missing files removed from
+  // the list, the unknown-type and malformed files are reported in file order.
+  ExpectParallelParsingMatchesSerial(WriteCampFiles(dir / "missing", 40, true));
+  for (int i = 3; i < 40; i += 11)
+    std::ofstream(dir / "missing" / ("camp_" + std::to_string(i) + ".json"))
+        << "{ \"camp-data\": [ { \"name\": \"M" << i << "\", \"type\": \"CHEM_SPEC\" } ] }";
+  const std::filesystem::path invalid = dir / "missing" / "config.json";
+  ExpectParallelParsingMatchesSerial(invalid);
+
+  parsed = v0::Parser{ ParseOptions{ .parallel_file_loading = true } }.Parse(invalid);
+  ASSERT_FALSE(parsed);
+  ASSERT_GE(parsed.error().size(), 2);
+  EXPECT_NE(parsed.error()[0].second.find("camp_5.json"), std::string::npos);
+  EXPECT_NE(parsed.error()[1].second.find("camp_8.json"), std::string::npos);
+
+  std::filesystem::remove_all(dir);
+}
@@ -10,8 +10,10 @@
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
 
+#include <filesystem>
 #include <iostream>
 #include <string>
+#include <vector>
 
 using namespace mechanism_configuration;
 
@@ -23,6 +25,68 @@ namespace
     return v1::Parser{}.Parse(content);
   }
 
+  // Names of every reaction of each type, in order, so two parses can be compared.
+  std::vector<std::vector<std::string>> ReactionNames(const types::Reactions& reactions)
+  {
+    std::vector<std::vector<std::string>> names;
+    auto collect = [&](const auto& list)
+    {
+      auto& out = names.emplace_back();
+      for (const auto& reaction : list)
+        out.push_back(reaction.name);
+    };
+    collect(reactions.arrhenius);
+    collect(reactions.branched);
+    collect(reactions.emission);
+    collect(reactions.first_order_loss);
+    collect(reactions.photolysis);
+    collect(reactions.surface);
+    collect(reactions.taylor_series);
+    collect(reactions.troe);
+    collect(reactions.ternary_chemical_activation);
+    collect(reactions.tunneling);
+    collect(reactions.user_defined);
+    collect(reactions.lambda_rate_constant);
+    return names;
+  }
+
+  // Parses `path` as a whole and streamed, and checks both give the same mechanism or errors.
+  void ExpectStreamingMatches(const std::filesystem::path& path)
+  {
+    SCOPED_TRACE(path.string());
+    auto whole = Parse(path);
+    auto streamed = Parse(path, ParseOptions{ .stream_reactions = true });
+    ASSERT_EQ(static_cast<bool>(whole), static_cast<bool>(streamed));
+    if (!whole)
+    {
+      ASSERT_EQ(whole.error().size(), streamed.error().size());
+      for (std::size_t i = 0; i < whole.error().size(); ++i)
+      {
+        EXPECT_EQ(whole.error()[i].first, streamed.error()[i].first);
+        EXPECT_EQ(whole.error()[i].second, streamed.error()[i].second);
+      }
+      return;
+    }
+    EXPECT_EQ(whole->name, streamed->name);
+    EXPECT_EQ(whole->species.size(), streamed->species.size());
+    EXPECT_EQ(whole->phases.size(), streamed->phases.size());
+    EXPECT_EQ(ReactionNames(whole->reactions), ReactionNames(streamed->reactions));
+    ASSERT_EQ(whole->reactions.arrhenius.size(), streamed->reactions.arrhenius.size());
+    for (std::size_t i = 0; i < whole->reactions.arrhenius.size(); ++i)
+    {
+      const auto& a = whole->reactions.arrhenius[i];
+      const auto& b = streamed->reactions.arrhenius[i];
+      EXPECT_EQ(a.A, b.A);
+      EXPECT_EQ(a.C, b.C);
+      ASSERT_EQ(a.reactants.size(), b.reactants.size());
+      for (std::size_t j = 0; j < a.reactants.size(); ++j)
+      {
+        EXPECT_EQ(a.reactants[j].name, b.reactants[j].name);
+        EXPECT_EQ(a.reactants[j].coefficient, b.reactants[j].coefficient);
+      }
+    }
+  }
+
   const std::string kYamlConfig = R"(
 version: 1.0.0
 name: Simple Configuration
@@ -121,3 +185,107 @@ TEST(V1Parser, CanParseFromJsonString)
   EXPECT_EQ(parsed->reactions.arrhenius.size(), 1);
   EXPECT_EQ(parsed->version.major, 1);
 }
+
+// Streaming the reactions must not change the outcome: every valid and invalid test
+// configuration gives the same mechanism, or the same errors at the same line:col.
+TEST(V1Parser, StreamingMatchesWholeDocumentParse)
+{
+  std::size_t count = 0;
+  for (const auto& root : { "examples/v1", "v1_unit_configs", "integration_configs" })
+  {
+    if (!std::filesystem::exists(root))
+      continue;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root))
+    {
+      const auto extension = entry.path().extension();
+      if (entry.is_regular_file() && (extension == ".json" || extension == ".yaml"))
+      {
+        ExpectStreamingMatches(entry.path());
+        ++count;
+      }
+    }
+  }
+  EXPECT_GT(count, 0);
+}
+
+TEST(V1Parser, StreamingFromStringMatchesWholeDocumentParse)
+{
+  const std::string broken = R"(
+version: 1.0.0
+species:
+  - name: A
+phases:
+  - name: gas
+    species: [ A ]
+reactions:
+  - type: ARRHENIUS
+    gas phase: gas
+    reactants: [ { name: A } ]
+  - type: NOT_A_TYPE
+)";
+  for (const auto& content : { kYamlConfig, broken })
+  {
+    auto whole = ParseFromString(content);
+    auto streamed = ParseFromString(content, ParseOptions{ .stream_reactions = true });
+    ASSERT_EQ(static_cast<bool>(whole), static_cast<bool>(streamed));
+    if (whole)
+      EXPECT_EQ(ReactionNames(whole->reactions), ReactionNames(streamed->reactions));
+    else
+      EXPECT_EQ(whole.error(), streamed.error());
+  }
+}
+
+// An error limit returns the first errors of the full parse, whether they are found while checking
+// the structure or the references, and whether or not the reactions are streamed.
+TEST(V1Parser, ErrorLimitKeepsTheFirstErrors)
+{
+  std::string unknown_species = "version: 1.0.0\nspecies: [ { name: A } ]\nphases: [ { name: gas, species: [ A ] } ]\n"
+                                "reactions:\n";
+  std::string bad_keys = unknown_species;
+  for (int i = 0; i < 6; ++i)
+  {
+    unknown_species += "  - { type: ARRHENIUS, gas phase: gas, reactants: [ { name: X" + std::to_string(i) + " } ] }\n";
+    bad_keys +=
+        "  - { type: ARRHENIUS, gas phase: gas, reactants: [ { name: A } ], bad key " + std::to_string(i) + ": 1 }\n";
+  }
+
+  for (const auto& content : { unknown_species, bad_keys })
+    for (const bool stream : { false, true })
+    {
+      const auto all = ParseFromString(content, { .stream_reactions = stream });
+      ASSERT_FALSE(all);
+      ASSERT_GE(all.error().size(), 6);
+
+      for (const std::size_t limit : { 1, 2, 5 })
+      {
+        const auto limited = ParseFromString(content, { .stream_reactions = stream, .validation = { .max_errors = limit } });
+        ASSERT_FALSE(limited);
+        EXPECT_EQ(limited.error(), Errors(all.error().begin(), all.error().begin() + limit));
+      }
+      const auto first =
+          ParseFromString(content, { .stream_reactions = stream, .validation = { .stop_on_first_error = true } });
+      ASSERT_FALSE(first);
+      EXPECT_EQ(first.error(), Errors(all.error().begin(), all.error().begin() + 1));
+    }
+}
+
+TEST(V1Parser, ErrorLimitStillReportsALaterTypeError)
+{
+  // A type error replaces every schema error, so a limit reached by schema errors must not hide it
+  const std::string content = "version: 1.0.0\nspecies: [ { name: A } ]\nphases: [ { name: gas, species: [ A ] } ]\n"
+                              "reactions:\n"
+                              "  - { type: ARRHENIUS, gas phase: gas, reactants: [ { name: A } ], bad: 1 }\n"
+                              "  - { type: ARRHENIUS, gas phase: gas, reactants: [ { name: A } ] }\n"
+                              "  - { type: WHAT, gas phase: gas }\n";
+  for (const bool stream : { false, true })
+  {
+    const auto all = ParseFromString(content, { .stream_reactions = stream });
+    ASSERT_FALSE(all);
+    ASSERT_EQ(all.error().size(), 1);
+    EXPECT_EQ(all.error()[0].first, ErrorCode::UnknownType);
+
+    const auto limited = ParseFromString(content, { .stream_reactions = stream, .validation = { .max_errors = 1 } });
+    ASSERT_FALSE(limited);
+    EXPECT_EQ(limited.error(), all.error());
+  }
+}
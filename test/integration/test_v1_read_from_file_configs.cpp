@@ -2,12 +2,15 @@
 //                         University of Illinois at Urbana-Champaign
 // SPDX-License-Identifier: Apache-2.0
 
+#include "detail/v1/parser.hpp"
 #include "utils/print.hpp"
 
 #include <mechanism_configuration/parse.hpp>
 
 #include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
 
+#include <filesystem>
 #include <iostream>
 #include <string>
 
@@ -41,3 +44,20 @@ TEST(V1FileConfigs, ParsesMultiFileConfiguration)
     EXPECT_EQ(mechanism.reactions.arrhenius.size(), 6);
   }
 }
+
+// Parse() loads the root document once and passes it to the v1 parser; file-list sections must
+// still resolve relative to the original file's directory.
+TEST(V1FileConfigs, ParsesPreloadedRootDocument)
+{
+  const std::filesystem::path main("examples/v1/config/yaml/main.yaml");
+  const YAML::Node root = YAML::LoadFile(main.string());
+
+  auto parsed = v1::Parser{}.Parse(root, main);
+  if (!parsed)
+    for (const auto& [code, message] : parsed.error())
+      std::cout << "[" << ErrorCodeToString(code) << "] " << message << "\n";
+  ASSERT_TRUE(parsed);
+
+  EXPECT_EQ(parsed->species.size(), 3);
+  EXPECT_EQ(parsed->reactions.arrhenius.size(), 6);
+}
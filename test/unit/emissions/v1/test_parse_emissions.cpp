@@ -61,8 +61,8 @@ TEST(EmissionsV1Parser, ParsesValidConfig)
   EXPECT_EQ(src.hierarchy, 1);
   EXPECT_DOUBLE_EQ(src.scaling_factor, 1.0);
   EXPECT_EQ(src.sector, "anthropogenic");
-  ASSERT_EQ(src.unknown_properties.size(), 1u);
-  EXPECT_EQ(src.unknown_properties.at("__notes"), "test source");
+  ASSERT_EQ(result->unknown_properties.Of(src).size(), 1u);
+  EXPECT_EQ(result->unknown_properties.Find(src, "__notes"), "test source");
 }
 
 TEST(EmissionsV1Parser, ParsesValidConfigFromString)
@@ -0,0 +1,71 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/aerosol_rate_constants.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  types::DissolvedReaction Reaction(types::RateConstant rate_constant)
+  {
+    types::DissolvedReaction reaction;
+    reaction.rate_constant = std::move(rate_constant);
+    return reaction;
+  }
+}  // namespace
+
+TEST(AerosolRateConstantEngine, EvaluatesEveryForm)
+{
+  types::Aerosol aerosol;
+  aerosol.processes.push_back(Reaction(types::Arrhenius{ .A = 1.0e3, .B = -1.5, .C = 100.0, .D = 298.0 }));
+  aerosol.processes.push_back(types::HenrysLawPhaseTransfer{});
+  types::DissolvedReversibleReaction reversible;
+  reversible.forward_rate_constant = types::RateExpression{ "[](double T) { return 2.5e3 * exp(-1500.0 / T); }" };
+  reversible.reverse_rate_constant = types::Equilibrium{ .A = 4.0, .C = 500.0, .T0 = 300.0 };
+  aerosol.processes.push_back(reversible);
+
+  const AerosolRateConstantEngine engine(aerosol);
+  ASSERT_EQ(engine.size(), 3);
+  EXPECT_EQ(engine.sources()[0].process, 0);
+  EXPECT_EQ(engine.sources()[0].role, AerosolRateConstantRole::Rate);
+  EXPECT_EQ(engine.sources()[1].process, 2);
+  EXPECT_EQ(engine.sources()[1].role, AerosolRateConstantRole::Forward);
+  EXPECT_EQ(engine.sources()[2].process, 2);
+  EXPECT_EQ(engine.sources()[2].role, AerosolRateConstantRole::Reverse);
+
+  // More cells than one evaluation block
+  std::vector<double> temperature;
+  for (std::size_t c = 0; c < 600; ++c)
+    temperature.push_back(200.0 + 0.25 * static_cast<double>(c));
+  const std::size_t cells = temperature.size();
+  std::vector<double> k(engine.size() * cells);
+  engine.Evaluate(temperature, k);
+  for (std::size_t c = 0; c < cells; ++c)
+  {
+    const double T = temperature[c];
+    EXPECT_NEAR(k[c], 1.0e3 * std::exp(100.0 / T) * std::pow(T / 298.0, -1.5), 1.0e-12 * k[c]);
+    EXPECT_NEAR(k[cells + c], 2.5e3 * std::exp(-1500.0 / T), 1.0e-12 * k[cells + c]);
+    EXPECT_NEAR(k[2 * cells + c], 4.0 * std::exp(500.0 * (1.0 / 300.0 - 1.0 / T)), 1.0e-12 * k[2 * cells + c]);
+  }
+
+  std::vector<double> short_output(k.size() - 1);
+  EXPECT_THROW(engine.Evaluate(temperature, short_output), std::invalid_argument);
+}
+
+TEST(AerosolRateConstantEngine, RejectsInvalidExpressions)
+{
+  types::Aerosol aerosol;
+  aerosol.processes.push_back(Reaction(types::RateExpression{ "2.0 * T +" }));
+  EXPECT_THROW(AerosolRateConstantEngine{ aerosol }, std::invalid_argument);
+
+  aerosol.processes[0] = Reaction(types::RateExpression{ "2.0 * T * P" });
+  EXPECT_THROW(AerosolRateConstantEngine{ aerosol }, std::invalid_argument);
+}
@@ -0,0 +1,271 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/compiled.hpp"
+#include "utils/files.hpp"
+#include "utils/print.hpp"
+
+#include <mechanism_configuration/compiled.hpp>
+#include <mechanism_configuration/parse.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  // Saves `mechanism`, loads it back and checks that saving the loaded copy gives the same bytes,
+  // i.e. that nothing was lost on the way through.
+  Mechanism RoundTrip(const Mechanism& mechanism, const std::filesystem::path& dir)
+  {
+    const auto first = dir / "first.mcc";
+    const auto second = dir / "second.mcc";
+    EXPECT_TRUE(SaveCompiled(mechanism, first).empty());
+    auto loaded = LoadCompiled(first);
+    EXPECT_TRUE(loaded) << (loaded ? "" : loaded.error()[0].second);
+    if (!loaded)
+      return {};
+    EXPECT_TRUE(SaveCompiled(*loaded, second).empty());
+    EXPECT_EQ(ReadBytes(first), ReadBytes(second));
+    return std::move(*loaded);
+  }
+}  // namespace
+
+TEST(Compiled, RoundTripsFullConfiguration)
+{
+  const auto dir = FreshDirectory("mc_compiled_full");
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  parsed->species_order = std::vector<std::size_t>{ 2, 0, 1 };
+
+  Mechanism loaded = RoundTrip(*parsed, dir);
+  EXPECT_EQ(loaded.name, parsed->name);
+  EXPECT_EQ(loaded.species_order, parsed->species_order);
+  EXPECT_EQ(loaded.version.to_string(), parsed->version.to_string());
+  EXPECT_EQ(loaded.relative_tolerance, parsed->relative_tolerance);
+  ASSERT_EQ(loaded.species.size(), parsed->species.size());
+  EXPECT_EQ(loaded.species[0].name, parsed->species[0].name);
+  EXPECT_TRUE(std::ranges::equal(
+      loaded.unknown_properties.Of(loaded.species[0]), parsed->unknown_properties.Of(parsed->species[0])));
+  EXPECT_EQ(loaded.phases.size(), parsed->phases.size());
+  ASSERT_EQ(loaded.reactions.arrhenius.size(), parsed->reactions.arrhenius.size());
+  EXPECT_EQ(loaded.reactions.arrhenius[0].A, parsed->reactions.arrhenius[0].A);
+  EXPECT_EQ(loaded.reactions.arrhenius[0].reactants.size(), parsed->reactions.arrhenius[0].reactants.size());
+  EXPECT_EQ(loaded.reactions.troe.size(), parsed->reactions.troe.size());
+  EXPECT_EQ(loaded.reactions.taylor_series.size(), parsed->reactions.taylor_series.size());
+  EXPECT_EQ(loaded.reactions.lambda_rate_constant.size(), parsed->reactions.lambda_rate_constant.size());
+  ASSERT_TRUE(loaded.emissions.has_value());
+  EXPECT_EQ(loaded.emissions->sources.size(), parsed->emissions->sources.size());
+}
+
+TEST(Compiled, RoundTripsAerosol)
+{
+  const auto dir = FreshDirectory("mc_compiled_aerosol");
+  auto parsed = Parse("v1_unit_configs/aerosol/valid_aerosol.json");
+  ASSERT_TRUE(parsed);
+  ASSERT_TRUE(parsed->aerosol.has_value());
+
+  Mechanism loaded = RoundTrip(*parsed, dir);
+  ASSERT_TRUE(loaded.aerosol.has_value());
+  EXPECT_EQ(loaded.aerosol->representations.size(), parsed->aerosol->representations.size());
+  ASSERT_EQ(loaded.aerosol->processes.size(), parsed->aerosol->processes.size());
+  ASSERT_EQ(loaded.aerosol->constraints.size(), parsed->aerosol->constraints.size());
+  for (std::size_t i = 0; i < loaded.aerosol->processes.size(); ++i)
+    EXPECT_EQ(loaded.aerosol->processes[i].index(), parsed->aerosol->processes[i].index());
+  for (std::size_t i = 0; i < loaded.aerosol->constraints.size(); ++i)
+    EXPECT_EQ(loaded.aerosol->constraints[i].index(), parsed->aerosol->constraints[i].index());
+}
+
+TEST(Compiled, RoundTripsRateExpressions)
+{
+  const auto dir = FreshDirectory("mc_compiled_expression");
+  Mechanism mechanism;
+  types::DissolvedReaction reaction;
+  reaction.rate_constant = types::RateExpression{ "1.0e3 * exp(-200.0 / T)" };
+  mechanism.aerosol = types::Aerosol{};
+  mechanism.aerosol->processes.push_back(reaction);
+
+  Mechanism loaded = RoundTrip(mechanism, dir);
+  ASSERT_TRUE(loaded.aerosol.has_value());
+  ASSERT_EQ(loaded.aerosol->processes.size(), 1);
+  const auto& loaded_reaction = std::get<types::DissolvedReaction>(loaded.aerosol->processes[0]);
+  EXPECT_EQ(std::get<types::RateExpression>(loaded_reaction.rate_constant).expression, "1.0e3 * exp(-200.0 / T)");
+}
+
+TEST(Compiled, ReportsMissingAndCorruptImages)
+{
+  const auto dir = FreshDirectory("mc_compiled_corrupt");
+
+  auto missing = LoadCompiled(dir / "missing.mcc");
+  ASSERT_FALSE(missing);
+  EXPECT_EQ(missing.error()[0].first, ErrorCode::FileNotFound);
+
+  WriteBytes(dir / "garbage.mcc", "version: 1.0.0\nname: not an image\n");
+  auto garbage = LoadCompiled(dir / "garbage.mcc");
+  ASSERT_FALSE(garbage);
+  EXPECT_EQ(garbage.error()[0].first, ErrorCode::UnexpectedError);
+
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  ASSERT_TRUE(SaveCompiled(*parsed, dir / "valid.mcc").empty());
+  const std::string image = ReadBytes(dir / "valid.mcc");
+
+  // Every truncation fails cleanly rather than crashing or returning a partial mechanism.
+  for (std::size_t size = 0; size < image.size(); size += 1 + image.size() / 97)
+  {
+    WriteBytes(dir / "truncated.mcc", image.substr(0, size));
+    EXPECT_FALSE(LoadCompiled(dir / "truncated.mcc")) << "truncated to " << size << " bytes";
+  }
+
+  std::string flipped = image;
+  flipped[flipped.size() - 5] ^= 0x40;
+  WriteBytes(dir / "flipped.mcc", flipped);
+  auto corrupt = LoadCompiled(dir / "flipped.mcc");
+  ASSERT_FALSE(corrupt);
+  EXPECT_EQ(corrupt.error()[0].first, ErrorCode::UnexpectedError);
+
+  // The format version follows the 8-byte magic.
+  std::string other_version = image;
+  other_version[8] = 0x7f;
+  WriteBytes(dir / "other_version.mcc", other_version);
+  auto version = LoadCompiled(dir / "other_version.mcc");
+  ASSERT_FALSE(version);
+  EXPECT_EQ(version.error()[0].first, ErrorCode::InvalidVersion);
+}
+
+TEST(Compiled, ChecksumDoesNotDependOnTheHostByteOrder)
+{
+  const auto dir = FreshDirectory("mc_compiled_checksum");
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  ASSERT_TRUE(SaveCompiled(*parsed, dir / "image.mcc").empty());
+  const std::string image = ReadBytes(dir / "image.mcc");
+
+  // Walk the header: magic, format version, library version, request, no sources, then the
+  // payload size and checksum.
+  std::size_t position = 8;
+  auto varint = [&]
+  {
+    std::uint64_t value = 0;
+    for (int shift = 0; position < image.size(); shift += 7)
+    {
+      const auto byte = static_cast<unsigned char>(image[position++]);
+      value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80))
+        break;
+    }
+    return value;
+  };
+  varint();
+  position += varint();
+  position += varint();
+  ASSERT_EQ(varint(), 0);
+  const std::uint64_t size = varint();
+  const std::uint64_t checksum = varint();
+  ASSERT_EQ(position + size, image.size());
+
+  // The checksum, with every 8-byte word read least significant byte first
+  const std::string_view payload = std::string_view(image).substr(position);
+  constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+  std::uint64_t expected = 14695981039346656037ull ^ payload.size();
+  std::size_t i = 0;
+  for (; i + 8 <= payload.size(); i += 8)
+  {
+    std::uint64_t word = 0;
+    for (std::size_t b = 8; b-- > 0;)
+      word = (word << 8) | static_cast<unsigned char>(payload[i + b]);
+    expected = (expected ^ word) * FNV_PRIME;
+    expected ^= expected >> 32;
+  }
+  for (; i < payload.size(); ++i)
+    expected = (expected ^ static_cast<unsigned char>(payload[i])) * FNV_PRIME;
+  EXPECT_EQ(checksum, expected);
+}
+
+TEST(Compiled, ParseCacheIsReusedUntilASourceFileChanges)
+{
+  const auto dir = FreshDirectory("mc_compiled_cache");
+  std::ofstream(dir / "species.yaml") << "- name: A\n- name: B\n";
+  std::ofstream(dir / "phases.yaml") << "- name: gas\n  species: [ A, B ]\n";
+  std::ofstream(dir / "reactions.yaml") << "- type: ARRHENIUS\n  gas phase: gas\n  A: 1.0\n"
+                                           "  reactants: [ { species name: A } ]\n  products: [ { species name: B } ]\n";
+  std::ofstream(dir / "main.yaml") << "version: 1.1.0\nname: cached\n"
+                                      "species: { files: [ species.yaml ] }\nphases: { files: [ phases.yaml ] }\n"
+                                      "reactions: { files: [ reactions.yaml ] }\n";
+
+  ParseOptions options;
+  options.cache_path = dir / "main.mcc";
+
+  auto first = Parse(dir / "main.yaml", options);
+  ASSERT_TRUE(first) << first.error()[0].second;
+  ASSERT_TRUE(std::filesystem::exists(options.cache_path));
+  EXPECT_EQ(first->reactions.arrhenius[0].A, 1.0);
+
+  // A hit is served from the image, which stays as it was.
+  const std::string image = ReadBytes(options.cache_path);
+  ASSERT_TRUE(LoadCachedMechanism(options.cache_path, dir / "main.yaml"));
+  auto cached = Parse(dir / "main.yaml", options);
+  ASSERT_TRUE(cached);
+  EXPECT_EQ(cached->name, "cached");
+  EXPECT_EQ(cached->reactions.arrhenius[0].A, 1.0);
+  EXPECT_EQ(ReadBytes(options.cache_path), image);
+
+  // Changing a listed file (not the main configuration) invalidates the cache.
+  std::ofstream(dir / "reactions.yaml", std::ios::trunc)
+      << "- type: ARRHENIUS\n  gas phase: gas\n  A: 2.0\n"
+         "  reactants: [ { species name: A } ]\n  products: [ { species name: B } ]\n";
+  EXPECT_FALSE(LoadCachedMechanism(options.cache_path, dir / "main.yaml"));
+  auto reparsed = Parse(dir / "main.yaml", options);
+  ASSERT_TRUE(reparsed);
+  EXPECT_EQ(reparsed->reactions.arrhenius[0].A, 2.0);
+  EXPECT_TRUE(LoadCachedMechanism(options.cache_path, dir / "main.yaml"));
+
+  // The cache only answers for the configuration it was made from.
+  std::ofstream(dir / "other.yaml") << "version: 1.1.0\nname: other\n"
+                                       "species: { files: [ species.yaml ] }\nphases: { files: [ phases.yaml ] }\n"
+                                       "reactions: { files: [ reactions.yaml ] }\n";
+  auto other = Parse(dir / "other.yaml", options);
+  ASSERT_TRUE(other);
+  EXPECT_EQ(other->name, "other");
+  EXPECT_FALSE(LoadCachedMechanism(options.cache_path, dir / "main.yaml"));
+
+  // A failed parse leaves the cache alone.
+  std::ofstream(dir / "broken.yaml") << "version: 1.1.0\nname: broken\n";
+  const std::string before = ReadBytes(options.cache_path);
+  EXPECT_FALSE(Parse(dir / "broken.yaml", options));
+  EXPECT_EQ(ReadBytes(options.cache_path), before);
+}
+
+TEST(Compiled, ParseCacheHitDropsUnknownPropertiesWhenNotCollected)
+{
+  const auto dir = FreshDirectory("mc_compiled_cache_properties");
+  const std::filesystem::path config = "examples/v1/full_configuration.yaml";
+  ParseOptions options;
+  options.cache_path = dir / "full.mcc";
+  auto collected = Parse(config, options);
+  ASSERT_TRUE(collected);
+  ASSERT_FALSE(collected->unknown_properties.empty());
+
+  // The image carries the unknown properties, but a hit without them gives what a parse would
+  options.collect_unknown_properties = false;
+  ASSERT_TRUE(LoadCachedMechanism(options.cache_path, config));
+  auto cached = Parse(config, options);
+  ASSERT_TRUE(cached);
+  EXPECT_TRUE(cached->unknown_properties.empty());
+  for (const auto& species : cached->species)
+    EXPECT_EQ(species.unknown_properties_id, types::NO_PROPERTIES);
+
+  auto parsed = Parse(config, { .collect_unknown_properties = false });
+  ASSERT_TRUE(parsed);
+  EXPECT_TRUE(SaveCompiled(*cached, dir / "cached.mcc").empty());
+  EXPECT_TRUE(SaveCompiled(*parsed, dir / "parsed.mcc").empty());
+  EXPECT_EQ(ReadBytes(dir / "cached.mcc"), ReadBytes(dir / "parsed.mcc"));
+}
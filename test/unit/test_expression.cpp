@@ -0,0 +1,119 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/expression.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  Expression Compile(const std::string& source)
+  {
+    auto expression = Expression::Compile(source);
+    EXPECT_TRUE(expression) << source << ": " << expression.error().message;
+    return expression ? *expression : Expression{};
+  }
+}  // namespace
+
+TEST(Expression, EvaluatesLambdas)
+{
+  const Expression arrhenius = Compile("[](double T, double P) { return 1.2e-5 * exp(-500.0 / T); }");
+  EXPECT_DOUBLE_EQ(arrhenius.Evaluate(250.0, 1.0e5), 1.2e-5 * std::exp(-500.0 / 250.0));
+  EXPECT_FALSE(arrhenius.UsesPressure());
+
+  const Expression linear = Compile("[](double T) { return 3.0e-4 * T; }");
+  EXPECT_DOUBLE_EQ(linear.Evaluate(300.0, 0.0), 3.0e-4 * 300.0);
+
+  // Parameters are bound by position, not by name.
+  const Expression renamed = Compile("[](const double temp, double pres) -> double { return temp / pres; }");
+  EXPECT_DOUBLE_EQ(renamed.Evaluate(300.0, 1.0e5), 300.0 / 1.0e5);
+  EXPECT_TRUE(renamed.UsesPressure());
+}
+
+TEST(Expression, EvaluatesBareExpressions)
+{
+  const double T = 273.15;
+  const double P = 101325.0;
+  EXPECT_DOUBLE_EQ(Compile("2 + 3 * 4 - 6 / 2").Evaluate(T, P), 11.0);
+  EXPECT_DOUBLE_EQ(Compile("(2 + 3) * -4").Evaluate(T, P), -20.0);
+  EXPECT_DOUBLE_EQ(Compile("-T * -2").Evaluate(T, P), 2.0 * T);
+  EXPECT_DOUBLE_EQ(Compile("std::pow(T / 300.0, -2.5) * P").Evaluate(T, P), std::pow(T / 300.0, -2.5) * P);
+  EXPECT_DOUBLE_EQ(Compile("log(T) + log10(P) + sqrt(T)").Evaluate(T, P), std::log(T) + std::log10(P) + std::sqrt(T));
+  EXPECT_DOUBLE_EQ(Compile("fabs(-T) + min(T, P) + max(T, P)").Evaluate(T, P), T + T + P);
+  EXPECT_DOUBLE_EQ(Compile("1.5e-11f * T").Evaluate(T, P), 1.5e-11 * T);
+}
+
+TEST(Expression, FoldsConstants)
+{
+  const Expression constant = Compile("[](double T) { return 2.0 * exp(-100.0 / 50.0) + 1; }");
+  EXPECT_TRUE(constant.IsConstant());
+  EXPECT_DOUBLE_EQ(constant.Evaluate(300.0, 0.0), 2.0 * std::exp(-2.0) + 1.0);
+  EXPECT_FALSE(Compile("2.0 * T").IsConstant());
+
+  std::vector<double> temperature(5, 300.0);
+  std::vector<double> values(5);
+  constant.Evaluate(temperature, {}, values);
+  for (double value : values)
+    EXPECT_DOUBLE_EQ(value, 2.0 * std::exp(-2.0) + 1.0);
+}
+
+TEST(Expression, BatchMatchesScalar)
+{
+  const Expression expression =
+      Compile("[](double T, double P) { return 1.0e-12 * pow(T / 300.0, -1.5) * exp(150.0 / T) * (1 + 6e-6 * P); }");
+  // More cells than one evaluation block
+  std::vector<double> temperature, pressure;
+  for (std::size_t c = 0; c < 700; ++c)
+  {
+    temperature.push_back(180.0 + 0.2 * static_cast<double>(c));
+    pressure.push_back(1.0e4 + 100.0 * static_cast<double>(c));
+  }
+  std::vector<double> values(temperature.size());
+  expression.Evaluate(temperature, pressure, values);
+  for (std::size_t c = 0; c < values.size(); ++c)
+    EXPECT_DOUBLE_EQ(values[c], expression.Evaluate(temperature[c], pressure[c]));
+
+  std::vector<double> short_output(3);
+  EXPECT_THROW(expression.Evaluate(temperature, pressure, short_output), std::invalid_argument);
+}
+
+TEST(Expression, ReportsErrorPositions)
+{
+  struct Case
+  {
+    std::string source;
+    std::size_t line;
+    std::size_t column;
+  };
+  const std::vector<Case> cases = {
+    { "[](double T) { return 3.0 * Q; }", 0, 28 },
+    { "[](double T) { return 3.0 * T }", 0, 30 },
+    { "[](double T) { return exp(T, 2); }", 0, 27 },
+    { "[](double T) { return 1.0;\n  T; }", 1, 2 },
+    { "[](int T) { return 1.0; }", 0, 6 },
+    { "3.0 *", 0, 5 },
+    { "(T + 1", 0, 6 },
+    { "2.0x", 0, 3 },
+  };
+  for (const auto& c : cases)
+  {
+    auto expression = Expression::Compile(c.source);
+    ASSERT_FALSE(expression) << c.source;
+    EXPECT_EQ(expression.error().line, c.line) << c.source;
+    EXPECT_EQ(expression.error().column, c.column) << c.source << ": " << expression.error().message;
+  }
+}
+
+TEST(Expression, RejectsDeepNesting)
+{
+  EXPECT_FALSE(Expression::Compile(std::string(1000, '(') + "T" + std::string(1000, ')')));
+  EXPECT_FALSE(Expression::Compile(std::string(1000, '-') + "T"));
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/jacobian.hpp>
+#include <mechanism_configuration/parse.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <utility>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  std::set<std::pair<std::size_t, std::size_t>> Entries(const SparsityPattern& pattern)
+  {
+    std::set<std::pair<std::size_t, std::size_t>> entries;
+    for (std::size_t i = 0; i < pattern.rows(); ++i)
+      for (std::size_t k = pattern.offsets[i]; k < pattern.offsets[i + 1]; ++k)
+        entries.insert({ i, pattern.indices[k] });
+    return entries;
+  }
+
+  // Species 0 reacts with every other species: an arrowhead Jacobian that fills in completely
+  // when species 0 is eliminated first.
+  Mechanism Arrowhead(std::size_t species)
+  {
+    Mechanism mechanism;
+    for (std::size_t i = 0; i < species; ++i)
+      mechanism.species.push_back({ .name = "S" + std::to_string(i) });
+    for (std::size_t i = 1; i < species; ++i)
+      mechanism.reactions.arrhenius.push_back({ .reactants = { { .name = "S0" }, { .name = mechanism.species[i].name } } });
+    AssignIndices(mechanism);
+    return mechanism;
+  }
+
+  void ExpectPermutation(std::vector<std::size_t> order, std::size_t size)
+  {
+    ASSERT_EQ(order.size(), size);
+    std::ranges::sort(order);
+    for (std::size_t k = 0; k < size; ++k)
+      EXPECT_EQ(order[k], k);
+  }
+}  // namespace
+
+TEST(JacobianSparsity, ConnectsChangedSpeciesToReactants)
+{
+  // A + B -> C, C -> D, D -> E (nitrate) or A (alkoxy)
+  Mechanism mechanism;
+  mechanism.species = { { .name = "A" }, { .name = "B" }, { .name = "C" }, { .name = "D" }, { .name = "E" } };
+  mechanism.reactions.arrhenius.push_back(
+      { .reactants = { { .name = "A" }, { .name = "B" } }, .products = { { .name = "C" } } });
+  mechanism.reactions.photolysis.push_back({ .reactants = { .name = "C" }, .products = { { .name = "D" } } });
+  mechanism.reactions.branched.push_back(
+      { .reactants = { { .name = "D" } }, .nitrate_products = { { .name = "E" } }, .alkoxy_products = { { .name = "A" } } });
+  AssignIndices(mechanism);
+
+  auto stoichiometry = BuildStoichiometry(mechanism);
+  ASSERT_TRUE(stoichiometry);
+  const SparsityPattern jacobian = BuildJacobianSparsity(*stoichiometry);
+  const std::set<std::pair<std::size_t, std::size_t>> expected{ { 0, 0 }, { 0, 1 }, { 0, 3 }, { 1, 0 }, { 1, 1 },
+                                                                 { 2, 0 }, { 2, 1 }, { 2, 2 }, { 3, 2 }, { 3, 3 },
+                                                                 { 4, 3 }, { 4, 4 } };
+  EXPECT_EQ(Entries(jacobian), expected);
+}
+
+TEST(JacobianSparsity, MinimumDegreeAvoidsArrowheadFill)
+{
+  auto stoichiometry = BuildStoichiometry(Arrowhead(8));
+  ASSERT_TRUE(stoichiometry);
+  const SparsityPattern jacobian = BuildJacobianSparsity(*stoichiometry);
+
+  std::vector<std::size_t> natural(8);
+  for (std::size_t k = 0; k < natural.size(); ++k)
+    natural[k] = k;
+  EXPECT_EQ(SymbolicLU(jacobian, natural).size(), 64);
+
+  const auto order = OrderSpecies(jacobian);
+  ExpectPermutation(order, 8);
+  const SparsityPattern lu = SymbolicLU(jacobian, order);
+  EXPECT_EQ(lu.size(), jacobian.size());
+  EXPECT_EQ(Entries(lu), Entries(PermutePattern(jacobian, order)));
+}
+
+TEST(JacobianSparsity, ReverseCuthillMcKeeIsAPermutation)
+{
+  auto stoichiometry = BuildStoichiometry(Arrowhead(6));
+  ASSERT_TRUE(stoichiometry);
+  const SparsityPattern jacobian = BuildJacobianSparsity(*stoichiometry);
+  const auto order = OrderSpecies(jacobian, SpeciesOrdering::ReverseCuthillMcKee);
+  ExpectPermutation(order, 6);
+  // L + U always covers the permuted pattern.
+  const auto lu = Entries(SymbolicLU(jacobian, order));
+  for (const auto& entry : Entries(PermutePattern(jacobian, order)))
+    EXPECT_TRUE(lu.contains(entry));
+}
+
+TEST(JacobianSparsity, FullConfiguration)
+{
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  auto stoichiometry = BuildStoichiometry(*parsed);
+  ASSERT_TRUE(stoichiometry);
+  const SparsityPattern jacobian = BuildJacobianSparsity(*stoichiometry);
+  EXPECT_EQ(jacobian.rows(), parsed->species.size());
+
+  parsed->species_order = OrderSpecies(jacobian);
+  ExpectPermutation(*parsed->species_order, parsed->species.size());
+  EXPECT_GE(SymbolicLU(jacobian, *parsed->species_order).size(), jacobian.size());
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/map_view.hpp"
+
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  std::atomic<std::size_t> allocations{ 0 };
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+  ++allocations;
+  if (void* p = std::malloc(size == 0 ? 1 : size))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+TEST(MapView, FindsKeys)
+{
+  const YAML::Node node = YAML::Load("{ type: ARRHENIUS, A: 1.5, gas phase: gas, A: 2.0 }");
+  const MapView view(node);
+  EXPECT_EQ(view[std::string("type")].as<std::string>(), "ARRHENIUS");
+  // Repeated keys resolve to their first occurrence, as in yaml-cpp
+  EXPECT_EQ(view["A"].as<double>(), 1.5);
+  EXPECT_EQ(view["gas phase"].as<std::string>(), "gas");
+  EXPECT_FALSE(view["B"]);
+  EXPECT_FALSE(view["B"].IsDefined());
+  EXPECT_THROW(view["B"].as<double>(), YAML::InvalidNode);
+
+  // Stands in for the node it views
+  const YAML::Node& viewed = view;
+  EXPECT_EQ(viewed.Mark().line, node.Mark().line);
+  EXPECT_TRUE(view.node().IsMap());
+}
+
+TEST(MapView, HasNoKeysUnlessAMap)
+{
+  EXPECT_FALSE(MapView(YAML::Load("[a, b]"))["a"]);
+  EXPECT_FALSE(MapView(YAML::Load("a"))["a"]);
+  EXPECT_FALSE(MapView(YAML::Node())["a"]);
+  const YAML::Node map = YAML::Load("{ a: 1 }");
+  EXPECT_FALSE(MapView(map["missing"])["a"]);
+}
+
+TEST(MapView, LooksUpWithoutAllocating)
+{
+  const YAML::Node node = YAML::Load(
+      "{ type: HENRYS_LAW_PHASE_TRANSFER, condensed phase species: H2O2_aq, accommodation coefficient: 0.02 }");
+  const MapView view(node);
+  const std::size_t before = allocations;
+  bool found = true;
+  found = found && view["condensed phase species"];
+  found = found && view["accommodation coefficient"];
+  found = found && !view["a key that is much too long for any small-string buffer"];
+  EXPECT_TRUE(found);
+  EXPECT_EQ(allocations - before, 0);
+}
@@ -0,0 +1,245 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "utils/files.hpp"
+#include "utils/print.hpp"
+
+#include <mechanism_configuration/mapped.hpp>
+#include <mechanism_configuration/parse.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  void ExpectComponents(
+      const mapped::Range<mapped::ReactionComponent>& mapped,
+      const std::vector<types::ReactionComponent>& expected,
+      const Mechanism& mechanism)
+  {
+    ASSERT_EQ(mapped.size(), expected.size());
+    std::size_t i = 0;
+    for (const auto component : mapped)
+    {
+      EXPECT_EQ(component.name(), expected[i].name);
+      EXPECT_EQ(component.coefficient(), expected[i].coefficient);
+      ASSERT_LT(component.species_index(), mechanism.species.size());
+      EXPECT_EQ(mechanism.species[component.species_index()].name, expected[i].name);
+      ++i;
+    }
+  }
+
+  void ExpectComponent(const mapped::ReactionComponent& mapped, const types::ReactionComponent& expected)
+  {
+    EXPECT_EQ(mapped.name(), expected.name);
+    EXPECT_EQ(mapped.coefficient(), expected.coefficient);
+  }
+
+  struct MappedFullConfiguration : public ::testing::Test
+  {
+    void SetUp() override
+    {
+      auto parsed = Parse("examples/v1/full_configuration.yaml");
+      ASSERT_TRUE(parsed);
+      mechanism = std::move(*parsed);
+      dir = FreshDirectory("mc_mapped");
+      ASSERT_TRUE(SaveMappedImage(mechanism, dir / "full.mcm").empty());
+    }
+
+    Mechanism mechanism;
+    std::filesystem::path dir;
+  };
+}  // namespace
+
+TEST_F(MappedFullConfiguration, MirrorsTheMechanism)
+{
+  auto opened = MappedMechanism::Open(dir / "full.mcm");
+  ASSERT_TRUE(opened) << opened.error()[0].second;
+  const MappedMechanism& view = *opened;
+
+  EXPECT_EQ(view.name(), mechanism.name);
+  EXPECT_EQ(view.version().to_string(), mechanism.version.to_string());
+  EXPECT_EQ(view.relative_tolerance(), mechanism.relative_tolerance);
+  ASSERT_EQ(view.species().size(), mechanism.species.size());
+  for (std::size_t i = 0; i < mechanism.species.size(); ++i)
+    EXPECT_EQ(view.species()[i].name(), mechanism.species[i].name);
+
+  const mapped::Reactions& mapped = view.reactions();
+  const types::Reactions& reactions = mechanism.reactions;
+
+  ASSERT_EQ(mapped.arrhenius.size(), reactions.arrhenius.size());
+  for (std::size_t i = 0; i < reactions.arrhenius.size(); ++i)
+  {
+    const auto& r = reactions.arrhenius[i];
+    const auto m = mapped.arrhenius[i];
+    EXPECT_EQ(m.name(), r.name);
+    EXPECT_EQ(m.gas_phase(), r.gas_phase);
+    EXPECT_EQ(m.A(), r.A);
+    EXPECT_EQ(m.B(), r.B);
+    EXPECT_EQ(m.C(), r.C);
+    EXPECT_EQ(m.D(), r.D);
+    EXPECT_EQ(m.E(), r.E);
+    ExpectComponents(m.reactants(), r.reactants, mechanism);
+    ExpectComponents(m.products(), r.products, mechanism);
+  }
+
+  ASSERT_EQ(mapped.branched.size(), reactions.branched.size());
+  for (std::size_t i = 0; i < reactions.branched.size(); ++i)
+  {
+    const auto& r = reactions.branched[i];
+    const auto m = mapped.branched[i];
+    EXPECT_EQ(m.X(), r.X);
+    EXPECT_EQ(m.Y(), r.Y);
+    EXPECT_EQ(m.a0(), r.a0);
+    EXPECT_EQ(m.n(), r.n);
+    ExpectComponents(m.reactants(), r.reactants, mechanism);
+    ExpectComponents(m.nitrate_products(), r.nitrate_products, mechanism);
+    ExpectComponents(m.alkoxy_products(), r.alkoxy_products, mechanism);
+  }
+
+  ASSERT_EQ(mapped.emission.size(), reactions.emission.size());
+  for (std::size_t i = 0; i < reactions.emission.size(); ++i)
+  {
+    EXPECT_EQ(mapped.emission[i].scaling_factor(), reactions.emission[i].scaling_factor);
+    ExpectComponents(mapped.emission[i].products(), reactions.emission[i].products, mechanism);
+  }
+
+  ASSERT_EQ(mapped.first_order_loss.size(), reactions.first_order_loss.size());
+  for (std::size_t i = 0; i < reactions.first_order_loss.size(); ++i)
+  {
+    EXPECT_EQ(mapped.first_order_loss[i].scaling_factor(), reactions.first_order_loss[i].scaling_factor);
+    ExpectComponent(mapped.first_order_loss[i].reactants(), reactions.first_order_loss[i].reactants);
+    ExpectComponents(mapped.first_order_loss[i].products(), reactions.first_order_loss[i].products, mechanism);
+  }
+
+  ASSERT_EQ(mapped.photolysis.size(), reactions.photolysis.size());
+  for (std::size_t i = 0; i < reactions.photolysis.size(); ++i)
+  {
+    EXPECT_EQ(mapped.photolysis[i].scaling_factor(), reactions.photolysis[i].scaling_factor);
+    ExpectComponent(mapped.photolysis[i].reactants(), reactions.photolysis[i].reactants);
+    ExpectComponents(mapped.photolysis[i].products(), reactions.photolysis[i].products, mechanism);
+  }
+
+  ASSERT_EQ(mapped.surface.size(), reactions.surface.size());
+  for (std::size_t i = 0; i < reactions.surface.size(); ++i)
+  {
+    EXPECT_EQ(mapped.surface[i].reaction_probability(), reactions.surface[i].reaction_probability);
+    EXPECT_EQ(mapped.surface[i].condensed_phase(), reactions.surface[i].condensed_phase);
+    ExpectComponent(mapped.surface[i].gas_phase_species(), reactions.surface[i].gas_phase_species);
+    ExpectComponents(mapped.surface[i].gas_phase_products(), reactions.surface[i].gas_phase_products, mechanism);
+  }
+
+  ASSERT_EQ(mapped.taylor_series.size(), reactions.taylor_series.size());
+  for (std::size_t i = 0; i < reactions.taylor_series.size(); ++i)
+  {
+    const auto& r = reactions.taylor_series[i];
+    const auto m = mapped.taylor_series[i];
+    EXPECT_EQ(m.A(), r.A);
+    EXPECT_EQ(m.E(), r.E);
+    EXPECT_EQ(std::vector<double>(m.taylor_coefficients().begin(), m.taylor_coefficients().end()), r.taylor_coefficients);
+    ExpectComponents(m.reactants(), r.reactants, mechanism);
+  }
+
+  ASSERT_EQ(mapped.troe.size(), reactions.troe.size());
+  for (std::size_t i = 0; i < reactions.troe.size(); ++i)
+  {
+    const auto& r = reactions.troe[i];
+    const auto m = mapped.troe[i];
+    EXPECT_EQ(m.k0_A(), r.k0_A);
+    EXPECT_EQ(m.kinf_C(), r.kinf_C);
+    EXPECT_EQ(m.Fc(), r.Fc);
+    EXPECT_EQ(m.N(), r.N);
+  }
+
+  ASSERT_EQ(mapped.ternary_chemical_activation.size(), reactions.ternary_chemical_activation.size());
+  for (std::size_t i = 0; i < reactions.ternary_chemical_activation.size(); ++i)
+  {
+    EXPECT_EQ(mapped.ternary_chemical_activation[i].k0_B(), reactions.ternary_chemical_activation[i].k0_B);
+    EXPECT_EQ(mapped.ternary_chemical_activation[i].kinf_A(), reactions.ternary_chemical_activation[i].kinf_A);
+  }
+
+  ASSERT_EQ(mapped.tunneling.size(), reactions.tunneling.size());
+  for (std::size_t i = 0; i < reactions.tunneling.size(); ++i)
+  {
+    EXPECT_EQ(mapped.tunneling[i].A(), reactions.tunneling[i].A);
+    EXPECT_EQ(mapped.tunneling[i].B(), reactions.tunneling[i].B);
+    EXPECT_EQ(mapped.tunneling[i].C(), reactions.tunneling[i].C);
+  }
+
+  ASSERT_EQ(mapped.user_defined.size(), reactions.user_defined.size());
+  for (std::size_t i = 0; i < reactions.user_defined.size(); ++i)
+  {
+    EXPECT_EQ(mapped.user_defined[i].scaling_factor(), reactions.user_defined[i].scaling_factor);
+    ExpectComponents(mapped.user_defined[i].reactants(), reactions.user_defined[i].reactants, mechanism);
+  }
+
+  ASSERT_EQ(mapped.lambda_rate_constant.size(), reactions.lambda_rate_constant.size());
+  for (std::size_t i = 0; i < reactions.lambda_rate_constant.size(); ++i)
+  {
+    EXPECT_EQ(mapped.lambda_rate_constant[i].lambda_function(), reactions.lambda_rate_constant[i].lambda_function);
+    ExpectComponents(mapped.lambda_rate_constant[i].products(), reactions.lambda_rate_constant[i].products, mechanism);
+  }
+}
+
+TEST_F(MappedFullConfiguration, CopiesShareTheMapping)
+{
+  std::optional<MappedMechanism> copy;
+  {
+    auto opened = MappedMechanism::Open(dir / "full.mcm");
+    ASSERT_TRUE(opened);
+    copy = *opened;
+  }
+
+  // Replacing the file does not disturb a mapping that is already open.
+  Mechanism renamed = mechanism;
+  renamed.name = "renamed";
+  ASSERT_TRUE(SaveMappedImage(renamed, dir / "full.mcm").empty());
+
+  EXPECT_EQ(copy->name(), mechanism.name);
+  ASSERT_FALSE(copy->reactions().arrhenius.empty());
+  EXPECT_EQ(copy->reactions().arrhenius[0].A(), mechanism.reactions.arrhenius[0].A);
+  EXPECT_EQ(MappedMechanism::Open(dir / "full.mcm")->name(), "renamed");
+}
+
+TEST_F(MappedFullConfiguration, RejectsMissingAndCorruptImages)
+{
+  auto missing = MappedMechanism::Open(dir / "missing.mcm");
+  ASSERT_FALSE(missing);
+  EXPECT_EQ(missing.error()[0].first, ErrorCode::FileNotFound);
+
+  WriteBytes(dir / "empty.mcm", "");
+  EXPECT_FALSE(MappedMechanism::Open(dir / "empty.mcm"));
+
+  const std::string image = ReadBytes(dir / "full.mcm");
+
+  for (std::size_t size = 0; size < image.size(); size += 1 + image.size() / 61)
+  {
+    WriteBytes(dir / "truncated.mcm", image.substr(0, size));
+    EXPECT_FALSE(MappedMechanism::Open(dir / "truncated.mcm")) << "truncated to " << size << " bytes";
+  }
+
+  // The format version follows the 8-byte magic.
+  std::string other_version = image;
+  other_version[8] = 0x7f;
+  WriteBytes(dir / "other_version.mcm", other_version);
+  auto version = MappedMechanism::Open(dir / "other_version.mcm");
+  ASSERT_FALSE(version);
+  EXPECT_EQ(version.error()[0].first, ErrorCode::InvalidVersion);
+
+  // The string array's element count sits at byte 64 of the header; an image whose strings run
+  // past the end of the file is rejected rather than read out of bounds.
+  std::string out_of_bounds = image;
+  std::memset(out_of_bounds.data() + 64, 0xff, 8);
+  WriteBytes(dir / "out_of_bounds.mcm", out_of_bounds);
+  auto corrupt = MappedMechanism::Open(dir / "out_of_bounds.mcm");
+  ASSERT_FALSE(corrupt);
+  EXPECT_EQ(corrupt.error()[0].first, ErrorCode::UnexpectedError);
+}
@@ -0,0 +1,191 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/parse.hpp>
+#include <mechanism_configuration/parse_stats.hpp>
+#include <mechanism_configuration/synthetic.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  std::filesystem::path WriteMechanism(const std::string& name, const SyntheticOptions& options)
+  {
+    const auto directory = std::filesystem::temp_directory_path() / ("mc_parse_stats_" + name);
+    std::filesystem::remove_all(directory);
+    auto path = WriteSyntheticMechanism(options, directory);
+    EXPECT_TRUE(path);
+    return path ? *path : std::filesystem::path{};
+  }
+
+  std::vector<ParseStageStats> StagesOf(const ParseStats& stats, ParseStage stage)
+  {
+    std::vector<ParseStageStats> stages;
+    for (const auto& reported : stats.Stages())
+      if (reported.stage == stage)
+        stages.push_back(reported);
+    return stages;
+  }
+
+  // Every file in the directory of `path`
+  std::set<std::filesystem::path> FilesBeside(const std::filesystem::path& path)
+  {
+    std::set<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(path.parent_path()))
+      files.insert(entry.path());
+    return files;
+  }
+}  // namespace
+
+TEST(ParseStats, ReportsEveryFileAndStageOfAVersion1Configuration)
+{
+  const auto path = WriteMechanism("v1", { .files = 3, .seed = 1, .species = 10, .reactions = { .arrhenius = 30 } });
+  for (const bool parallel : { false, true })
+  {
+    ParseStats stats;
+    const auto parsed = Parse(path, { .parallel_file_loading = parallel, .observer = &stats });
+    ASSERT_TRUE(parsed);
+
+    std::set<std::filesystem::path> read;
+    for (const auto& stage : StagesOf(stats, ParseStage::ReadFile))
+    {
+      EXPECT_EQ(stage.bytes, std::filesystem::file_size(stage.file));
+      read.insert(stage.file);
+    }
+    EXPECT_EQ(read, FilesBeside(path));
+    EXPECT_EQ(StagesOf(stats, ParseStage::LoadDocument).size(), read.size());
+
+    for (const ParseStage stage :
+         { ParseStage::ResolveFiles, ParseStage::CheckSchema, ParseStage::ValidateSemantics, ParseStage::Build })
+    {
+      const auto stages = StagesOf(stats, stage);
+      ASSERT_EQ(stages.size(), 1) << ParseStageToString(stage);
+      EXPECT_EQ(stages[0].file, path);
+    }
+    // The document is checked and built after its files are merged into it
+    const auto build = StagesOf(stats, ParseStage::Build)[0];
+    EXPECT_GT(build.nodes, 30);
+    EXPECT_EQ(stats.Stages().back().stage, ParseStage::Build);
+#ifndef _WIN32
+    EXPECT_GT(build.peak_memory_bytes, 0);
+#endif
+  }
+  std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(ParseStats, ReportsStreamedReactions)
+{
+  const auto path = WriteMechanism("stream", { .seed = 2, .species = 10, .reactions = { .arrhenius = 20, .troe = 5 } });
+  ParseStats stats;
+  ParseStats whole;
+  ASSERT_TRUE(Parse(path, { .stream_reactions = true, .observer = &stats }));
+  ASSERT_TRUE(Parse(path, { .observer = &whole }));
+
+  const auto streamed = StagesOf(stats, ParseStage::StreamReactions);
+  ASSERT_EQ(streamed.size(), 1);
+  EXPECT_EQ(streamed[0].file, path);
+  EXPECT_EQ(streamed[0].nodes, 25);
+  EXPECT_EQ(streamed[0].bytes, std::filesystem::file_size(path));
+  // Only the rest of the document is loaded
+  const auto loaded = StagesOf(stats, ParseStage::LoadDocument);
+  ASSERT_EQ(loaded.size(), 1);
+  EXPECT_LT(loaded[0].nodes, StagesOf(whole, ParseStage::LoadDocument).at(0).nodes);
+  EXPECT_TRUE(StagesOf(whole, ParseStage::StreamReactions).empty());
+  std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(ParseStats, ReadsAFileThatCannotBeStreamedOnce)
+{
+  const auto path =
+      WriteMechanism("unstreamed", { .version = 0, .seed = 4, .species = 10, .reactions = { .arrhenius = 10 } });
+  ParseStats stats;
+  ASSERT_TRUE(Parse(path, { .stream_reactions = true, .observer = &stats }));
+
+  std::size_t reads = 0;
+  for (const auto& stage : StagesOf(stats, ParseStage::ReadFile))
+    reads += stage.file == path;
+  EXPECT_EQ(reads, 1);
+  EXPECT_TRUE(StagesOf(stats, ParseStage::StreamReactions).empty());
+  std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(ParseStats, ReportsEachVersion0CampFile)
+{
+  const auto path =
+      WriteMechanism("v0", { .version = 0, .files = 3, .seed = 3, .species = 10, .reactions = { .arrhenius = 30 } });
+  ParseStats stats;
+  ASSERT_TRUE(Parse(path.parent_path(), { .observer = &stats }));
+
+  std::set<std::filesystem::path> read;
+  for (const auto& stage : StagesOf(stats, ParseStage::ReadFile))
+    read.insert(stage.file);
+  EXPECT_EQ(read, FilesBeside(path));
+
+  const auto built = StagesOf(stats, ParseStage::Build);
+  EXPECT_EQ(built.size(), read.size() - 1);  // every file but the camp-files list
+  for (const auto& stage : built)
+  {
+    EXPECT_NE(stage.file, path);
+    EXPECT_GT(stage.nodes, 0);
+  }
+  EXPECT_GT(stats.WallTime(ParseStage::Build).count(), 0);
+  std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(ParseStats, ObservingDoesNotChangeTheResult)
+{
+  const std::string config = R"(
+version: 1.0.0
+name: observed
+species: [ { name: A }, { name: B } ]
+phases: [ { name: gas, species: [ A, B ] } ]
+reactions: [ { type: ARRHENIUS, gas phase: gas, reactants: [ { name: A } ], products: [ { name: C } ] } ]
+)";
+  ParseStats stats;
+  const auto plain = ParseFromString(config);
+  const auto observed = ParseFromString(config, { .observer = &stats });
+  ASSERT_FALSE(plain);
+  ASSERT_FALSE(observed);
+  EXPECT_EQ(plain.error(), observed.error());
+
+  // The document is loaded once, and a failed check is the last stage reported
+  std::vector<ParseStage> stages;
+  for (const auto& stage : stats.Stages())
+  {
+    stages.push_back(stage.stage);
+    EXPECT_TRUE(stage.file.empty());
+  }
+  EXPECT_EQ(
+      stages,
+      (std::vector<ParseStage>{ ParseStage::LoadDocument, ParseStage::CheckSchema, ParseStage::ValidateSemantics }));
+}
+
+TEST(ParseStats, ParseFromStringLoadsAV1DocumentOnce)
+{
+  const std::string config = R"(
+version: 1.0.0
+name: loaded once
+species: [ { name: A }, { name: B } ]
+phases: [ { name: gas, species: [ A, B ] } ]
+reactions: [ { type: ARRHENIUS, gas phase: gas, reactants: [ { name: A } ], products: [ { name: B } ] } ]
+)";
+  ParseStats stats;
+  const auto parsed = ParseFromString(config, { .observer = &stats });
+  ASSERT_TRUE(parsed);
+  EXPECT_EQ(parsed->reactions.arrhenius.size(), 1);
+
+  // The node loaded to check the version is the one the v1 parser builds from
+  const auto loaded = StagesOf(stats, ParseStage::LoadDocument);
+  ASSERT_EQ(loaded.size(), 1);
+  EXPECT_EQ(loaded.front().bytes, config.size());
+}
@@ -0,0 +1,287 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/parse.hpp>
+#include <mechanism_configuration/rate_constants.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  constexpr double AVOGADRO = 6.02214076e23;
+
+  // Straightforward transcriptions of the documented formulas
+
+  double Arrhenius(const types::Arrhenius& r, double T, double P)
+  {
+    return r.A * std::exp(r.C / T) * std::pow(T / r.D, r.B) * (1.0 + r.E * P);
+  }
+
+  double TaylorSeries(const types::TaylorSeries& r, double T, double P)
+  {
+    double series = 0.0;
+    for (std::size_t i = 0; i < r.taylor_coefficients.size(); ++i)
+      series += r.taylor_coefficients[i] * std::pow(T, static_cast<double>(i));
+    return series * r.A * std::exp(r.C / T) * std::pow(T / r.D, r.B) * (1.0 + r.E * P);
+  }
+
+  template<typename Falloff>
+  double FalloffRate(const Falloff& r, double T, double M, bool troe)
+  {
+    const double k0 = r.k0_A * std::exp(r.k0_C / T) * std::pow(T / 300.0, r.k0_B);
+    const double kinf = r.kinf_A * std::exp(r.kinf_C / T) * std::pow(T / 300.0, r.kinf_B);
+    const double leading = troe ? k0 * M : k0;
+    return leading / (1.0 + k0 * M / kinf) *
+           std::pow(r.Fc, 1.0 / (1.0 + 1.0 / r.N * std::pow(std::log10(k0 * M / kinf), 2.0)));
+  }
+
+  double Tunneling(const types::Tunneling& r, double T)
+  {
+    return r.A * std::exp(-r.B / T + r.C / (T * T * T));
+  }
+
+  double BranchedA(int n, double T, double M)
+  {
+    const double k0M = 2.0e-22 * std::exp(n) * M * AVOGADRO * 1.0e-6;
+    const double ratio = k0M / (0.43 * std::pow(T / 298.0, -8.0));
+    return k0M / (1.0 + ratio) * std::pow(0.41, 1.0 / (1.0 + std::pow(std::log10(ratio), 2.0)));
+  }
+
+  double NitrateFraction(const types::Branched& r, double T, double M)
+  {
+    const double Z = BranchedA(r.n, 293.0, 2.45e19 / (AVOGADRO * 1.0e-6)) * (1.0 - r.a0) / r.a0;
+    const double A = BranchedA(r.n, T, M);
+    return A / (A + Z);
+  }
+
+  void ExpectClose(double actual, double expected)
+  {
+    EXPECT_NEAR(actual, expected, 1.0e-12 * std::abs(expected) + 1.0e-300);
+  }
+
+  struct Conditions
+  {
+    std::vector<double> temperature;
+    std::vector<double> pressure;
+    std::vector<double> air_density;
+
+    // Spans 180-330 K over more cells than one evaluation block.
+    explicit Conditions(std::size_t cells)
+    {
+      for (std::size_t c = 0; c < cells; ++c)
+      {
+        temperature.push_back(180.0 + 150.0 * static_cast<double>(c) / static_cast<double>(cells));
+        pressure.push_back(1.0e4 + 90.0 * static_cast<double>(c));
+        air_density.push_back(pressure.back() / (8.314462618 * temperature.back()));
+      }
+    }
+  };
+}  // namespace
+
+TEST(RateConstantEngine, MatchesDocumentedFormulas)
+{
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  types::Reactions& reactions = parsed->reactions;
+  ASSERT_FALSE(reactions.branched.empty());
+  ASSERT_FALSE(reactions.troe.empty());
+  ASSERT_FALSE(reactions.ternary_chemical_activation.empty());
+  ASSERT_EQ(reactions.lambda_rate_constant.size(), 1);
+  // Exercise every term of the Arrhenius form.
+  reactions.arrhenius.push_back({ .A = 3.2e-11, .B = -1.3, .C = -250.0, .D = 280.0, .E = 2.0e-6 });
+
+  const RateConstantEngine engine(*parsed);
+  const ReactionOrder& order = engine.order();
+  const Conditions conditions(700);
+  const std::size_t cells = conditions.temperature.size();
+  std::vector<double> k(order.size * cells, -1.0);
+  engine.Evaluate(conditions.temperature, conditions.pressure, conditions.air_density, k);
+
+  for (std::size_t c = 0; c < cells; ++c)
+  {
+    const double T = conditions.temperature[c];
+    const double P = conditions.pressure[c];
+    const double M = conditions.air_density[c];
+    for (std::size_t i = 0; i < reactions.arrhenius.size(); ++i)
+      ExpectClose(k[(order.arrhenius + i) * cells + c], Arrhenius(reactions.arrhenius[i], T, P));
+    for (std::size_t i = 0; i < reactions.branched.size(); ++i)
+    {
+      const auto& r = reactions.branched[i];
+      ExpectClose(k[(order.branched + i) * cells + c], r.X * std::exp(-r.Y / T));
+    }
+    for (std::size_t i = 0; i < reactions.taylor_series.size(); ++i)
+      ExpectClose(k[(order.taylor_series + i) * cells + c], TaylorSeries(reactions.taylor_series[i], T, P));
+    for (std::size_t i = 0; i < reactions.troe.size(); ++i)
+      ExpectClose(k[(order.troe + i) * cells + c], FalloffRate(reactions.troe[i], T, M, true));
+    for (std::size_t i = 0; i < reactions.ternary_chemical_activation.size(); ++i)
+      ExpectClose(
+          k[(order.ternary_chemical_activation + i) * cells + c],
+          FalloffRate(reactions.ternary_chemical_activation[i], T, M, false));
+    for (std::size_t i = 0; i < reactions.tunneling.size(); ++i)
+      ExpectClose(k[(order.tunneling + i) * cells + c], Tunneling(reactions.tunneling[i], T));
+    // [](double T, double P) { return 1.2e-5 * exp(-500.0 / T); }
+    ExpectClose(k[order.lambda_rate_constant * cells + c], 1.2e-5 * std::exp(-500.0 / T));
+    // Rates supplied by the host model are not written.
+    for (std::size_t i = 0; i < reactions.photolysis.size(); ++i)
+      EXPECT_EQ(k[(order.photolysis + i) * cells + c], -1.0);
+  }
+
+  std::vector<double> fractions(reactions.branched.size() * cells);
+  engine.EvaluateNitrateFractions(conditions.temperature, conditions.air_density, fractions);
+  for (std::size_t i = 0; i < reactions.branched.size(); ++i)
+    for (std::size_t c = 0; c < cells; c += 37)
+      EXPECT_NEAR(
+          fractions[i * cells + c],
+          NitrateFraction(reactions.branched[i], conditions.temperature[c], conditions.air_density[c]),
+          1.0e-12);
+}
+
+TEST(RateConstantEngine, TaylorSeriesScalesTheArrheniusRate)
+{
+  // At T = D = 300 K, P = 1e5 Pa: Σ C_i T^i = 1 + 0.5·300 + 0.01·300² = 1051, and
+  // A e^(C/T) (T/D)^B (1 + E P) = 2 e^-1 · 1 · 2, so k = 1051 · 4 / e
+  Mechanism mechanism;
+  mechanism.reactions.taylor_series = {
+    { .A = 2.0, .B = 1.5, .C = -300.0, .D = 300.0, .E = 1.0e-5, .taylor_coefficients = { 1.0, 0.5, 0.01 } }
+  };
+  const RateConstantEngine engine(mechanism);
+  std::vector<double> k(1);
+  engine.Evaluate(std::vector<double>{ 300.0 }, std::vector<double>{ 1.0e5 }, std::vector<double>{ 40.0 }, k);
+  ExpectClose(k[0], 1546.5651706847436);
+}
+
+TEST(RateConstantEngine, RejectsMismatchedArrays)
+{
+  Mechanism mechanism;
+  mechanism.reactions.arrhenius.resize(2);
+  const RateConstantEngine engine(mechanism);
+  const Conditions conditions(4);
+  std::vector<double> k(8);
+  EXPECT_NO_THROW(engine.Evaluate(conditions.temperature, conditions.pressure, conditions.air_density, k));
+  EXPECT_EQ(k[0], 1.0);
+
+  std::vector<double> short_output(7);
+  EXPECT_THROW(
+      engine.Evaluate(conditions.temperature, conditions.pressure, conditions.air_density, short_output),
+      std::invalid_argument);
+  const std::vector<double> short_pressure(3, 1.0e5);
+  EXPECT_THROW(
+      engine.Evaluate(conditions.temperature, short_pressure, conditions.air_density, k), std::invalid_argument);
+}
+
+TEST(RateConstantEngine, RejectsInvalidLambdaFunction)
+{
+  Mechanism mechanism;
+  mechanism.reactions.lambda_rate_constant.push_back({ .lambda_function = "[](double T) { return T +; }" });
+  EXPECT_THROW(RateConstantEngine{ mechanism }, std::invalid_argument);
+}
+
+TEST(RateConstantEngine, SpecializedKernelsMatchFullFormula)
+{
+  // Every combination of active terms
+  Mechanism mechanism;
+  for (unsigned terms = 0; terms < 8; ++terms)
+  {
+    const double B = (terms & 1) ? -1.3 : 0.0;
+    const double C = (terms & 2) ? -250.0 : 0.0;
+    const double E = (terms & 4) ? 2.0e-6 : 0.0;
+    mechanism.reactions.arrhenius.push_back({ .A = 1.0e-11 * (terms + 1), .B = B, .C = C, .D = 280.0, .E = E });
+    mechanism.reactions.troe.push_back({ .k0_A = 1.2e-4,
+                                         .k0_B = B,
+                                         .k0_C = C,
+                                         .kinf_A = 2.0e-1,
+                                         .kinf_B = B / 2,
+                                         .kinf_C = C / 2,
+                                         .Fc = (terms & 4) ? 0.6 : 1.0 });
+    mechanism.reactions.ternary_chemical_activation.push_back(
+        { .k0_A = 3.0e-4, .k0_B = B, .k0_C = C, .kinf_A = 1.0e-1, .Fc = (terms & 4) ? 0.45 : 1.0, .N = 1.2 });
+    if (terms < 4)
+      mechanism.reactions.tunneling.push_back(
+          { .A = 5.0e-12, .B = (terms & 1) ? 100.0 : 0.0, .C = (terms & 2) ? 1.0e7 : 0.0 });
+  }
+
+  const RateConstantEngine specialized(mechanism);
+  const RateConstantEngine full(mechanism, { .specialize_kernels = false });
+  const Conditions conditions(300);
+  const std::size_t size = specialized.order().size * conditions.temperature.size();
+  std::vector<double> expected(size), actual(size);
+  full.Evaluate(conditions.temperature, conditions.pressure, conditions.air_density, expected);
+  specialized.Evaluate(conditions.temperature, conditions.pressure, conditions.air_density, actual);
+  for (std::size_t i = 0; i < size; ++i)
+    ExpectClose(actual[i], expected[i]);
+
+  // A rate with no active terms is its pre-exponential factor in every cell.
+  const std::size_t cells = conditions.temperature.size();
+  for (std::size_t c = 0; c < cells; ++c)
+    EXPECT_EQ(actual[c], 1.0e-11);
+}
+
+TEST(RateConstantEngine, TablesMatchFullFormulaWithinReportedError)
+{
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  const std::size_t falloff = parsed->reactions.troe.size() + parsed->reactions.ternary_chemical_activation.size();
+  const RateConstantEngine full(*parsed);
+  const Conditions conditions(700);
+  const std::size_t size = full.order().size * conditions.temperature.size();
+  std::vector<double> expected(size);
+  full.Evaluate(conditions.temperature, conditions.pressure, conditions.air_density, expected);
+
+  double linear_error = 0.0;
+  for (auto interpolation : { RateTableInterpolation::Linear, RateTableInterpolation::Cubic })
+  {
+    RateConstantOptions options;
+    options.tables.enabled = true;
+    options.tables.interpolation = interpolation;
+    const RateConstantEngine tabulated(*parsed, options);
+    ASSERT_EQ(tabulated.table_errors().size(), falloff);
+    double largest_error = 0.0;
+    for (const auto& error : tabulated.table_errors())
+      largest_error = std::max(largest_error, error.max_relative_error);
+    if (interpolation == RateTableInterpolation::Linear)
+    {
+      EXPECT_LT(largest_error, 1.0e-2);
+      linear_error = largest_error;
+    }
+    else
+      EXPECT_LT(largest_error, linear_error);
+
+    std::vector<double> actual(size);
+    tabulated.Evaluate(conditions.temperature, conditions.pressure, conditions.air_density, actual);
+    for (std::size_t i = 0; i < size; ++i)
+      EXPECT_NEAR(actual[i], expected[i], 2.0 * largest_error * std::abs(expected[i]));
+  }
+}
+
+TEST(RateConstantEngine, TablesFallBackOutsideTheirRange)
+{
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  RateConstantOptions options;
+  options.tables.enabled = true;
+  options.tables.max_temperature = 250.0;
+  const RateConstantEngine tabulated(*parsed, options);
+  const RateConstantEngine full(*parsed);
+
+  // Past the tables' maximum temperature, the full formula gives every rate.
+  Conditions conditions(50);
+  for (double& T : conditions.temperature)
+    T += 100.0;
+  const std::size_t size = full.order().size * conditions.temperature.size();
+  std::vector<double> expected(size), actual(size);
+  full.Evaluate(conditions.temperature, conditions.pressure, conditions.air_density, expected);
+  tabulated.Evaluate(conditions.temperature, conditions.pressure, conditions.air_density, actual);
+  for (std::size_t i = 0; i < size; ++i)
+    EXPECT_EQ(actual[i], expected[i]);
+
+  options.tables.min_temperature = 300.0;
+  EXPECT_THROW(RateConstantEngine(*parsed, options), std::invalid_argument);
+}
@@ -0,0 +1,145 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/parse.hpp>
+#include <mechanism_configuration/rate_parameters.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  template<typename T>
+  bool IsAligned(std::span<const T> array)
+  {
+    return reinterpret_cast<std::uintptr_t>(array.data()) % RATE_PARAMETER_ALIGNMENT == 0;
+  }
+}  // namespace
+
+TEST(ReactionOrder, PlacesTypesInMemberOrder)
+{
+  types::Reactions reactions;
+  reactions.arrhenius.resize(3);
+  reactions.branched.resize(1);
+  reactions.troe.resize(2);
+  reactions.lambda_rate_constant.resize(1);
+
+  const ReactionOrder order(reactions);
+  EXPECT_EQ(order.arrhenius, 0);
+  EXPECT_EQ(order.branched, 3);
+  EXPECT_EQ(order.taylor_series, 4);
+  EXPECT_EQ(order.troe, 4);
+  EXPECT_EQ(order.ternary_chemical_activation, 6);
+  EXPECT_EQ(order.lambda_rate_constant, 6);
+  EXPECT_EQ(order.size, 7);
+}
+
+TEST(ExportRateParameters, MatchesReactions)
+{
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  const types::Reactions& reactions = parsed->reactions;
+  const ReactionOrder order(reactions);
+  const RateParameters parameters = ExportRateParameters(*parsed);
+
+  ASSERT_EQ(parameters.arrhenius.size(), reactions.arrhenius.size());
+  ASSERT_FALSE(reactions.arrhenius.empty());
+  EXPECT_TRUE(IsAligned(parameters.arrhenius.A));
+  EXPECT_TRUE(IsAligned(parameters.arrhenius.E));
+  for (std::size_t i = 0; i < reactions.arrhenius.size(); ++i)
+  {
+    const auto& r = reactions.arrhenius[i];
+    EXPECT_EQ(parameters.arrhenius.A[i], r.A);
+    EXPECT_EQ(parameters.arrhenius.B[i], r.B);
+    EXPECT_EQ(parameters.arrhenius.C[i], r.C);
+    EXPECT_EQ(parameters.arrhenius.D[i], r.D);
+    EXPECT_EQ(parameters.arrhenius.E[i], r.E);
+    EXPECT_EQ(parameters.arrhenius.reaction_index[i], order.arrhenius + i);
+  }
+
+  ASSERT_EQ(parameters.taylor_series.size(), reactions.taylor_series.size());
+  ASSERT_FALSE(reactions.taylor_series.empty());
+  for (std::size_t i = 0; i < reactions.taylor_series.size(); ++i)
+  {
+    const auto& r = reactions.taylor_series[i];
+    EXPECT_EQ(parameters.taylor_series.A[i], r.A);
+    EXPECT_EQ(parameters.taylor_series.D[i], r.D);
+    const auto& offsets = parameters.taylor_series.taylor_coefficient_offsets;
+    const auto coefficients = parameters.taylor_series.taylor_coefficients.subspan(offsets[i], offsets[i + 1] - offsets[i]);
+    EXPECT_EQ(std::vector<double>(coefficients.begin(), coefficients.end()), r.taylor_coefficients);
+    EXPECT_EQ(parameters.taylor_series.reaction_index[i], order.taylor_series + i);
+  }
+
+  ASSERT_EQ(parameters.troe.size(), reactions.troe.size());
+  ASSERT_FALSE(reactions.troe.empty());
+  EXPECT_TRUE(IsAligned(parameters.troe.N));
+  for (std::size_t i = 0; i < reactions.troe.size(); ++i)
+  {
+    const auto& r = reactions.troe[i];
+    EXPECT_EQ(parameters.troe.k0_A[i], r.k0_A);
+    EXPECT_EQ(parameters.troe.kinf_C[i], r.kinf_C);
+    EXPECT_EQ(parameters.troe.Fc[i], r.Fc);
+    EXPECT_EQ(parameters.troe.N[i], r.N);
+    EXPECT_EQ(parameters.troe.reaction_index[i], order.troe + i);
+  }
+
+  ASSERT_EQ(parameters.ternary_chemical_activation.size(), reactions.ternary_chemical_activation.size());
+  for (std::size_t i = 0; i < reactions.ternary_chemical_activation.size(); ++i)
+  {
+    const auto& r = reactions.ternary_chemical_activation[i];
+    EXPECT_EQ(parameters.ternary_chemical_activation.k0_B[i], r.k0_B);
+    EXPECT_EQ(parameters.ternary_chemical_activation.kinf_A[i], r.kinf_A);
+    EXPECT_EQ(parameters.ternary_chemical_activation.reaction_index[i], order.ternary_chemical_activation + i);
+  }
+
+  ASSERT_EQ(parameters.tunneling.size(), reactions.tunneling.size());
+  ASSERT_FALSE(reactions.tunneling.empty());
+  EXPECT_TRUE(IsAligned(parameters.tunneling.C));
+  for (std::size_t i = 0; i < reactions.tunneling.size(); ++i)
+  {
+    const auto& r = reactions.tunneling[i];
+    EXPECT_EQ(parameters.tunneling.A[i], r.A);
+    EXPECT_EQ(parameters.tunneling.B[i], r.B);
+    EXPECT_EQ(parameters.tunneling.C[i], r.C);
+    EXPECT_EQ(parameters.tunneling.reaction_index[i], order.tunneling + i);
+  }
+}
+
+TEST(ExportRateParameters, PadsArraysWithZeros)
+{
+  Mechanism mechanism;
+  mechanism.reactions.arrhenius.resize(3, types::Arrhenius{ .A = 2.0 });
+  const RateParameters parameters = ExportRateParameters(mechanism);
+
+  // The padding after the last element is readable and zero, up to the next aligned boundary.
+  const double* A = parameters.arrhenius.A.data();
+  EXPECT_EQ(A[2], 2.0);
+  for (std::size_t i = 3; i < RATE_PARAMETER_ALIGNMENT / sizeof(double); ++i)
+    EXPECT_EQ(A[i], 0.0);
+  EXPECT_EQ(parameters.arrhenius.B.data(), A + RATE_PARAMETER_ALIGNMENT / sizeof(double));
+}
+
+TEST(ExportRateParameters, SurvivesMove)
+{
+  Mechanism mechanism;
+  mechanism.reactions.tunneling.resize(2, types::Tunneling{ .A = 4.0, .B = 5.0, .C = 6.0 });
+  RateParameters exported = ExportRateParameters(mechanism);
+  const RateParameters parameters = std::move(exported);
+  ASSERT_EQ(parameters.tunneling.size(), 2);
+  EXPECT_EQ(parameters.tunneling.C[1], 6.0);
+  EXPECT_EQ(parameters.tunneling.reaction_index[1], 1);
+}
+
+TEST(ExportRateParameters, EmptyMechanism)
+{
+  const RateParameters parameters = ExportRateParameters(Mechanism{});
+  EXPECT_EQ(parameters.arrhenius.size(), 0);
+  EXPECT_EQ(parameters.troe.size(), 0);
+  ASSERT_EQ(parameters.taylor_series.taylor_coefficient_offsets.size(), 1);
+  EXPECT_EQ(parameters.taylor_series.taylor_coefficient_offsets[0], 0);
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/schema.hpp"
+
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+TEST(Schema, AcceptsConformingObjects)
+{
+  const Schema schema({ "type", "name" }, { "A", "B" }, { { "x", "y" } });
+  EXPECT_TRUE(schema.Check(YAML::Load("{ type: T, name: n, x: 1 }")).empty());
+  EXPECT_TRUE(schema.Check(YAML::Load("{ type: T, name: n, A: 1, B: 2, y: 3, __comment: c }")).empty());
+}
+
+TEST(Schema, ReportsErrorsInKeyOrder)
+{
+  const Schema schema({ "type", "name", "gas phase" }, { "A" }, { { "x", "y" } });
+  const Errors errors = schema.Check(YAML::Load("{ zeta: 1, A: 1, alpha: 2, x: 1, y: 2 }"));
+  ASSERT_EQ(errors.size(), 6);
+  const std::vector<std::pair<ErrorCode, std::string_view>> expected = {
+    { ErrorCode::RequiredKeyNotFound, "'gas phase'" },
+    { ErrorCode::RequiredKeyNotFound, "'name'" },
+    { ErrorCode::RequiredKeyNotFound, "'type'" },
+    { ErrorCode::MutuallyExclusiveOption, "'x', 'y'" },
+    { ErrorCode::InvalidKey, "'alpha'" },
+    { ErrorCode::InvalidKey, "'zeta'" },
+  };
+  for (std::size_t i = 0; i < errors.size(); ++i)
+  {
+    EXPECT_EQ(errors[i].first, expected[i].first) << errors[i].second;
+    EXPECT_NE(errors[i].second.find(expected[i].second), std::string::npos) << errors[i].second;
+  }
+
+  const Errors none_of_group = schema.Check(YAML::Load("{ type: T, name: n, gas phase: g }"));
+  ASSERT_EQ(none_of_group.size(), 1);
+  EXPECT_EQ(none_of_group[0].first, ErrorCode::RequiredKeyNotFound);
+}
+
+TEST(Schema, RejectsNullObjects)
+{
+  const Schema schema({ "name" }, {});
+  const Errors errors = schema.Check(YAML::Node());
+  ASSERT_EQ(errors.size(), 1);
+  EXPECT_EQ(errors[0].first, ErrorCode::EmptyObject);
+}
+
+TEST(Schema, DistinguishesEveryKeyOfALargeSchema)
+{
+  std::vector<std::string> names;
+  for (std::size_t i = 0; i < Schema::MAX_KEYS; ++i)
+    names.push_back("key " + std::to_string(i));
+  const std::vector<std::string_view> keys(names.begin(), names.end());
+  const Schema schema(keys, {});
+
+  YAML::Node object;
+  for (const auto& name : names)
+    object[name] = 1;
+  EXPECT_TRUE(schema.Check(object).empty());
+  object["key 64"] = 1;
+  object.remove("key 0");
+  const Errors errors = schema.Check(object);
+  ASSERT_EQ(errors.size(), 2);
+  EXPECT_EQ(errors[0].first, ErrorCode::RequiredKeyNotFound);
+  EXPECT_EQ(errors[1].first, ErrorCode::InvalidKey);
+
+  names.push_back("one too many");
+  const std::vector<std::string_view> too_many(names.begin(), names.end());
+  EXPECT_THROW(Schema(too_many, {}), std::invalid_argument);
+}
@@ -0,0 +1,177 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/parse.hpp>
+#include <mechanism_configuration/rate_constants.hpp>
+#include <mechanism_configuration/stoichiometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  using Entries = std::map<std::pair<std::size_t, std::size_t>, double>;
+
+  // (row, column) -> value of a matrix read by rows
+  Entries ByRows(const CompressedMatrix& matrix)
+  {
+    Entries entries;
+    for (std::size_t row = 0; row + 1 < matrix.offsets.size(); ++row)
+    {
+      for (std::size_t k = matrix.offsets[row]; k < matrix.offsets[row + 1]; ++k)
+      {
+        if (k > matrix.offsets[row])
+          EXPECT_LT(matrix.indices[k - 1], matrix.indices[k]);
+        entries[{ row, matrix.indices[k] }] = matrix.values[k];
+      }
+    }
+    return entries;
+  }
+
+  // (row, column) -> value of a matrix read by columns
+  Entries ByColumns(const CompressedMatrix& matrix)
+  {
+    Entries entries;
+    for (const auto& [position, value] : ByRows(matrix))
+      entries[{ position.second, position.first }] = value;
+    return entries;
+  }
+
+  types::ReactionComponent Component(const std::string& name, double coefficient = 1.0)
+  {
+    return { .name = name, .coefficient = coefficient };
+  }
+
+  Mechanism SmallMechanism()
+  {
+    Mechanism mechanism;
+    mechanism.species = { { .name = "A" }, { .name = "B" }, { .name = "C" } };
+    // 0: A + A + B -> B + 2 C
+    mechanism.reactions.arrhenius.push_back(
+        { .reactants = { Component("A"), Component("A"), Component("B") },
+          .products = { Component("B"), Component("C", 2.0) } });
+    // 1: A -> 0.3 B + 0.7 C
+    mechanism.reactions.branched.push_back(
+        { .reactants = { Component("A") },
+          .nitrate_products = { Component("B", 0.3) },
+          .alkoxy_products = { Component("C", 0.7) } });
+    // 2: -> C
+    mechanism.reactions.emission.push_back({ .products = { Component("C") } });
+    // 3: B -> A
+    mechanism.reactions.surface.push_back({ .gas_phase_species = Component("B"), .gas_phase_products = { Component("A") } });
+    AssignIndices(mechanism);
+    return mechanism;
+  }
+}  // namespace
+
+TEST(BuildStoichiometry, MergesAndOrdersEntries)
+{
+  auto result = BuildStoichiometry(SmallMechanism());
+  ASSERT_TRUE(result) << result.error().front().second;
+  const Stoichiometry& s = *result;
+  EXPECT_EQ(s.species, 3);
+  EXPECT_EQ(s.order.size, 4);
+  EXPECT_EQ(s.order.surface, 3);
+
+  const Entries reactants{ { { 0, 0 }, 2.0 }, { { 1, 0 }, 1.0 }, { { 0, 1 }, 1.0 }, { { 1, 3 }, 1.0 } };
+  EXPECT_EQ(ByRows(s.reactants.by_species), reactants);
+  EXPECT_EQ(ByColumns(s.reactants.by_reaction), reactants);
+
+  // B is a catalyst in reaction 0, so it has no net entry there. The branched reaction's
+  // products are in their own matrices.
+  const Entries net{ { { 0, 0 }, -2.0 }, { { 2, 0 }, 2.0 }, { { 0, 1 }, -1.0 },
+                     { { 2, 2 }, 1.0 },  { { 1, 3 }, -1.0 }, { { 0, 3 }, 1.0 } };
+  EXPECT_EQ(ByRows(s.net.by_species), net);
+  EXPECT_EQ(ByColumns(s.net.by_reaction), net);
+  EXPECT_EQ(s.net.by_species.offsets.size(), 4);
+  EXPECT_EQ(s.net.by_reaction.offsets.size(), 5);
+
+  const Entries nitrate{ { { 1, 0 }, 0.3 } };
+  const Entries alkoxy{ { { 2, 0 }, 0.7 } };
+  EXPECT_EQ(ByRows(s.nitrate_products.by_species), nitrate);
+  EXPECT_EQ(ByColumns(s.nitrate_products.by_reaction), nitrate);
+  EXPECT_EQ(ByRows(s.alkoxy_products.by_species), alkoxy);
+  EXPECT_EQ(ByColumns(s.alkoxy_products.by_reaction), alkoxy);
+  EXPECT_EQ(s.nitrate_products.by_reaction.offsets.size(), 2);
+}
+
+TEST(BuildStoichiometry, BranchedReactionsFollowTheirBranchRates)
+{
+  Mechanism mechanism = SmallMechanism();
+  types::Branched& branched = mechanism.reactions.branched[0];
+  branched.X = 1.2e-12;
+  branched.Y = -500.0;
+  branched.a0 = 0.15;
+  branched.n = 9;
+  auto result = BuildStoichiometry(mechanism);
+  ASSERT_TRUE(result) << result.error().front().second;
+  const Stoichiometry& s = *result;
+
+  const std::vector<double> temperature{ 280.0 };
+  const std::vector<double> pressure{ 90000.0 };
+  const std::vector<double> air_density{ 38.0 };
+  const RateConstantEngine engine(mechanism);
+  std::vector<double> k(s.order.size, 0.0);
+  std::vector<double> fraction(1);
+  engine.Evaluate(temperature, pressure, air_density, k);
+  engine.EvaluateNitrateFractions(temperature, air_density, fraction);
+
+  // Each branch forms its own products at its own rate, and both consume A
+  const double total = k[s.order.branched];
+  const double nitrate_rate = fraction[0] * total;
+  const double alkoxy_rate = (1.0 - fraction[0]) * total;
+  ASSERT_GT(nitrate_rate, 0.0);
+  ASSERT_GT(alkoxy_rate, 0.0);
+  const std::vector<double> expected{ -(nitrate_rate + alkoxy_rate), 0.3 * nitrate_rate, 0.7 * alkoxy_rate };
+
+  // The documented combination of net × k and the branch product matrices
+  std::vector<double> change(s.species, 0.0);
+  auto apply = [&](const CompressedMatrix& matrix, std::size_t column, double rate)
+  {
+    for (std::size_t j = matrix.offsets[column]; j < matrix.offsets[column + 1]; ++j)
+      change[matrix.indices[j]] += matrix.values[j] * rate;
+  };
+  apply(s.net.by_reaction, s.order.branched, total);
+  apply(s.nitrate_products.by_reaction, 0, nitrate_rate);
+  apply(s.alkoxy_products.by_reaction, 0, alkoxy_rate);
+  for (std::size_t i = 0; i < s.species; ++i)
+    EXPECT_NEAR(change[i], expected[i], 1.0e-12 * std::abs(expected[i]));
+}
+
+TEST(BuildStoichiometry, FullConfiguration)
+{
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  auto result = BuildStoichiometry(*parsed);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->order.size, ReactionOrder(parsed->reactions).size);
+  EXPECT_EQ(ByRows(result->net.by_species), ByColumns(result->net.by_reaction));
+  EXPECT_EQ(ByRows(result->reactants.by_species), ByColumns(result->reactants.by_reaction));
+
+  // The troe reaction B + M -> C
+  const std::size_t troe = result->order.troe;
+  const auto& by_reaction = result->reactants.by_reaction;
+  ASSERT_EQ(by_reaction.offsets[troe + 1] - by_reaction.offsets[troe], 2);
+}
+
+TEST(BuildStoichiometry, ReportsUnknownSpecies)
+{
+  Mechanism mechanism = SmallMechanism();
+  mechanism.reactions.arrhenius[0].products.push_back(Component("D"));
+  mechanism.reactions.surface[0].gas_phase_species = Component("E");
+  AssignIndices(mechanism);
+
+  auto result = BuildStoichiometry(mechanism);
+  ASSERT_FALSE(result);
+  ASSERT_EQ(result.error().size(), 2);
+  EXPECT_EQ(result.error()[0].first, ErrorCode::ReactionRequiresUnknownSpecies);
+  EXPECT_NE(result.error()[0].second.find("'D'"), std::string::npos);
+  EXPECT_NE(result.error()[1].second.find("'E'"), std::string::npos);
+}
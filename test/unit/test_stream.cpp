@@ -0,0 +1,166 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "detail/location.hpp"
+#include "detail/stream.hpp"
+
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+
+#include <string>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  struct Visited
+  {
+    YAML::Node node;
+    ErrorLocation location;
+  };
+
+  // Streams `key` out of `text`, recording each element with its (origin-adjusted) location.
+  std::vector<Visited> Stream(std::string& text, std::string_view key, bool expect_streamed = true)
+  {
+    std::vector<Visited> visited;
+    const bool streamed =
+        StreamSequence(text, key, [&](const YAML::Node& node) { visited.push_back({ node, LocationOf(node) }); });
+    EXPECT_EQ(streamed, expect_streamed);
+    return visited;
+  }
+
+  // Every element streamed out of `text` must equal the element loaded from the whole document,
+  // at the same location, and the rest of the document must load unchanged.
+  void ExpectMatchesWholeDocument(std::string text, std::string_view key)
+  {
+    const YAML::Node whole = YAML::Load(text);
+    const YAML::Node expected = key.empty() ? whole : whole[std::string(key)];
+
+    auto visited = Stream(text, key);
+    ASSERT_EQ(visited.size(), expected.size());
+    for (std::size_t i = 0; i < visited.size(); ++i)
+    {
+      EXPECT_EQ(YAML::Dump(visited[i].node), YAML::Dump(expected[i]));
+      const ErrorLocation location = LocationOf(expected[i]);
+      EXPECT_EQ(visited[i].location.line, location.line);
+      EXPECT_EQ(visited[i].location.column, location.column);
+    }
+
+    if (key.empty())
+      return;
+    const YAML::Node rest = YAML::Load(text);
+    ASSERT_TRUE(rest[std::string(key)].IsSequence());
+    EXPECT_EQ(rest[std::string(key)].size(), 0);
+    for (const auto& entry : whole)
+    {
+      const std::string name = entry.first.as<std::string>();
+      if (name == key)
+        continue;
+      EXPECT_EQ(YAML::Dump(rest[name]), YAML::Dump(entry.second));
+      EXPECT_EQ(rest[name].Mark().line, entry.second.Mark().line);
+      EXPECT_EQ(rest[name].Mark().column, entry.second.Mark().column);
+    }
+  }
+}  // namespace
+
+TEST(StreamSequence, StreamsBlockSequence)
+{
+  ExpectMatchesWholeDocument(
+      R"(version: 1.0.0
+reactions:
+  - type: A
+    values: [1, 2]
+    note: |
+      kept
+      verbatim
+
+  # between elements
+  - type: B
+    empty:
+  -   type: C
+species: [ x ]
+)",
+      "reactions");
+}
+
+TEST(StreamSequence, StreamsCompactBlockSequence)
+{
+  ExpectMatchesWholeDocument("a: 1\nreactions:\n- type: A\n  x: 1\n- type: B\nb: 2\n", "reactions");
+}
+
+TEST(StreamSequence, StreamsFlowSequence)
+{
+  ExpectMatchesWholeDocument(
+      R"({ "version": "1.0.0",
+  "reactions": [ { "type": "A", "name": "has ] and } in it", "x": [1, [2]] },
+                 { "type": "B", 'other': 'it''s [' } # a comment with ] brackets
+               ],
+  "species": [ "x" ] })",
+      "reactions");
+}
+
+TEST(StreamSequence, StreamsFlowElementsOfBlockSequence)
+{
+  ExpectMatchesWholeDocument("reactions:\n  - { type: A, x: [1, 2] }\n  - {type: B}\nspecies: []\n", "reactions");
+}
+
+TEST(StreamSequence, StreamsScalarElements)
+{
+  ExpectMatchesWholeDocument("reactions: [ a, \"b, c\", 'd' ]\nnext: 1\n", "reactions");
+  ExpectMatchesWholeDocument("reactions:\n  - a\n  - O'Brien\nnext: 1\n", "reactions");
+}
+
+TEST(StreamSequence, StreamsRootSequence)
+{
+  ExpectMatchesWholeDocument("- type: A\n  x: 1\n- type: B\n", "");
+  ExpectMatchesWholeDocument("[ { type: A }, { type: B } ]", "");
+}
+
+TEST(StreamSequence, LeavesOtherValuesUntouched)
+{
+  for (const std::string original :
+       { std::string("reactions:\n  files: [ a.json ]\n"), std::string("species: []\n"), std::string("- a\n") })
+  {
+    std::string text = original;
+    EXPECT_TRUE(Stream(text, "reactions").empty());
+    EXPECT_EQ(text, original);
+  }
+}
+
+TEST(StreamSequence, DeclinesAnchorsAndAliases)
+{
+  const std::string original = "reactions:\n  - &first { type: A }\n  - *first\n";
+  std::string text = original;
+  Stream(text, "reactions", false);
+  EXPECT_EQ(text, original);
+
+  text = "- &first a\n- *first\n";
+  Stream(text, "", false);
+}
+
+TEST(StreamSequence, DeclinesRootThatIsNotASequence)
+{
+  std::string text = "key: value\n";
+  Stream(text, "", false);
+}
+
+TEST(StreamSequence, ReportsMalformedDocuments)
+{
+  std::string text = "reactions:\n  - { type: A\n  - type: B\n";
+  EXPECT_THROW(Stream(text, "reactions"), YAML::Exception);
+}
+
+TEST(FindTopLevelScalar, FindsValueAndLocation)
+{
+  auto version = FindTopLevelScalar("name: x\nnested: { version: 2 }\n\nversion: 1.2.0\n", "version");
+  ASSERT_TRUE(version);
+  EXPECT_EQ(version->value, "1.2.0");
+  EXPECT_EQ(version->location.line, 4);
+  EXPECT_EQ(version->location.column, 10);
+
+  EXPECT_FALSE(FindTopLevelScalar("name: x\n", "version"));
+  EXPECT_FALSE(FindTopLevelScalar("version: [1]\n", "version"));
+  EXPECT_FALSE(FindTopLevelScalar("- version\n", "version"));
+}
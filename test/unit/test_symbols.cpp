@@ -0,0 +1,210 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "utils/print.hpp"
+
+#include <mechanism_configuration/compiled.hpp>
+#include <mechanism_configuration/mechanism.hpp>
+#include <mechanism_configuration/parse.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  void ExpectIndexed(const Mechanism& mechanism, const types::ReactionComponent& component)
+  {
+    ASSERT_NE(component.species_index, types::NO_INDEX) << component.name;
+    EXPECT_EQ(mechanism.species[component.species_index].name, component.name);
+  }
+
+  void ExpectIndexed(const Mechanism& mechanism, const std::vector<types::ReactionComponent>& components)
+  {
+    for (const auto& component : components)
+      ExpectIndexed(mechanism, component);
+  }
+
+  void ExpectPhase(const Mechanism& mechanism, std::size_t index, const std::string& name)
+  {
+    // A reaction that does not name its gas phase has no phase index.
+    if (name.empty())
+    {
+      EXPECT_EQ(index, types::NO_INDEX);
+      return;
+    }
+    ASSERT_NE(index, types::NO_INDEX) << name;
+    EXPECT_EQ(mechanism.phases[index].name, name);
+  }
+
+  void ExpectSymbolsMatch(const Mechanism& mechanism)
+  {
+    ASSERT_EQ(mechanism.symbols.species.size(), mechanism.species.size());
+    for (std::size_t i = 0; i < mechanism.species.size(); ++i)
+    {
+      EXPECT_EQ(mechanism.symbols.species.Name(i), mechanism.species[i].name);
+      EXPECT_EQ(mechanism.symbols.species.IndexOf(mechanism.species[i].name), i);
+    }
+    ASSERT_EQ(mechanism.symbols.phases.size(), mechanism.phases.size());
+    for (std::size_t i = 0; i < mechanism.phases.size(); ++i)
+    {
+      EXPECT_EQ(mechanism.symbols.phases.Name(i), mechanism.phases[i].name);
+      for (const auto& species : mechanism.phases[i].species)
+        EXPECT_EQ(mechanism.species[species.species_index].name, species.name);
+    }
+  }
+}  // namespace
+
+TEST(SymbolTable, InternsNames)
+{
+  types::SymbolTable table;
+  EXPECT_EQ(table.Intern("O3"), 0);
+  EXPECT_EQ(table.Intern("NO2"), 1);
+  EXPECT_EQ(table.Intern("O3"), 0);
+  EXPECT_EQ(table.size(), 2);
+  EXPECT_EQ(table.Name(1), "NO2");
+  EXPECT_EQ(table.Find("NO2"), 1);
+  EXPECT_FALSE(table.Find("NO"));
+  EXPECT_EQ(table.IndexOf("NO"), types::NO_INDEX);
+
+  // Append keeps indices in step with a list that repeats a name.
+  EXPECT_EQ(table.Append("O3"), 2);
+  EXPECT_EQ(table.Name(2), "O3");
+  EXPECT_EQ(table.IndexOf("O3"), 0);
+}
+
+TEST(SymbolTable, CopiesAndMovesKeepTheirLookups)
+{
+  std::optional<types::SymbolTable> original(std::in_place);
+  for (int i = 0; i < 1000; ++i)
+    original->Intern("S" + std::to_string(i));
+  original->Append("S0");
+
+  types::SymbolTable copy = *original;
+  types::SymbolTable moved = std::move(*original);
+  original.reset();
+  for (const auto* table : { &copy, &moved })
+  {
+    ASSERT_EQ(table->size(), 1001);
+    EXPECT_EQ(table->IndexOf("S0"), 0);
+    EXPECT_EQ(table->IndexOf("S999"), 999);
+    EXPECT_EQ(table->Name(1000), "S0");
+  }
+}
+
+TEST(AssignIndices, V1FullConfiguration)
+{
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  const Mechanism& mechanism = *parsed;
+  ExpectSymbolsMatch(mechanism);
+
+  const types::Reactions& r = mechanism.reactions;
+  for (const auto& reaction : r.arrhenius)
+  {
+    ExpectPhase(mechanism, reaction.gas_phase_index, reaction.gas_phase);
+    ExpectIndexed(mechanism, reaction.reactants);
+    ExpectIndexed(mechanism, reaction.products);
+  }
+  for (const auto& reaction : r.branched)
+  {
+    ExpectIndexed(mechanism, reaction.nitrate_products);
+    ExpectIndexed(mechanism, reaction.alkoxy_products);
+  }
+  for (const auto& reaction : r.first_order_loss)
+    ExpectIndexed(mechanism, reaction.reactants);
+  for (const auto& reaction : r.surface)
+  {
+    ExpectIndexed(mechanism, reaction.gas_phase_species);
+    ExpectPhase(mechanism, reaction.condensed_phase_index, reaction.condensed_phase);
+  }
+  for (const auto& reaction : r.troe)
+    ExpectIndexed(mechanism, reaction.products);
+  for (const auto& reaction : r.lambda_rate_constant)
+    ExpectIndexed(mechanism, reaction.reactants);
+}
+
+TEST(AssignIndices, V0Configuration)
+{
+  auto parsed = Parse("examples/v0/config.json");
+  ASSERT_TRUE(parsed);
+  ExpectSymbolsMatch(*parsed);
+  for (const auto& reaction : parsed->reactions.arrhenius)
+  {
+    ExpectPhase(*parsed, reaction.gas_phase_index, reaction.gas_phase);
+    ExpectIndexed(*parsed, reaction.reactants);
+  }
+}
+
+TEST(AssignIndices, Aerosol)
+{
+  auto parsed = Parse("v1_unit_configs/aerosol/valid_aerosol.json");
+  ASSERT_TRUE(parsed);
+  ASSERT_TRUE(parsed->aerosol);
+  const Mechanism& mechanism = *parsed;
+
+  for (const auto& representation : mechanism.aerosol->representations)
+  {
+    std::visit(
+        [&](const auto& r)
+        {
+          ASSERT_EQ(r.phase_indices.size(), r.phases.size());
+          for (std::size_t i = 0; i < r.phases.size(); ++i)
+            ExpectPhase(mechanism, r.phase_indices[i], r.phases[i]);
+        },
+        representation);
+  }
+  for (const auto& process : mechanism.aerosol->processes)
+  {
+    if (const auto* transfer = std::get_if<types::HenrysLawPhaseTransfer>(&process))
+    {
+      ExpectPhase(mechanism, transfer->gas_phase_index, transfer->gas_phase);
+      ExpectPhase(mechanism, transfer->condensed_phase_index, transfer->condensed_phase);
+      EXPECT_EQ(mechanism.species[transfer->gas_species_index].name, transfer->gas_species);
+      EXPECT_EQ(mechanism.species[transfer->solvent_index].name, transfer->solvent);
+    }
+    else if (const auto* reaction = std::get_if<types::DissolvedReaction>(&process))
+    {
+      ExpectPhase(mechanism, reaction->phase_index, reaction->phase);
+      EXPECT_EQ(mechanism.species[reaction->solvent_index].name, reaction->solvent);
+      ExpectIndexed(mechanism, reaction->reactants);
+    }
+  }
+}
+
+TEST(AssignIndices, UnknownNamesAndRebuiltImages)
+{
+  Mechanism mechanism;
+  mechanism.species.resize(2);
+  mechanism.species[0].name = "A";
+  mechanism.species[1].name = "B";
+  mechanism.phases.resize(1);
+  mechanism.phases[0].name = "gas";
+  types::Arrhenius reaction;
+  reaction.gas_phase = "gas";
+  reaction.reactants.resize(1);
+  reaction.reactants[0].name = "B";
+  reaction.products.resize(1);
+  reaction.products[0].name = "C";
+  mechanism.reactions.arrhenius.push_back(reaction);
+
+  AssignIndices(mechanism);
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].gas_phase_index, 0);
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].reactants[0].species_index, 1);
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].products[0].species_index, types::NO_INDEX);
+
+  // Indices are derived data: a compiled image rebuilds them on load.
+  const auto path = std::filesystem::temp_directory_path() / "mc_symbols.mcc";
+  ASSERT_TRUE(SaveCompiled(mechanism, path).empty());
+  auto loaded = LoadCompiled(path);
+  ASSERT_TRUE(loaded);
+  ExpectSymbolsMatch(*loaded);
+  EXPECT_EQ(loaded->reactions.arrhenius[0].reactants[0].species_index, 1);
+}
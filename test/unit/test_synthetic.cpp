@@ -0,0 +1,162 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include "utils/files.hpp"
+
+#include <mechanism_configuration/parse.hpp>
+#include <mechanism_configuration/synthetic.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  std::filesystem::path TemporaryDirectory(const std::string& name)
+  {
+    const auto directory = std::filesystem::temp_directory_path() / ("mc_synthetic_" + name);
+    std::filesystem::remove_all(directory);
+    return directory;
+  }
+
+  // A different number of reactions of each kind, so that a miscount shows up
+  SyntheticReactionCounts EveryKind(int version)
+  {
+    return { .arrhenius = 7,
+             .branched = 3,
+             .emission = 4,
+             .first_order_loss = 5,
+             .photolysis = 6,
+             .surface = 2,
+             .taylor_series = version == 0 ? 0u : 8u,
+             .troe = 9,
+             .ternary_chemical_activation = 10,
+             .tunneling = 11,
+             .user_defined = 12,
+             .lambda_rate_constant = version == 0 ? 0u : 13u };
+  }
+
+  void ExpectCounts(const Mechanism& mechanism, const SyntheticReactionCounts& expected)
+  {
+    const auto& r = mechanism.reactions;
+    EXPECT_EQ(r.arrhenius.size(), expected.arrhenius);
+    EXPECT_EQ(r.branched.size(), expected.branched);
+    EXPECT_EQ(r.emission.size(), expected.emission);
+    EXPECT_EQ(r.first_order_loss.size(), expected.first_order_loss);
+    EXPECT_EQ(r.photolysis.size(), expected.photolysis);
+    EXPECT_EQ(r.surface.size(), expected.surface);
+    EXPECT_EQ(r.taylor_series.size(), expected.taylor_series);
+    EXPECT_EQ(r.troe.size(), expected.troe);
+    EXPECT_EQ(r.ternary_chemical_activation.size(), expected.ternary_chemical_activation);
+    EXPECT_EQ(r.tunneling.size(), expected.tunneling);
+    EXPECT_EQ(r.user_defined.size(), expected.user_defined);
+    EXPECT_EQ(r.lambda_rate_constant.size(), expected.lambda_rate_constant);
+  }
+}  // namespace
+
+TEST(Synthetic, WritesParseableVersion1Mechanisms)
+{
+  for (const SyntheticFormat format : { SyntheticFormat::Yaml, SyntheticFormat::Json })
+    for (const std::size_t files : { 0, 1, 4 })
+    {
+      const SyntheticOptions options{ .format = format,
+                                      .files = files,
+                                      .seed = 7,
+                                      .species = 20,
+                                      .phases = 3,
+                                      .reactions = EveryKind(1),
+                                      .aerosol_processes = 9,
+                                      .emission_sources = 25 };
+      const auto directory =
+          TemporaryDirectory("v1_" + std::to_string(static_cast<int>(format)) + "_" + std::to_string(files));
+      const auto path = WriteSyntheticMechanism(options, directory);
+      ASSERT_TRUE(path);
+
+      const auto parsed = Parse(*path);
+      ASSERT_TRUE(parsed) << *path << ": " << parsed.error().front().second;
+      EXPECT_EQ(parsed->species.size(), 21);  // and the solvent
+      EXPECT_EQ(parsed->phases.size(), 3);
+      ExpectCounts(*parsed, options.reactions);
+      ASSERT_TRUE(parsed->aerosol);
+      EXPECT_EQ(parsed->aerosol->representations.size(), 2);
+      EXPECT_EQ(parsed->aerosol->processes.size(), 9);
+      ASSERT_TRUE(parsed->emissions);
+      EXPECT_EQ(parsed->emissions->sources.size(), 25);
+      std::filesystem::remove_all(directory);
+    }
+}
+
+TEST(Synthetic, WritesParseableVersion0Mechanisms)
+{
+  for (const SyntheticFormat format : { SyntheticFormat::Yaml, SyntheticFormat::Json })
+    for (const std::size_t files : { 0, 3 })
+    {
+      const SyntheticOptions options{
+        .version = 0, .format = format, .files = files, .seed = 3, .species = 10, .reactions = EveryKind(0)
+      };
+      const auto directory =
+          TemporaryDirectory("v0_" + std::to_string(static_cast<int>(format)) + "_" + std::to_string(files));
+      const auto path = WriteSyntheticMechanism(options, directory);
+      ASSERT_TRUE(path);
+
+      const auto parsed = Parse(*path);
+      ASSERT_TRUE(parsed) << *path << ": " << parsed.error().front().second;
+      EXPECT_EQ(parsed->species.size(), 10);
+      ExpectCounts(*parsed, options.reactions);
+      std::filesystem::remove_all(directory);
+    }
+}
+
+TEST(Synthetic, OutputDependsOnlyOnTheOptions)
+{
+  SyntheticOptions options{ .seed = 11, .species = 30, .reactions = EveryKind(1) };
+  const auto first = WriteSyntheticMechanism(options, TemporaryDirectory("seed_a"));
+  const auto second = WriteSyntheticMechanism(options, TemporaryDirectory("seed_b"));
+  options.seed = 12;
+  const auto reseeded = WriteSyntheticMechanism(options, TemporaryDirectory("seed_c"));
+  options.format = SyntheticFormat::Json;
+  options.files = 5;
+  const auto split = WriteSyntheticMechanism(options, TemporaryDirectory("seed_d"));
+  ASSERT_TRUE(first && second && reseeded && split);
+
+  EXPECT_EQ(ReadBytes(*first), ReadBytes(*second));
+  EXPECT_NE(ReadBytes(*first), ReadBytes(*reseeded));
+
+  // The same seed gives the same mechanism in any format and layout
+  const auto yaml = Parse(*reseeded);
+  const auto json = Parse(*split);
+  ASSERT_TRUE(yaml && json);
+  ASSERT_EQ(yaml->reactions.arrhenius.size(), json->reactions.arrhenius.size());
+  for (std::size_t i = 0; i < yaml->reactions.arrhenius.size(); ++i)
+  {
+    EXPECT_EQ(yaml->reactions.arrhenius[i].A, json->reactions.arrhenius[i].A);
+    EXPECT_EQ(yaml->reactions.arrhenius[i].reactants[0].name, json->reactions.arrhenius[i].reactants[0].name);
+  }
+  EXPECT_EQ(yaml->reactions.lambda_rate_constant.back().lambda_function,
+            json->reactions.lambda_rate_constant.back().lambda_function);
+
+  for (const auto& path : { *first, *second, *reseeded, *split })
+    std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(Synthetic, RejectsUnwritableOptions)
+{
+  const auto directory = TemporaryDirectory("invalid");
+  auto first_error = [&](const SyntheticOptions& options)
+  {
+    const auto path = WriteSyntheticMechanism(options, directory);
+    EXPECT_FALSE(path);
+    return path ? ErrorCode::None : path.error().front().first;
+  };
+  EXPECT_EQ(first_error({ .version = 2 }), ErrorCode::InvalidVersion);
+  EXPECT_EQ(first_error({ .version = 0, .reactions = { .lambda_rate_constant = 1 } }), ErrorCode::InvalidVersion);
+  EXPECT_EQ(first_error({ .version = 0, .emission_sources = 1 }), ErrorCode::InvalidVersion);
+  EXPECT_EQ(first_error({ .species = 1 }), ErrorCode::InvalidKey);
+  EXPECT_EQ(first_error({ .aerosol_processes = 1 }), ErrorCode::InvalidKey);
+  EXPECT_FALSE(std::filesystem::exists(directory));
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/mechanism.hpp>
+#include <mechanism_configuration/parse.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace mechanism_configuration;
+
+TEST(UnknownProperties, StoresOnlyNonEmptyEntries)
+{
+  types::UnknownProperties table;
+  EXPECT_EQ(table.Add({}), types::NO_PROPERTIES);
+  EXPECT_TRUE(table.empty());
+
+  const auto id = table.Add({ { "__a", "1" }, { "__b", "2" } });
+  EXPECT_EQ(id, 0);
+  EXPECT_EQ(table.Add({ { "__c", "3" } }), 1);
+  EXPECT_EQ(table.size(), 2);
+  EXPECT_EQ(table.Get(id).size(), 2);
+  EXPECT_EQ(table.Find(id, "__b"), "2");
+  EXPECT_FALSE(table.Find(id, "__c"));
+  EXPECT_TRUE(table.Get(types::NO_PROPERTIES).empty());
+  EXPECT_FALSE(table.Find(types::NO_PROPERTIES, "__a"));
+}
+
+TEST(UnknownProperties, AppendShiftsIds)
+{
+  types::UnknownProperties table;
+  table.Add({ { "__a", "1" } });
+  types::UnknownProperties other;
+  other.Add({ { "__b", "2" } });
+  other.Add({ { "__c", "3" }, { "__d", "4" } });
+
+  const auto offset = table.Append(std::move(other));
+  EXPECT_EQ(offset, 1);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(table.size(), 3);
+  EXPECT_EQ(table.Find(0, "__a"), "1");
+  EXPECT_EQ(table.Find(0 + offset, "__b"), "2");
+  EXPECT_EQ(table.Find(1 + offset, "__d"), "4");
+}
+
+TEST(UnknownProperties, CollectedIntoOneTable)
+{
+  auto parsed = Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  const Mechanism& mechanism = *parsed;
+  EXPECT_FALSE(mechanism.unknown_properties.empty());
+
+  // Every stored entry belongs to exactly one object, and objects without comments have none.
+  const auto& species = mechanism.species;
+  for (std::size_t i = 0; i < species.size(); ++i)
+    for (std::size_t j = i + 1; j < species.size(); ++j)
+      if (species[i].unknown_properties_id != types::NO_PROPERTIES)
+        EXPECT_NE(species[i].unknown_properties_id, species[j].unknown_properties_id);
+  for (const auto& s : species)
+    EXPECT_EQ(s.unknown_properties_id == types::NO_PROPERTIES, mechanism.unknown_properties.Of(s).empty());
+}
+
+TEST(UnknownProperties, SkippedWhenNotCollected)
+{
+  ParseOptions options;
+  options.collect_unknown_properties = false;
+  for (const bool stream : { false, true })
+  {
+    options.stream_reactions = stream;
+    auto parsed = Parse("examples/v1/full_configuration.yaml", options);
+    ASSERT_TRUE(parsed);
+    EXPECT_TRUE(parsed->unknown_properties.empty());
+    for (const auto& species : parsed->species)
+      EXPECT_EQ(species.unknown_properties_id, types::NO_PROPERTIES);
+    for (const auto& reaction : parsed->reactions.arrhenius)
+    {
+      EXPECT_EQ(reaction.unknown_properties_id, types::NO_PROPERTIES);
+      for (const auto& product : reaction.products)
+        EXPECT_EQ(product.unknown_properties_id, types::NO_PROPERTIES);
+    }
+  }
+
+  // Everything else parses the same.
+  auto full = Parse("examples/v1/full_configuration.yaml");
+  options.stream_reactions = false;
+  auto skipped = Parse("examples/v1/full_configuration.yaml", options);
+  ASSERT_TRUE(full);
+  ASSERT_TRUE(skipped);
+  EXPECT_EQ(full->species.size(), skipped->species.size());
+  EXPECT_EQ(full->reactions.arrhenius.size(), skipped->reactions.arrhenius.size());
+}
@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <optional>
 
 using namespace mechanism_configuration;
@@ -170,6 +171,73 @@ TEST(Validate, DetectsUnknownPhase)
   EXPECT_TRUE(HasCode(Validate(m), ErrorCode::UnknownPhase));
 }
 
+TEST(Validate, DetectsInvalidLambdaFunction)
+{
+  Mechanism m = BaseMechanism();
+  types::LambdaRateConstant rxn;
+  rxn.gas_phase = "gas";
+  rxn.reactants = { component("A") };
+  rxn.products = { component("B") };
+  rxn.lambda_function = "[](double T) { return 3.0e-4 * T; }";
+  m.reactions.lambda_rate_constant = { rxn };
+  EXPECT_TRUE(Validate(m).empty());
+
+  m.reactions.lambda_rate_constant[0].lambda_function = "[](double T) { return 3.0e-4 * Temp; }";
+  EXPECT_TRUE(HasCode(Validate(m), ErrorCode::InvalidExpression));
+}
+
+TEST(Validate, ErrorLimitKeepsTheFirstErrors)
+{
+  Mechanism m = BaseMechanism();
+  m.species.push_back(species("A"));  // duplicate
+  for (const auto& name : { "X", "Y", "Z" })
+  {
+    types::Arrhenius rxn;
+    rxn.gas_phase = "gas";
+    rxn.reactants = { component(name) };
+    m.reactions.arrhenius.push_back(rxn);
+  }
+  m.emissions = types::EmissionsConfig{ .inventories = { inventory("inv"), inventory("inv") } };
+
+  const Errors all = Validate(m);
+  ASSERT_EQ(all.size(), 7);
+  for (std::size_t limit = 1; limit <= all.size() + 1; ++limit)
+    EXPECT_EQ(Validate(m, { .max_errors = limit }), Errors(all.begin(), all.begin() + std::min(limit, all.size())));
+  EXPECT_EQ(Validate(m, { .stop_on_first_error = true }), Errors(all.begin(), all.begin() + 1));
+  EXPECT_EQ(ValidateGasModel(m, { .max_errors = 3 }).size(), 3);
+  EXPECT_EQ(ValidateEmissionsModel(m, { .stop_on_first_error = true }).size(), 1);
+}
+
+TEST(Validate, DiagnoseRecordsTheErrorsValidateFormats)
+{
+  Mechanism m = BaseMechanism();
+  types::Arrhenius rxn;
+  rxn.gas_phase = "gas";
+  rxn.reactants = { component("Z") };
+  m.reactions.arrhenius = { rxn };
+  m.emissions = types::EmissionsConfig{ .inventories = { inventory("inv"), inventory("inv") } };
+
+  const Diagnostics diagnostics = Diagnose(m);
+  EXPECT_EQ(diagnostics.ToErrors(), Validate(m));
+  EXPECT_EQ(Diagnose(m, { .max_errors = 2 }).ToErrors(), Validate(m, { .max_errors = 2 }));
+
+  ASSERT_EQ(diagnostics.entries.size(), 3);
+  const Diagnostic& unknown = diagnostics.entries[0];
+  EXPECT_EQ(unknown.code, ErrorCode::ReactionRequiresUnknownSpecies);
+  EXPECT_EQ(unknown.arguments[0], "Z");
+  EXPECT_EQ(unknown.arguments[1], "ARRHENIUS");
+  EXPECT_EQ(unknown.file, Diagnostic::NO_FILE);
+  EXPECT_EQ(unknown.line, 0);
+  EXPECT_EQ(diagnostics.to_string(unknown), "error: Unknown species 'Z' used in 'ARRHENIUS' reaction.");
+
+  Diagnostic located = unknown;
+  located.file = 0;
+  located.line = 3;
+  located.column = 7;
+  EXPECT_EQ(located.to_string("config.yaml"), "config.yaml:3:7 error: Unknown species 'Z' used in 'ARRHENIUS' reaction.");
+  EXPECT_EQ(Diagnostics{ .files = { "a.yaml" } }.to_string(located), "a.yaml:3:7 " + unknown.to_string());
+}
+
 namespace
 {
   // species A (mw), H2O (mw); gas {A: diffusion}, aqueous {A, H2O: density};
@@ -307,6 +375,20 @@ TEST(ValidateAerosol, DetectsMissingSolventMolecularWeight)
 }
 
 // An in-code mechanism with a well-formed emissions section validates cleanly.
+TEST(ValidateAerosol, DetectsInvalidRateExpression)
+{
+  Mechanism m = AerosolBaseMechanism();
+  types::DissolvedReaction reaction;
+  reaction.phase = "aqueous";
+  reaction.solvent = "H2O";
+  reaction.rate_constant = types::RateExpression{ "[](double T) { return 1.0e3 * exp(-200.0 / T); }" };
+  m.aerosol->processes = { reaction };
+  EXPECT_FALSE(HasCode(ValidateAerosolModel(m), ErrorCode::InvalidExpression));
+
+  std::get<types::DissolvedReaction>(m.aerosol->processes[0]).rate_constant = types::RateExpression{ "1.0e3 * P" };
+  EXPECT_TRUE(HasCode(ValidateAerosolModel(m), ErrorCode::InvalidExpression));
+}
+
 TEST(Validate, EmissionsValidConfigAccepted)
 {
   Mechanism m = BaseMechanism();
@@ -9,6 +9,8 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -177,3 +179,89 @@ TEST(ParseFromFileConfigs, DuplicateSpeciesSet)
     std::cout << error.second << " " << ErrorCodeToString(error.first) << "\n";
   }
 }
+
+// ── parallel loading ──────────────────────────────────────────────────────────
+// Loading the `files:` lists concurrently must give the same mechanism, and the same errors in
+// the same order, as loading them one after another.
+
+namespace
+{
+  void ExpectParallelLoadingMatchesSerial(const std::string& path, bool stream_reactions)
+  {
+    SCOPED_TRACE(path);
+    auto serial = Parse(path, ParseOptions{ .stream_reactions = stream_reactions });
+    auto parallel = Parse(path, ParseOptions{ .stream_reactions = stream_reactions, .parallel_file_loading = true });
+
+    ASSERT_EQ(serial.has_value(), parallel.has_value());
+    if (!serial)
+    {
+      EXPECT_EQ(parallel.error(), serial.error());
+      return;
+    }
+    ASSERT_EQ(parallel->species.size(), serial->species.size());
+    for (std::size_t i = 0; i < serial->species.size(); ++i)
+      EXPECT_EQ(parallel->species[i].name, serial->species[i].name);
+    ASSERT_EQ(parallel->phases.size(), serial->phases.size());
+    for (std::size_t i = 0; i < serial->phases.size(); ++i)
+      EXPECT_EQ(parallel->phases[i].name, serial->phases[i].name);
+    ASSERT_EQ(parallel->reactions.arrhenius.size(), serial->reactions.arrhenius.size());
+    for (std::size_t i = 0; i < serial->reactions.arrhenius.size(); ++i)
+      EXPECT_EQ(parallel->reactions.arrhenius[i].name, serial->reactions.arrhenius[i].name);
+    EXPECT_EQ(parallel->reactions.photolysis.size(), serial->reactions.photolysis.size());
+  }
+}  // namespace
+
+TEST(ParseFromFileConfigs, ParallelLoadingMatchesSerial)
+{
+  for (const auto& entry : std::filesystem::directory_iterator(configBase))
+    for (const bool stream_reactions : { false, true })
+      ExpectParallelLoadingMatchesSerial((entry.path() / "main.json").string(), stream_reactions);
+}
+
+TEST(ParseFromFileConfigs, ParallelLoadingKeepsFileOrderAndErrorOrder)
+{
+  // Many reaction files, with missing and malformed ones scattered through the list.
+  const std::filesystem::path dir = std::filesystem::temp_directory_path() / "mc_parallel_file_loading";
+  std::filesystem::create_directories(dir);
+  std::ofstream(dir / "species.yaml") << "- name: A\n- name: B\n";
+  std::ofstream(dir / "phases.yaml") << "- name: gas\n  species: [ A, B ]\n";
+
+  std::string files;
+  for (int i = 0; i < 60; ++i)
+  {
+    const std::string name = "reactions_" + std::to_string(i) + ".yaml";
+    files += (i ? ", " : "") + name;
+    if (i % 17 == 5)
+      continue;  // missing
+    std::ofstream file(dir / name);
+    if (i % 13 == 7)
+      file << "- { type: ARRHENIUS\n";  // malformed
+    else
+      file << "- type: ARRHENIUS\n  name: R" << i << "\n  gas phase: gas\n  reactants: [ A ]\n  products: [ B ]\n";
+  }
+
+  std::ofstream(dir / "main.yaml") << "version: 1.1.0\nname: many files\n"
+                                   << "species: { files: [ species.yaml ] }\n"
+                                   << "phases: { files: [ phases.yaml ] }\n"
+                                   << "reactions: { files: [ " << files << " ] }\n";
+  std::ofstream(dir / "valid.yaml") << "version: 1.1.0\nname: many files\n"
+                                    << "species: { files: [ species.yaml ] }\n"
+                                    << "phases: { files: [ phases.yaml ] }\n"
+                                    << "reactions: { files: [ reactions_0.yaml, reactions_1.yaml, reactions_2.yaml ] }\n";
+
+  for (const bool stream_reactions : { false, true })
+  {
+    ExpectParallelLoadingMatchesSerial((dir / "main.yaml").string(), stream_reactions);
+    ExpectParallelLoadingMatchesSerial((dir / "valid.yaml").string(), stream_reactions);
+  }
+
+  auto parsed = Parse(dir / "main.yaml", ParseOptions{ .parallel_file_loading = true });
+  ASSERT_FALSE(parsed);
+  ASSERT_EQ(parsed.error().size(), 9);  // 4 missing + 5 malformed
+  EXPECT_EQ(parsed.error()[0].first, ErrorCode::FileNotFound);
+  EXPECT_NE(parsed.error()[0].second.find("reactions_5.yaml"), std::string::npos);
+  EXPECT_EQ(parsed.error()[1].first, ErrorCode::UnexpectedError);
+  EXPECT_NE(parsed.error()[1].second.find("reactions_7.yaml"), std::string::npos);
+
+  std::filesystem::remove_all(dir);
+}
@@ -36,8 +36,8 @@ TEST(ParserBase, CanParseValidArrheniusReaction)
     EXPECT_EQ(mechanism.reactions.arrhenius[0].products[0].coefficient, 1.2);
     EXPECT_EQ(mechanism.reactions.arrhenius[0].products[1].name, "C");
     EXPECT_EQ(mechanism.reactions.arrhenius[0].products[1].coefficient, 0.3);
-    EXPECT_EQ(mechanism.reactions.arrhenius[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.arrhenius[0].unknown_properties["__solver_param"], "0.1");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.arrhenius[0]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.arrhenius[0], "__solver_param"), "0.1");
 
     EXPECT_EQ(mechanism.reactions.arrhenius[1].name, "my arrhenius2");
     EXPECT_EQ(mechanism.reactions.arrhenius[1].gas_phase, "gas");
@@ -54,8 +54,8 @@ TEST(ParserBase, CanParseValidArrheniusReaction)
     EXPECT_EQ(mechanism.reactions.arrhenius[1].products.size(), 1);
     EXPECT_EQ(mechanism.reactions.arrhenius[1].products[0].name, "C");
     EXPECT_EQ(mechanism.reactions.arrhenius[1].products[0].coefficient, 0.5);
-    EXPECT_EQ(mechanism.reactions.arrhenius[1].products[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.arrhenius[1].products[0].unknown_properties["__optional thing"], "hello");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.arrhenius[1].products[0]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.arrhenius[1].products[0], "__optional thing"), "hello");
 
     EXPECT_EQ(mechanism.reactions.arrhenius[2].name, "");
     EXPECT_EQ(mechanism.reactions.arrhenius[2].gas_phase, "gas");
@@ -33,15 +33,15 @@ TEST(ParserBase, CanParseValidBranchedReaction)
     EXPECT_EQ(mechanism.reactions.branched[0].nitrate_products.size(), 1);
     EXPECT_EQ(mechanism.reactions.branched[0].nitrate_products[0].name, "C");
     EXPECT_EQ(mechanism.reactions.branched[0].nitrate_products[0].coefficient, 1.2);
-    EXPECT_EQ(mechanism.reactions.branched[0].nitrate_products[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.branched[0].nitrate_products[0].unknown_properties["__thing"], "hi");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.branched[0].nitrate_products[0]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.branched[0].nitrate_products[0], "__thing"), "hi");
     EXPECT_EQ(mechanism.reactions.branched[0].alkoxy_products.size(), 2);
     EXPECT_EQ(mechanism.reactions.branched[0].alkoxy_products[0].name, "B");
     EXPECT_EQ(mechanism.reactions.branched[0].alkoxy_products[0].coefficient, 0.2);
     EXPECT_EQ(mechanism.reactions.branched[0].alkoxy_products[1].name, "A");
     EXPECT_EQ(mechanism.reactions.branched[0].alkoxy_products[1].coefficient, 1.2);
-    EXPECT_EQ(mechanism.reactions.branched[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.branched[0].unknown_properties["__comment"], "thing");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.branched[0]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.branched[0], "__comment"), "thing");
   }
 }
 
@@ -26,9 +26,10 @@ TEST(ParserBase, CanParseValidFirstOrderLossReaction)
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].scaling_factor, 12.3);
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].reactants.name, "C");
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].reactants.coefficient, 1);
-    EXPECT_EQ(mechanism.reactions.first_order_loss[0].unknown_properties.size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.first_order_loss[0]).size(), 1);
     EXPECT_EQ(
-        mechanism.reactions.first_order_loss[0].unknown_properties["__comment"], "Strawberries are the superior fruit");
+        mechanism.unknown_properties.Find(mechanism.reactions.first_order_loss[0], "__comment"),
+        "Strawberries are the superior fruit");
 
     EXPECT_EQ(mechanism.reactions.first_order_loss[1].gas_phase, "gas");
     EXPECT_EQ(mechanism.reactions.first_order_loss[1].scaling_factor, 1);
@@ -127,9 +128,10 @@ TEST(ParserBase, CanParseValidFirstOrderLossReactionWithProducts)
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].products[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].products[1].name, "B");
     EXPECT_EQ(mechanism.reactions.first_order_loss[0].products[1].coefficient, 2);
-    EXPECT_EQ(mechanism.reactions.first_order_loss[0].unknown_properties.size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.first_order_loss[0]).size(), 1);
     EXPECT_EQ(
-        mechanism.reactions.first_order_loss[0].unknown_properties["__comment"], "Strawberries are the superior fruit");
+        mechanism.unknown_properties.Find(mechanism.reactions.first_order_loss[0], "__comment"),
+        "Strawberries are the superior fruit");
 
     EXPECT_EQ(mechanism.reactions.first_order_loss[1].gas_phase, "gas");
     EXPECT_EQ(mechanism.reactions.first_order_loss[1].scaling_factor, 1);
@@ -32,8 +32,8 @@ TEST(ParserBase, CanParseValidLambdaRateConstantReaction)
     EXPECT_EQ(mechanism.reactions.lambda_rate_constant[0].products.size(), 1);
     EXPECT_EQ(mechanism.reactions.lambda_rate_constant[0].products[0].name, "C");
     EXPECT_EQ(mechanism.reactions.lambda_rate_constant[0].products[0].coefficient, 1);
-    EXPECT_EQ(mechanism.reactions.lambda_rate_constant[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.lambda_rate_constant[0].unknown_properties["__comment"], "hi");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.lambda_rate_constant[0]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.lambda_rate_constant[0], "__comment"), "hi");
 
     EXPECT_EQ(mechanism.reactions.lambda_rate_constant[1].gas_phase, "gas");
     EXPECT_EQ(mechanism.reactions.lambda_rate_constant[1].name, "");
@@ -99,3 +99,51 @@ TEST(ParserBase, LambdaRateConstantDetectsUnknownPhase)
     }
   }
 }
+
+TEST(ParserBase, LambdaRateConstantDetectsInvalidLambdaFunction)
+{
+  // The error points at the unknown function, inside the quoted or block lambda
+  std::vector<std::pair<std::string, std::string>> files = { { "invalid_lambda.json", "19:58 error" },
+                                                             { "invalid_lambda.yaml", "10:52 error" },
+                                                             { "invalid_lambda_block.yaml", "12:23 error" } };
+  for (auto& [name, location] : files)
+  {
+    std::string file = "v1_unit_configs/reactions/lambda_rate_constant/" + name;
+    auto streamed = Parse(file, { .stream_reactions = true });
+    auto parsed = Parse(file);
+    EXPECT_FALSE(parsed);
+    EXPECT_EQ(parsed.error().size(), 1);
+    EXPECT_EQ(parsed.error()[0].first, ErrorCode::InvalidExpression);
+    EXPECT_NE(parsed.error()[0].second.find(name + ":" + location), std::string::npos);
+    EXPECT_NE(parsed.error()[0].second.find("Unknown name 'exq'"), std::string::npos);
+    ASSERT_FALSE(streamed);
+    EXPECT_EQ(streamed.error(), parsed.error());
+    for (auto& error : parsed.error())
+    {
+      std::cout << error.second << " " << ErrorCodeToString(error.first) << std::endl;
+    }
+  }
+}
+
+TEST(ParserBase, LambdaRateConstantLocatesErrorsInEscapedLambdaAtTheirStart)
+{
+  // An escaped line break has no one position in the source, so the error points at the lambda
+  std::string config = R"(version: 1.0.0
+species: [ { name: A } ]
+phases: [ { name: gas, species: [ A ] } ]
+reactions:
+- type: LAMBDA_RATE_CONSTANT
+  gas phase: gas
+  lambda function: "[](double T) {\n  return exq(T); }"
+  reactants: [ { name: A } ]
+  products: [ { name: A } ]
+)";
+  for (const bool stream : { false, true })
+  {
+    auto parsed = ParseFromString(config, { .stream_reactions = stream });
+    ASSERT_FALSE(parsed);
+    ASSERT_EQ(parsed.error().size(), 1);
+    EXPECT_EQ(parsed.error()[0].first, ErrorCode::InvalidExpression);
+    EXPECT_EQ(parsed.error()[0].second.rfind(":7:20 error", 0), 0) << parsed.error()[0].second;
+  }
+}
@@ -31,8 +31,10 @@ TEST(ParserBase, CanParseValidSurfaceReaction)
     EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_products[0].coefficient, 1);
     EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_products[1].name, "C");
     EXPECT_EQ(mechanism.reactions.surface[0].gas_phase_products[1].coefficient, 1);
-    EXPECT_EQ(mechanism.reactions.surface[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.surface[0].unknown_properties["__comment"], "key lime pie is superior to all other pies");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.surface[0]).size(), 1);
+    EXPECT_EQ(
+        mechanism.unknown_properties.Find(mechanism.reactions.surface[0], "__comment"),
+        "key lime pie is superior to all other pies");
 
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase, "gas");
     EXPECT_EQ(mechanism.reactions.surface[1].reaction_probability, 1.0);
@@ -41,8 +43,9 @@ TEST(ParserBase, CanParseValidSurfaceReaction)
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products.size(), 2);
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[0].name, "B");
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[0].coefficient, 1);
-    EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[0].unknown_properties["__optional thing"], "hello");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.surface[1].gas_phase_products[0]).size(), 1);
+    EXPECT_EQ(
+        mechanism.unknown_properties.Find(mechanism.reactions.surface[1].gas_phase_products[0], "__optional thing"), "hello");
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[1].name, "C");
     EXPECT_EQ(mechanism.reactions.surface[1].gas_phase_products[1].coefficient, 1);
   }
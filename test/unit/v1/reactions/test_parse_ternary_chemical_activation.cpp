@@ -57,8 +57,8 @@ TEST(TernaryChemicalActivationConfig, ParseValidConfig)
 
     // second reaction
     {
-      EXPECT_EQ(process_vector[1].unknown_properties.size(), 1);
-      EXPECT_EQ(process_vector[1].unknown_properties["__optional thing"], "hello");
+      EXPECT_EQ(mechanism.unknown_properties.Of(process_vector[1]).size(), 1);
+      EXPECT_EQ(mechanism.unknown_properties.Find(process_vector[1], "__optional thing"), "hello");
       EXPECT_EQ(process_vector[1].reactants.size(), 2);
       EXPECT_EQ(process_vector[1].reactants[0].name, "bar");
       EXPECT_EQ(process_vector[1].reactants[1].name, "baz");
@@ -36,14 +36,14 @@ TEST(ParserBase, CanParseValidTroeReaction)
     EXPECT_EQ(mechanism.reactions.troe[0].products.size(), 1);
     EXPECT_EQ(mechanism.reactions.troe[0].products[0].name, "C");
     EXPECT_EQ(mechanism.reactions.troe[0].products[0].coefficient, 1);
-    EXPECT_EQ(mechanism.reactions.troe[0].unknown_properties.size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.troe[0]).size(), 1);
     if (extension == ".json")
     {
-      EXPECT_EQ(mechanism.reactions.troe[0].unknown_properties["__my object"], "{a: 1.0}");
+      EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.troe[0], "__my object"), "{a: 1.0}");
     }
     else
     {
-      EXPECT_EQ(mechanism.reactions.troe[0].unknown_properties["__my object"], "a: 1.0");
+      EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.troe[0], "__my object"), "a: 1.0");
     }
 
     EXPECT_EQ(mechanism.reactions.troe[1].name, "my troe");
@@ -62,11 +62,11 @@ TEST(ParserBase, CanParseValidTroeReaction)
     EXPECT_EQ(mechanism.reactions.troe[1].products.size(), 2);
     EXPECT_EQ(mechanism.reactions.troe[1].products[0].name, "A");
     EXPECT_EQ(mechanism.reactions.troe[1].products[0].coefficient, 0.2);
-    EXPECT_EQ(mechanism.reactions.troe[1].products[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.troe[1].products[0].unknown_properties["__optional thing"], "hello");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.troe[1].products[0]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.troe[1].products[0], "__optional thing"), "hello");
     EXPECT_EQ(mechanism.reactions.troe[1].products[1].name, "B");
     EXPECT_EQ(mechanism.reactions.troe[1].products[1].coefficient, 1.2);
-    EXPECT_EQ(mechanism.reactions.troe[1].products[1].unknown_properties.size(), 0);
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.troe[1].products[1]).size(), 0);
   }
 }
 
@@ -43,11 +43,11 @@ TEST(ParserBase, CanParseValidTunnelingReaction)
     EXPECT_EQ(mechanism.reactions.tunneling[1].products.size(), 2);
     EXPECT_EQ(mechanism.reactions.tunneling[1].products[0].name, "A");
     EXPECT_EQ(mechanism.reactions.tunneling[1].products[0].coefficient, 0.2);
-    EXPECT_EQ(mechanism.reactions.tunneling[1].products[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.tunneling[1].products[0].unknown_properties["__optional thing"], "hello");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.tunneling[1].products[0]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.tunneling[1].products[0], "__optional thing"), "hello");
     EXPECT_EQ(mechanism.reactions.tunneling[1].products[1].name, "B");
     EXPECT_EQ(mechanism.reactions.tunneling[1].products[1].coefficient, 1.2);
-    EXPECT_EQ(mechanism.reactions.tunneling[1].products[1].unknown_properties.size(), 0);
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.tunneling[1].products[1]).size(), 0);
   }
 }
 
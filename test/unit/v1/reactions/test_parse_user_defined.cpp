@@ -30,8 +30,8 @@ TEST(ParserBase, CanParseValidUserDefinedReaction)
     EXPECT_EQ(mechanism.reactions.user_defined[0].products.size(), 1);
     EXPECT_EQ(mechanism.reactions.user_defined[0].products[0].name, "C");
     EXPECT_EQ(mechanism.reactions.user_defined[0].products[0].coefficient, 1);
-    EXPECT_EQ(mechanism.reactions.user_defined[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.reactions.user_defined[0].unknown_properties["__comment"], "hi");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.reactions.user_defined[0]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.reactions.user_defined[0], "__comment"), "hi");
 
     EXPECT_EQ(mechanism.reactions.user_defined[1].gas_phase, "gas");
     EXPECT_EQ(mechanism.reactions.user_defined[1].scaling_factor, 1);
@@ -61,8 +61,8 @@ TEST(ParseAerosol, ParsesValidAerosolConfiguration)
   EXPECT_DOUBLE_EQ(accumulation.geometric_mean_radius, 2.0e-5);
   EXPECT_DOUBLE_EQ(accumulation.geometric_standard_deviation, 1.0e-5);
 
-  // Processes: a phase transfer followed by a dissolved reaction.
-  ASSERT_EQ(aerosol.processes.size(), 2u);
+  // Processes: a phase transfer followed by a dissolved reaction and a reversible one.
+  ASSERT_EQ(aerosol.processes.size(), 3u);
 
   // The phase transfer's diffusion coefficient is sourced from the gas-phase species definition.
   const auto& transfer = std::get<types::HenrysLawPhaseTransfer>(aerosol.processes[0]);
@@ -75,6 +75,16 @@ TEST(ParseAerosol, ParsesValidAerosolConfiguration)
   ASSERT_EQ(reaction.products.size(), 1u);
   EXPECT_EQ(reaction.reactants[0].name, "A");
   EXPECT_EQ(reaction.products[0].name, "B");
+  EXPECT_TRUE(std::holds_alternative<types::Arrhenius>(reaction.rate_constant));
+
+  // The reversible reaction's forward rate constant is an expression of temperature.
+  const auto& reversible = std::get<types::DissolvedReversibleReaction>(aerosol.processes[2]);
+  ASSERT_TRUE(reversible.forward_rate_constant.has_value());
+  const auto* expression = std::get_if<types::RateExpression>(&*reversible.forward_rate_constant);
+  ASSERT_NE(expression, nullptr);
+  EXPECT_EQ(expression->expression, "[](double T) { return 2.5e3 * exp(-1500.0 / T); }");
+  ASSERT_TRUE(reversible.equilibrium_constant.has_value());
+  EXPECT_DOUBLE_EQ(reversible.equilibrium_constant->A, 4.0);
 
   // Constraints: a Henry's-law equilibrium followed by a linear constraint.
   ASSERT_EQ(aerosol.constraints.size(), 2u);
@@ -153,3 +163,11 @@ TEST(ParseAerosol, RejectsLinearConstraintTermReferencingUnknownPhase)
   // Location points at the term's own "phase" value (line 25), nested inside the terms list.
   EXPECT_TRUE(HasErrorAt(parsed.error(), ErrorCode::UnknownPhase, "25:29"));
 }
+
+TEST(ParseAerosol, RejectsRateExpressionThatUsesPressure)
+{
+  auto parsed = Parse("v1_unit_configs/aerosol/invalid_rate_expression.json");
+  ASSERT_FALSE(parsed) << "Expected validation to fail for a rate expression of pressure.";
+  // Location points at the start of the expression text (line 66).
+  EXPECT_TRUE(HasErrorAt(parsed.error(), ErrorCode::InvalidExpression, "66:71"));
+}
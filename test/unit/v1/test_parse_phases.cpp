@@ -25,15 +25,15 @@ TEST(ParserBase, CanParseValidPhases)
     EXPECT_EQ(mechanism.phases[0].species.size(), 2);
     EXPECT_EQ(mechanism.phases[0].species[0].name, "A");
     EXPECT_EQ(mechanism.phases[0].species[1].name, "B");
-    EXPECT_EQ(mechanism.phases[0].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.phases[0].unknown_properties["__other"], "key");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.phases[0]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.phases[0], "__other"), "key");
 
     EXPECT_EQ(mechanism.phases[1].name, "aqueous");
     EXPECT_EQ(mechanism.phases[1].species.size(), 1);
     EXPECT_EQ(mechanism.phases[1].species[0].name, "C");
-    EXPECT_EQ(mechanism.phases[1].unknown_properties.size(), 2);
-    EXPECT_EQ(mechanism.phases[1].unknown_properties["__other1"], "key1");
-    EXPECT_EQ(mechanism.phases[1].unknown_properties["__other2"], "key2");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.phases[1]).size(), 2);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.phases[1], "__other1"), "key1");
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.phases[1], "__other2"), "key2");
   }
 }
 
@@ -136,26 +136,26 @@ TEST(ParserBase, CanParsePhaseSpeciesProperties)
     const auto& phase = mechanism.phases[0];
     EXPECT_EQ(phase.name, "my phase");
     EXPECT_EQ(phase.species.size(), 3);
-    EXPECT_EQ(phase.unknown_properties.size(), 1);
-    EXPECT_EQ(phase.unknown_properties.at("__my custom phase property"), "custom value");
+    EXPECT_EQ(mechanism.unknown_properties.Of(phase).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(phase, "__my custom phase property"), "custom value");
 
     // Check first species with diffusion coefficient
     EXPECT_EQ(phase.species[0].name, "foo");
     EXPECT_TRUE(phase.species[0].diffusion_coefficient.has_value());
     EXPECT_EQ(phase.species[0].diffusion_coefficient.value(), 4.23e-7);
-    EXPECT_EQ(phase.species[0].unknown_properties.size(), 0);
+    EXPECT_EQ(mechanism.unknown_properties.Of(phase.species[0]).size(), 0);
 
     // Check second species with custom properties
     EXPECT_EQ(phase.species[1].name, "bar");
     EXPECT_FALSE(phase.species[1].diffusion_coefficient.has_value());
-    EXPECT_EQ(phase.species[1].unknown_properties.size(), 2);
-    EXPECT_EQ(phase.species[1].unknown_properties.at("__custom property"), "0.5");
-    EXPECT_EQ(phase.species[1].unknown_properties.at("__another custom property"), "value");
+    EXPECT_EQ(mechanism.unknown_properties.Of(phase.species[1]).size(), 2);
+    EXPECT_EQ(mechanism.unknown_properties.Find(phase.species[1], "__custom property"), "0.5");
+    EXPECT_EQ(mechanism.unknown_properties.Find(phase.species[1], "__another custom property"), "value");
 
     // Check third species (simple string format)
     EXPECT_EQ(phase.species[2].name, "baz");
     EXPECT_FALSE(phase.species[2].diffusion_coefficient.has_value());
-    EXPECT_EQ(phase.species[2].unknown_properties.size(), 0);
+    EXPECT_EQ(mechanism.unknown_properties.Of(phase.species[2]).size(), 0);
   }
 }
 
@@ -21,9 +21,9 @@ TEST(ParserBase, CanParseValidSpecies)
     EXPECT_EQ(mechanism.species.size(), 3);
 
     EXPECT_EQ(mechanism.species[0].name, "A");
-    EXPECT_EQ(mechanism.species[0].unknown_properties.size(), 2);
-    EXPECT_EQ(mechanism.species[0].unknown_properties["__absolute tolerance"], "1.0e-30");
-    EXPECT_EQ(mechanism.species[0].unknown_properties["__long name"], "ozone");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.species[0]).size(), 2);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.species[0], "__absolute tolerance"), "1.0e-30");
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.species[0], "__long name"), "ozone");
     EXPECT_EQ(mechanism.species[0].is_third_body.has_value(), true);
     EXPECT_EQ(mechanism.species[0].is_third_body.value(), true);
 
@@ -32,16 +32,16 @@ TEST(ParserBase, CanParseValidSpecies)
     EXPECT_EQ(mechanism.species[1].molecular_weight.value(), 0.0340147);
     EXPECT_EQ(mechanism.species[1].constant_concentration.has_value(), true);
     EXPECT_EQ(mechanism.species[1].constant_concentration.value(), 2.5e19);
-    EXPECT_EQ(mechanism.species[1].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.species[1].unknown_properties["__absolute tolerance"], "1.0e-10");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.species[1]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.species[1], "__absolute tolerance"), "1.0e-10");
 
     EXPECT_EQ(mechanism.species[2].name, "aerosol stuff");
     EXPECT_EQ(mechanism.species[2].molecular_weight.has_value(), true);
     EXPECT_EQ(mechanism.species[2].molecular_weight.value(), 0.5);
     EXPECT_EQ(mechanism.species[2].constant_mixing_ratio.has_value(), true);
     EXPECT_EQ(mechanism.species[2].constant_mixing_ratio.value(), 1.0e-6);
-    EXPECT_EQ(mechanism.species[2].unknown_properties.size(), 1);
-    EXPECT_EQ(mechanism.species[2].unknown_properties["__absolute tolerance"], "1.0e-20");
+    EXPECT_EQ(mechanism.unknown_properties.Of(mechanism.species[2]).size(), 1);
+    EXPECT_EQ(mechanism.unknown_properties.Find(mechanism.species[2], "__absolute tolerance"), "1.0e-20");
   }
 }
 
@@ -0,0 +1,35 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace mechanism_configuration
+{
+  // The whole of a file, byte for byte
+  inline std::string ReadBytes(const std::filesystem::path& path)
+  {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+
+  // Replaces the contents of a file with `bytes`
+  inline void WriteBytes(const std::filesystem::path& path, const std::string& bytes)
+  {
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << bytes;
+  }
+
+  // An empty directory `name` under the system temporary directory
+  inline std::filesystem::path FreshDirectory(const std::string& name)
+  {
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    return dir;
+  }
+}  // namespace mechanism_configuration
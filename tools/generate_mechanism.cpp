@@ -0,0 +1,142 @@
+// Copyright (C) 2023–2026 University Corporation for Atmospheric Research
+//                         University of Illinois at Urbana-Champaign
+// SPDX-License-Identifier: Apache-2.0
+//
+// Writes a synthetic mechanism configuration of any size, for measuring how parsing scales.
+// See WriteSyntheticMechanism.
+
+#include <mechanism_configuration/errors.hpp>
+#include <mechanism_configuration/synthetic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  constexpr std::string_view USAGE = R"(usage: mechanism_configuration_generate <directory> [options]
+
+Writes a valid, randomly generated mechanism configuration into <directory> and prints the path
+to parse. The same options always write the same configuration.
+
+options:
+  --version <0|1>               configuration version (default 1)
+  --format <yaml|json>          file format (default yaml)
+  --files <n>                   split the reactions across n files (default 0: inline)
+  --seed <n>                    random seed (default 0)
+  --species <n>                 number of species (default 50)
+  --phases <n>                  number of phases, including the gas phase (default 1)
+  --reactions <n>               n reactions, spread evenly over every kind the version supports
+  --<kind> <n>                  n reactions of one kind, in addition to --reactions: arrhenius,
+                                branched, emission, first-order-loss, photolysis, surface,
+                                taylor-series, troe, ternary-chemical-activation, tunneling,
+                                user-defined, lambda-rate-constant
+  --aerosol-processes <n>       number of aerosol processes (version 1, needs 2 or more phases)
+  --emission-sources <n>        number of emission sources (version 1)
+)";
+
+  // The reaction kind of each --<kind> option
+  std::map<std::string_view, std::size_t SyntheticReactionCounts::*> ReactionKinds()
+  {
+    return {
+      { "arrhenius", &SyntheticReactionCounts::arrhenius },
+      { "branched", &SyntheticReactionCounts::branched },
+      { "emission", &SyntheticReactionCounts::emission },
+      { "first-order-loss", &SyntheticReactionCounts::first_order_loss },
+      { "photolysis", &SyntheticReactionCounts::photolysis },
+      { "surface", &SyntheticReactionCounts::surface },
+      { "taylor-series", &SyntheticReactionCounts::taylor_series },
+      { "troe", &SyntheticReactionCounts::troe },
+      { "ternary-chemical-activation", &SyntheticReactionCounts::ternary_chemical_activation },
+      { "tunneling", &SyntheticReactionCounts::tunneling },
+      { "user-defined", &SyntheticReactionCounts::user_defined },
+      { "lambda-rate-constant", &SyntheticReactionCounts::lambda_rate_constant },
+    };
+  }
+
+  // Spreads `total` reactions evenly over the kinds `version` supports
+  void SpreadReactions(SyntheticReactionCounts& counts, std::size_t total, int version)
+  {
+    std::map<std::string_view, std::size_t SyntheticReactionCounts::*> kinds = ReactionKinds();
+    if (version == 0)
+    {
+      kinds.erase("taylor-series");
+      kinds.erase("lambda-rate-constant");
+    }
+    std::size_t k = 0;
+    for (const auto& [name, count] : kinds)
+      counts.*count += total / kinds.size() + (k++ < total % kinds.size() ? 1 : 0);
+  }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  if (argc < 2 || std::string_view(argv[1]) == "--help")
+  {
+    std::cerr << USAGE;
+    return argc < 2 ? 1 : 0;
+  }
+
+  SyntheticOptions options;
+  std::size_t reactions = 0;
+  const auto kinds = ReactionKinds();
+  std::string argument;
+  try
+  {
+    for (int i = 2; i < argc; i += 2)
+    {
+      const std::string_view flag = argv[i];
+      argument = flag;
+      if (!flag.starts_with("--") || i + 1 >= argc)
+        throw std::invalid_argument(argument);
+      const std::string value = argv[i + 1];
+      argument += " " + value;
+      const std::string_view name = flag.substr(2);
+
+      if (name == "version")
+        options.version = std::stoi(value);
+      else if (name == "format" && (value == "yaml" || value == "json"))
+        options.format = value == "yaml" ? SyntheticFormat::Yaml : SyntheticFormat::Json;
+      else if (name == "files")
+        options.files = std::stoull(value);
+      else if (name == "seed")
+        options.seed = std::stoull(value);
+      else if (name == "species")
+        options.species = std::stoull(value);
+      else if (name == "phases")
+        options.phases = std::stoull(value);
+      else if (name == "reactions")
+        reactions = std::stoull(value);
+      else if (name == "aerosol-processes")
+        options.aerosol_processes = std::stoull(value);
+      else if (name == "emission-sources")
+        options.emission_sources = std::stoull(value);
+      else if (const auto kind = kinds.find(name); kind != kinds.end())
+        options.reactions.*(kind->second) = std::stoull(value);
+      else
+        throw std::invalid_argument(argument);
+    }
+  }
+  catch (const std::exception&)
+  {
+    std::cerr << "Invalid argument '" << argument << "'\n\n" << USAGE;
+    return 1;
+  }
+  SpreadReactions(options.reactions, reactions, options.version);
+
+  const auto path = WriteSyntheticMechanism(options, argv[1]);
+  if (!path)
+  {
+    for (const auto& [code, message] : path.error())
+      std::cerr << "[" << ErrorCodeToString(code) << "] " << message << '\n';
+    return 1;
+  }
+  std::cout << path->string() << '\n';
+  return 0;
+}